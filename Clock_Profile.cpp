@@ -0,0 +1,76 @@
+/*****************************************************************************
+* | File      	:   Clock_Profile.cpp
+* | Author      :   lernerc606
+* | Function    :   CPU clock per wake phase
+* | Info        :
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+*
+******************************************************************************/
+#include "Clock_Profile.h"
+#include "Debug.h"
+
+static const UWORD Clock_MHz[CLOCK_PHASE_COUNT] = {
+    CLOCK_BOOT_MHZ, CLOCK_TRANSFER_MHZ, CLOCK_WAIT_MHZ, CLOCK_SHUTDOWN_MHZ
+};
+static const char *const Clock_Name[CLOCK_PHASE_COUNT] = {
+    "boot", "transfer", "wait", "shutdown"
+};
+
+static UBYTE Clock_Phase = CLOCK_PHASE_COUNT;   // none yet
+static UDOUBLE Clock_Start_us = 0;
+static UDOUBLE Clock_Time_us[CLOCK_PHASE_COUNT];
+
+/******************************************************************************
+function :	Switch to the clock of a wake phase
+parameter:
+    Phase : CLOCK_PHASE_x
+return   :  The previous phase, so waits can restore it when they end
+info     :  micros() runs off the system timer and stays correct across
+            frequency changes.
+******************************************************************************/
+UBYTE Clock_SetPhase(UBYTE Phase)
+{
+    UBYTE Previous = Clock_Phase;
+    UDOUBLE Now = micros();
+
+    if (Phase >= CLOCK_PHASE_COUNT || Phase == Previous)
+        return Previous;
+
+    if (Previous < CLOCK_PHASE_COUNT)
+        Clock_Time_us[Previous] += Now - Clock_Start_us;
+    Clock_Start_us = Now;
+    Clock_Phase = Phase;
+
+    if (getCpuFrequencyMhz() != Clock_MHz[Phase])
+        setCpuFrequencyMhz(Clock_MHz[Phase]);
+    return Previous;
+}
+
+/******************************************************************************
+function :	Log the time spent in each phase and the MHz x ms energy proxy
+info     :  Closes the running phase up to now; call once, just before the
+            log is flushed for deep sleep.
+******************************************************************************/
+void Clock_Report(void)
+{
+    uint64_t Proxy = 0, Reference = 0;
+
+    if (Clock_Phase < CLOCK_PHASE_COUNT) {
+        UDOUBLE Now = micros();
+        Clock_Time_us[Clock_Phase] += Now - Clock_Start_us;
+        Clock_Start_us = Now;
+    }
+
+    for (UBYTE i = 0; i < CLOCK_PHASE_COUNT; i++) {
+        UDOUBLE ms = Clock_Time_us[i] / 1000;
+        LOG_I("Clock %-8s %3u MHz %7lu ms %9lu MHz*ms\r\n", Clock_Name[i],
+              (unsigned)Clock_MHz[i], (unsigned long)ms, (unsigned long)(ms * Clock_MHz[i]));
+        Proxy += (uint64_t)ms * Clock_MHz[i];
+        Reference += (uint64_t)ms * CLOCK_REFERENCE_MHZ;
+    }
+    if (Reference > 0)
+        LOG_I("Clock proxy %lu MHz*ms, %u%% of a fixed %u MHz wake\r\n",
+              (unsigned long)Proxy, (unsigned)(Proxy * 100 / Reference), (unsigned)CLOCK_REFERENCE_MHZ);
+}
@@ -0,0 +1,43 @@
+/*****************************************************************************
+* | File      	:   Clock_Profile.h
+* | Author      :   lernerc606
+* | Function    :   CPU clock per wake phase
+* | Info        :
+*   Most of a wake is spent waiting: on the Serial monitor and the display
+*   power rail at boot, and on BUSY while the panel refreshes. Only the
+*   SD read and the bit-banged display transfer need a fast CPU. Each
+*   phase gets its own clock here, and the time spent in every phase is
+*   logged together with a MHz x ms figure as a rough energy proxy.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+*
+******************************************************************************/
+#ifndef _CLOCK_PROFILE_H_
+#define _CLOCK_PROFILE_H_
+
+#include "DEV_Config.h"
+
+/**
+ * Wake phases
+**/
+#define CLOCK_PHASE_BOOT        0   // Serial, GPIO and display power up
+#define CLOCK_PHASE_TRANSFER    1   // SD read and display data transfer
+#define CLOCK_PHASE_WAIT        2   // waiting on the BUSY pin
+#define CLOCK_PHASE_SHUTDOWN    3   // display sleep, log flush, deep sleep
+#define CLOCK_PHASE_COUNT       4
+
+/**
+ * Clock per phase in MHz. The ESP32-C6 runs at 160, 80, 40, 20 or 10 MHz;
+ * the bit-banged SPI speed scales directly with the CPU clock.
+**/
+#define CLOCK_BOOT_MHZ          80
+#define CLOCK_TRANSFER_MHZ      160
+#define CLOCK_WAIT_MHZ          10
+#define CLOCK_SHUTDOWN_MHZ      40
+#define CLOCK_REFERENCE_MHZ     160     // default clock, for the savings figure
+
+UBYTE Clock_SetPhase(UBYTE Phase);
+void Clock_Report(void);
+
+#endif
@@ -30,6 +30,7 @@
 #
 ******************************************************************************/
 #include "DEV_Config.h"
+#include "Debug.h"
 #include <SPI.h> // SPI library
 
 void GPIO_Config(void)
@@ -39,33 +40,33 @@ void GPIO_Config(void)
     
 
     pinMode(EPD_BUSY_PIN,  INPUT);
-    Serial.printf("init board3...\r\n");Serial.flush(); 
+    LOG_D("init board3...\r\n");
     pinMode(EPD_RST_PIN , OUTPUT);
-    Serial.printf("init board4...\r\n");Serial.flush(); 
+    LOG_D("init board4...\r\n");
     pinMode(EPD_DC_PIN  , OUTPUT);
-    Serial.printf("init board5...\r\n");Serial.flush(); 
+    LOG_D("init board5...\r\n");
     pinMode(EPD_PWR_PIN,  OUTPUT);
-    Serial.printf("init board6...\r\n");Serial.flush(); 
+    LOG_D("init board6...\r\n");
 
     pinMode(EPD_SCK_PIN, OUTPUT);
-    Serial.printf("init board7...\r\n");Serial.flush(); 
+    LOG_D("init board7...\r\n");
     pinMode(EPD_MOSI_PIN, OUTPUT);
-    Serial.printf("init board8...\r\n");Serial.flush(); 
+    LOG_D("init board8...\r\n");
     pinMode(EPD_CS_M_PIN , OUTPUT);
-    Serial.printf("init board9...\r\n");Serial.flush(); 
+    LOG_D("init board9...\r\n");
     pinMode(EPD_CS_S_PIN , OUTPUT);
-    Serial.printf("init board10...\r\n");Serial.flush(); 
+    LOG_D("init board10...\r\n");
 
     digitalWrite(EPD_CS_M_PIN , HIGH);
-    Serial.printf("init board11...\r\n");Serial.flush(); 
+    LOG_D("init board11...\r\n");
     digitalWrite(EPD_CS_S_PIN , HIGH);
-    Serial.printf("init board12...\r\n");Serial.flush(); 
+    LOG_D("init board12...\r\n");
     digitalWrite(EPD_SCK_PIN, LOW);
-    Serial.printf("init board13...\r\n");Serial.flush(); 
+    LOG_D("init board13...\r\n");
     delay(500);
     digitalWrite(EPD_PWR_PIN , HIGH); 
     delay(500);
-    Serial.printf("init board14...\r\n");Serial.flush(); 
+    LOG_D("init board14...\r\n");
 }
 
 void GPIO_Mode(UWORD GPIO_Pin, UWORD Mode)
@@ -84,9 +85,9 @@ Info:
 UBYTE DEV_Module_Init(void)
 {
 	//gpio
-  Serial.printf("init board1...\r\n");
+  LOG_D("init board1...\r\n");
 	GPIO_Config();
-  Serial.printf("init board2...\r\n");
+  LOG_D("init board2...\r\n");
 
 	return 0;
 }
@@ -140,3 +141,11 @@ void DEV_Module_Exit(void)
     digitalWrite(EPD_PWR_PIN , LOW);
     digitalWrite(EPD_RST_PIN , LOW);
 }
+
+/******************************************************************************
+function:	Battery voltage in mV, read through the on-board divider
+******************************************************************************/
+UWORD DEV_Battery_mV(void)
+{
+    return analogReadMilliVolts(BAT_ADC_PIN) * 2;
+}
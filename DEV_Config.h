@@ -58,6 +58,8 @@
 #define EPD_BUSY_PIN 20   //brown BUSY
 #define EPD_PWR_PIN  14   //grey PWR
 
+#define BAT_ADC_PIN  0    //battery sense, 1:2 divider on the FireBeetle 2 C6
+
 
 #define GPIO_PIN_SET   1
 #define GPIO_PIN_RESET 0
@@ -80,5 +82,6 @@ void DEV_SPI_WriteByte(UBYTE data);
 UBYTE DEV_SPI_ReadByte();
 void DEV_SPI_Write_nByte(UBYTE *pData, UDOUBLE len);
 void DEV_Module_Exit(void);
+UWORD DEV_Battery_mV(void);
 
 #endif
@@ -0,0 +1,144 @@
+/*****************************************************************************
+* | File      	:   Debug.cpp
+* | Author      :   lernerc606
+* | Function    :   Buffered log backend for Debug() and LOG_x()
+* | Info        :
+*   Producers format into a RAM ring buffer and return immediately. The
+*   buffer is single producer (the Arduino loop task) and lock free on the
+*   producer side; only the consumers (drain task, final flush) take a
+*   mutex between themselves. When the buffer is full new messages are
+*   dropped and counted, they never wait for Serial.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+*
+******************************************************************************/
+#include "Debug.h"
+#include <atomic>
+#include <stdarg.h>
+#include <string.h>
+
+#define LOG_BUFFER_MASK (LOG_BUFFER_SIZE - 1)
+
+static char Log_Buffer[LOG_BUFFER_SIZE];
+static std::atomic<uint32_t> Log_Head(0);    // written by the producer
+static std::atomic<uint32_t> Log_Tail(0);    // written by the consumer
+static std::atomic<uint32_t> Log_Dropped(0);
+static SemaphoreHandle_t Log_Mutex = NULL;
+
+#if LOG_DRAIN_TASK
+static void Log_DrainTask(void *arg)
+{
+    for (;;) {
+        Log_Drain(Serial);
+        vTaskDelay(pdMS_TO_TICKS(LOG_DRAIN_PERIOD_MS));
+    }
+}
+#endif
+
+/******************************************************************************
+function :	Create the consumer lock and, if enabled, the drain task
+parameter:
+info     :  The drain task runs at idle priority, so it only gets the CPU
+            while the loop task sleeps (row delays, BUSY polling).
+******************************************************************************/
+void Log_Init(void)
+{
+    if (Log_Mutex != NULL)
+        return;
+    Log_Mutex = xSemaphoreCreateMutex();
+#if LOG_DRAIN_TASK
+    xTaskCreate(Log_DrainTask, "log_drain", 2048, NULL, tskIDLE_PRIORITY, NULL);
+#endif
+}
+
+/******************************************************************************
+function :	Append a message to the ring buffer
+parameter:
+    Level : LOG_LEVEL_x, errors and warnings get a short prefix
+    Msg   : Zero terminated text
+******************************************************************************/
+void Log_Write(uint8_t Level, const char *Msg)
+{
+    const char *Prefix = (Level == LOG_LEVEL_ERROR)? "E: " : (Level == LOG_LEVEL_WARN)? "W: " : "";
+    uint32_t PrefixLen = strlen(Prefix);
+    uint32_t Len = strlen(Msg);
+    uint32_t Head = Log_Head.load(std::memory_order_relaxed);
+    uint32_t Tail = Log_Tail.load(std::memory_order_acquire);
+
+    if (PrefixLen + Len > LOG_BUFFER_SIZE - (Head - Tail)) {
+        Log_Dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    const char *Parts[2] = {Prefix, Msg};
+    uint32_t Lens[2] = {PrefixLen, Len};
+    for (int p = 0; p < 2; p++) {
+        const char *Src = Parts[p];
+        uint32_t n = Lens[p];
+        while (n > 0) {
+            uint32_t Offset = Head & LOG_BUFFER_MASK;
+            uint32_t Chunk = LOG_BUFFER_SIZE - Offset;
+            if (Chunk > n)
+                Chunk = n;
+            memcpy(&Log_Buffer[Offset], Src, Chunk);
+            Src += Chunk;
+            Head += Chunk;
+            n -= Chunk;
+        }
+    }
+    Log_Head.store(Head, std::memory_order_release);
+}
+
+/******************************************************************************
+function :	printf into the ring buffer
+parameter:
+    Level : LOG_LEVEL_x
+    Fmt   : printf format, messages longer than LOG_LINE_MAX are truncated
+******************************************************************************/
+void Log_Printf(uint8_t Level, const char *Fmt, ...)
+{
+    char Line[LOG_LINE_MAX];
+    va_list Args;
+    va_start(Args, Fmt);
+    vsnprintf(Line, sizeof(Line), Fmt, Args);
+    va_end(Args);
+    Log_Write(Level, Line);
+}
+
+/******************************************************************************
+function :	Move everything buffered so far to Out
+parameter:
+    Out   : Serial, an open SD File or any other Print
+return   :  Number of bytes written
+******************************************************************************/
+uint32_t Log_Drain(Print &Out)
+{
+    if (Log_Mutex != NULL)
+        xSemaphoreTake(Log_Mutex, portMAX_DELAY);
+
+    uint32_t Tail = Log_Tail.load(std::memory_order_relaxed);
+    uint32_t Head = Log_Head.load(std::memory_order_acquire);
+    uint32_t Written = Head - Tail;
+
+    while (Tail != Head) {
+        uint32_t Offset = Tail & LOG_BUFFER_MASK;
+        uint32_t Chunk = LOG_BUFFER_SIZE - Offset;
+        if (Chunk > Head - Tail)
+            Chunk = Head - Tail;
+        Out.write((const uint8_t *)&Log_Buffer[Offset], Chunk);
+        Tail += Chunk;
+        Log_Tail.store(Tail, std::memory_order_release);
+    }
+
+    uint32_t Dropped = Log_Dropped.exchange(0, std::memory_order_relaxed);
+    if (Dropped) {
+        Out.print("(log buffer full, ");
+        Out.print((int)Dropped);
+        Out.print(" messages dropped)\r\n");
+    }
+
+    if (Log_Mutex != NULL)
+        xSemaphoreGive(Log_Mutex);
+    return Written;
+}
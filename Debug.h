@@ -1,6 +1,7 @@
 /*****************************************************************************
 * | File      	:	Debug.h
 * | Author      :   Waveshare team
+* | Modified by :   lernerc606
 * | Function    :	debug with printf
 * | Info        :
 *   Image scanning
@@ -10,18 +11,75 @@
 * | Date        :   2018-01-11
 * | Info        :   Basic version
 *
+* Modifications:
+* - Debug() and the LOG_x() macros no longer write to Serial directly.
+*   Messages are formatted into a RAM ring buffer (Debug.cpp) that is
+*   drained to Serial from a low priority task, or appended to LOG_FILE on
+*   the SD card at the end of the wake, so logging never blocks the
+*   display transfer.
+* - Messages above LOG_LEVEL are compiled out.
+*
 ******************************************************************************/
 #ifndef __DEBUG_H
 #define __DEBUG_H
 
-#include <Wire.h>
+#include <Arduino.h>
+#include <stdint.h>
+
+/**
+ * Log levels
+**/
+#define LOG_LEVEL_NONE      0
+#define LOG_LEVEL_ERROR     1
+#define LOG_LEVEL_WARN      2
+#define LOG_LEVEL_INFO      3
+#define LOG_LEVEL_DEBUG     4
+
+/**
+ * Log config
+**/
+#ifndef LOG_LEVEL
+#define LOG_LEVEL           LOG_LEVEL_INFO
+#endif
+#define LOG_BUFFER_SIZE     4096        // RAM ring buffer, must be a power of two
+#define LOG_LINE_MAX        160         // longest single formatted message
+#define LOG_TO_SD           0           // 1: append the wake's log to LOG_FILE instead of Serial
+#define LOG_FILE            "/log.txt"
+#define LOG_DRAIN_TASK      (!LOG_TO_SD) // drain to Serial while the main task waits
+#define LOG_DRAIN_PERIOD_MS 20
+
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+	#define LOG_E(...) Log_Printf(LOG_LEVEL_ERROR, __VA_ARGS__)
+#else
+	#define LOG_E(...) do {} while (0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+	#define LOG_W(...) Log_Printf(LOG_LEVEL_WARN, __VA_ARGS__)
+#else
+	#define LOG_W(...) do {} while (0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+	#define LOG_I(...) Log_Printf(LOG_LEVEL_INFO, __VA_ARGS__)
+#else
+	#define LOG_I(...) do {} while (0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+	#define LOG_D(...) Log_Printf(LOG_LEVEL_DEBUG, __VA_ARGS__)
+#else
+	#define LOG_D(...) do {} while (0)
+#endif
 
 #define USE_DEBUG 1
-#if USE_DEBUG
-	#define Debug(__info) Serial.print(__info)
+#if USE_DEBUG && LOG_LEVEL >= LOG_LEVEL_INFO
+	#define Debug(__info) Log_Write(LOG_LEVEL_INFO, __info)
 #else
-	#define Debug(__info)  
+	#define Debug(__info)
 #endif
 
+void Log_Init(void);
+void Log_Write(uint8_t Level, const char *Msg);
+void Log_Printf(uint8_t Level, const char *Fmt, ...) __attribute__((format(printf, 2, 3)));
+uint32_t Log_Drain(Print &Out);
+
 #endif
 
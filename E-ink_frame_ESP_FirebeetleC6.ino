@@ -1,38 +1,44 @@
 #include "EPD_13in3e.h"
-
-// Define the Debug macro if not already defined
-#ifndef Debug
-  #define Debug(msg) Serial.print(msg)
-#endif
+#include "Debug.h"
+#include "Wake_Gate.h"
+#include "Scheduler.h"
+#include "Clock_Profile.h"
 
 void printResetReason() {
   esp_reset_reason_t reason = esp_reset_reason();
-  Serial.print("Reset reason: ");
-  
+  const char *text;
+
   switch (reason) {
-    case ESP_RST_POWERON:    Serial.println("Power-on Reset"); break;
-    case ESP_RST_EXT:        Serial.println("External Reset (Reset Pin)"); break;
-    case ESP_RST_SW:         Serial.println("Software Reset (ESP.restart() or exception)"); break;
-    case ESP_RST_PANIC:      Serial.println("Panic Reset (Guru Meditation Error)"); break;
-    case ESP_RST_INT_WDT:    Serial.println("Interrupt Watchdog Timer Reset"); break;
-    case ESP_RST_TASK_WDT:   Serial.println("Task Watchdog Timer Reset"); break;
-    case ESP_RST_WDT:        Serial.println("Other Watchdog Timer Reset"); break;
-    case ESP_RST_DEEPSLEEP:  Serial.println("Wake from Deep Sleep"); break;
-    case ESP_RST_BROWNOUT:   Serial.println("Brownout Reset (Power failure)"); break;
-    case ESP_RST_SDIO:       Serial.println("Reset Over SDIO"); break;
-    default:                 Serial.println("Unknown Reset Reason"); break;
+    case ESP_RST_POWERON:    text = "Power-on Reset"; break;
+    case ESP_RST_EXT:        text = "External Reset (Reset Pin)"; break;
+    case ESP_RST_SW:         text = "Software Reset (ESP.restart() or exception)"; break;
+    case ESP_RST_PANIC:      text = "Panic Reset (Guru Meditation Error)"; break;
+    case ESP_RST_INT_WDT:    text = "Interrupt Watchdog Timer Reset"; break;
+    case ESP_RST_TASK_WDT:   text = "Task Watchdog Timer Reset"; break;
+    case ESP_RST_WDT:        text = "Other Watchdog Timer Reset"; break;
+    case ESP_RST_DEEPSLEEP:  text = "Wake from Deep Sleep"; break;
+    case ESP_RST_BROWNOUT:   text = "Brownout Reset (Power failure)"; break;
+    case ESP_RST_SDIO:       text = "Reset Over SDIO"; break;
+    default:                 text = "Unknown Reset Reason"; break;
   }
+  LOG_I("Reset reason: %s\r\n", text);
 }
 
 
 void setup() {
 
+  // Skipped timer ticks go back to sleep in here, before anything else runs
+  Wake_Gate_Early();
+  Clock_SetPhase(CLOCK_PHASE_BOOT);
+
   Serial.begin(115200);  // Set baud rate
+  Log_Init();
   delay(1000);  // Give time for Serial Monitor to connect
-  Serial.println("🔥FireBeetle ESP32-C6 is running!🔥");
+  LOG_I("🔥FireBeetle ESP32-C6 is running!🔥\r\n");
 
-  Serial.println("\nESP32 Reset Diagnostic:");
+  LOG_I("\r\nESP32 Reset Diagnostic:\r\n");
   printResetReason();
+  Sched_Begin();   // battery reading before the display and SD card draw power
 
   pinMode(LED_BUILTIN, OUTPUT);
   digitalWrite(LED_BUILTIN, LOW);
@@ -15,9 +15,24 @@
 *   them on a 13.3-inch Spectra 6 E-Ink display.
 * - Image filenames are retrieved from a text file (order.txt); index.txt
 *   tracks the current image and is updated to point to the next one.
-* - The ESP32 enters deep sleep for the duration specified in SLEEP_TIME.
+* - The ESP32 enters deep sleep for the duration specified in SLEEP_TIME,
+*   stretched as the battery runs down; SD failures retry sooner
+*   (Scheduler.h).
+* - The CPU clock follows the wake phase (Clock_Profile.h): full speed for
+*   the SD read and display transfer, the lowest clock while BUSY is held.
+* - Pictures are streamed through EPD_13IN3E_SendRows() and can be
+*   mirrored, flipped or rotated by 180 degrees on the way
+*   (EPD_13IN3E_ORIENTATION).
+* - Landscape pictures can be stored as .s6t tiles and are rotated by 90 or
+*   270 degrees while streaming, reading each tile once.
 * - To maximize battery life, a MOSFET completely powers down the SD card
 *   reader when idle.
+* - Timer wakes pass through Wake_Gate first, so hourly ticks can refresh
+*   on selected days only without bringing up the whole board.
+* - Log output goes through the buffered Debug.h backend instead of
+*   blocking Serial prints.
+* - A caption from order.txt ("name | caption") and a battery gauge are
+*   drawn over the picture while it streams (GUI_Overlay.h).
 *
 * License:
 # Permission is hereby granted, free of charge, to any person obtaining a copy
@@ -41,6 +56,12 @@
 ******************************************************************************/
 #include "EPD_13in3e.h"
 #include "Debug.h"
+#include "Scheduler.h"
+#include "Clock_Profile.h"
+#include "GUI_Overlay.h"
+#include "GUI_Paint.h"
+#include "GUI_Text.h"
+#include "GUI_SDFont.h"
 #include <SD.h>  // SD card library for SPI
 #include <SPI.h> // SPI library
 
@@ -55,11 +76,31 @@
 // --- Configuration ---
 #define ORDER_FILE "/order.txt"     // Order file (must be in the root directory)
 #define INDEX_FILE "/index.txt"     // Index file (must be in the root directory)
-//#define SLEEP_TIME 30000000UL         // Deep sleep time in microseconds
-#define SLEEP_TIME 86400000000UL
 // ***** Move pictureList to global scope to save stack space *****
 const int maxPictures = 365;  // Maximum number of pictures in the order file
-String pictureList[maxPictures];  // Global array for picture file names
+String pictureList[maxPictures];  // Global array for order file lines
+static bool sdMounted = false;    // SD card powered and mounted
+
+// Overlays (GUI_Overlay.h)
+#define CAPTION_FONT    Font24      // text after '|' in an order.txt line
+#define CAPTION_HEIGHT  24          // CAPTION_FONT.Height, sizes the arena
+#define CAPTION_MARGIN  40          // pixels from the picture's edge
+#define CAPTION_PAD     8           // white box around the text
+#define CAPTION_LINES   3           // longer captions end in "..."
+// #define CAPTION_SDFONT  "/caption.s6f"  // one-line captions in any script (tools/make_s6f.py)
+#define GAUGE_MV        SCHED_STRETCH1_MV   // battery gauge below this, 0 for never
+#define GAUGE_FULL_MV   4200
+#define GAUGE_W         64          // battery outline, without the nub
+#define GAUGE_H         32
+#define GAUGE_NUB       6
+
+// Arena bytes of a W x H layer in any rotation: the panel rows run along
+// either side, rounded out to whole bytes at both ends
+#define OVERLAY_BOX(W, H)   (((W) / 2 + 1) * (H) > ((H) / 2 + 1) * (W)? ((W) / 2 + 1) * (H) : ((H) / 2 + 1) * (W))
+#define CAPTION_BOX(Lines)  OVERLAY_BOX(EPD_13IN3E_HEIGHT - 2 * CAPTION_MARGIN, \
+                                        (Lines) * CAPTION_HEIGHT + 2 * CAPTION_PAD)
+#define GAUGE_BOX           OVERLAY_BOX(GAUGE_W + GAUGE_NUB + 2 * CAPTION_PAD, GAUGE_H + 2 * CAPTION_PAD)
+#define OVERLAY_BYTES       (CAPTION_BOX(CAPTION_LINES) + GAUGE_BOX)    // 70.5 KB with Font24
 
 
 // const UBYTE spiCsPin[2] = {
@@ -123,6 +164,25 @@ const UBYTE TFT_VCOM_POWER_V[1] = {
 	0x02
 };
 
+// Byte with its two pixels swapped, for the horizontal mirror
+static const UBYTE EPD_13IN3E_NibbleSwap[256] = {
+	0x00, 0x10, 0x20, 0x30, 0x40, 0x50, 0x60, 0x70, 0x80, 0x90, 0xA0, 0xB0, 0xC0, 0xD0, 0xE0, 0xF0,
+	0x01, 0x11, 0x21, 0x31, 0x41, 0x51, 0x61, 0x71, 0x81, 0x91, 0xA1, 0xB1, 0xC1, 0xD1, 0xE1, 0xF1,
+	0x02, 0x12, 0x22, 0x32, 0x42, 0x52, 0x62, 0x72, 0x82, 0x92, 0xA2, 0xB2, 0xC2, 0xD2, 0xE2, 0xF2,
+	0x03, 0x13, 0x23, 0x33, 0x43, 0x53, 0x63, 0x73, 0x83, 0x93, 0xA3, 0xB3, 0xC3, 0xD3, 0xE3, 0xF3,
+	0x04, 0x14, 0x24, 0x34, 0x44, 0x54, 0x64, 0x74, 0x84, 0x94, 0xA4, 0xB4, 0xC4, 0xD4, 0xE4, 0xF4,
+	0x05, 0x15, 0x25, 0x35, 0x45, 0x55, 0x65, 0x75, 0x85, 0x95, 0xA5, 0xB5, 0xC5, 0xD5, 0xE5, 0xF5,
+	0x06, 0x16, 0x26, 0x36, 0x46, 0x56, 0x66, 0x76, 0x86, 0x96, 0xA6, 0xB6, 0xC6, 0xD6, 0xE6, 0xF6,
+	0x07, 0x17, 0x27, 0x37, 0x47, 0x57, 0x67, 0x77, 0x87, 0x97, 0xA7, 0xB7, 0xC7, 0xD7, 0xE7, 0xF7,
+	0x08, 0x18, 0x28, 0x38, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xA8, 0xB8, 0xC8, 0xD8, 0xE8, 0xF8,
+	0x09, 0x19, 0x29, 0x39, 0x49, 0x59, 0x69, 0x79, 0x89, 0x99, 0xA9, 0xB9, 0xC9, 0xD9, 0xE9, 0xF9,
+	0x0A, 0x1A, 0x2A, 0x3A, 0x4A, 0x5A, 0x6A, 0x7A, 0x8A, 0x9A, 0xAA, 0xBA, 0xCA, 0xDA, 0xEA, 0xFA,
+	0x0B, 0x1B, 0x2B, 0x3B, 0x4B, 0x5B, 0x6B, 0x7B, 0x8B, 0x9B, 0xAB, 0xBB, 0xCB, 0xDB, 0xEB, 0xFB,
+	0x0C, 0x1C, 0x2C, 0x3C, 0x4C, 0x5C, 0x6C, 0x7C, 0x8C, 0x9C, 0xAC, 0xBC, 0xCC, 0xDC, 0xEC, 0xFC,
+	0x0D, 0x1D, 0x2D, 0x3D, 0x4D, 0x5D, 0x6D, 0x7D, 0x8D, 0x9D, 0xAD, 0xBD, 0xCD, 0xDD, 0xED, 0xFD,
+	0x0E, 0x1E, 0x2E, 0x3E, 0x4E, 0x5E, 0x6E, 0x7E, 0x8E, 0x9E, 0xAE, 0xBE, 0xCE, 0xDE, 0xEE, 0xFE,
+	0x0F, 0x1F, 0x2F, 0x3F, 0x4F, 0x5F, 0x6F, 0x7F, 0x8F, 0x9F, 0xAF, 0xBF, 0xCF, 0xDF, 0xEF, 0xFF,
+};
 
 static void EPD_13IN3E_CS_ALL(UBYTE Value)
 {
@@ -187,6 +247,7 @@ parameter:
 ******************************************************************************/
 static void EPD_13IN3E_ReadBusyH(void)
 {
+    UBYTE Phase = Clock_SetPhase(CLOCK_PHASE_WAIT);
     Debug("e-Paper busy\r\n");
 	while(!DEV_Digital_Read(EPD_BUSY_PIN)) {      //LOW: busy, HIGH: idle
         DEV_Delay_ms(10);
@@ -194,6 +255,7 @@ static void EPD_13IN3E_ReadBusyH(void)
     }
 	DEV_Delay_ms(20);
     Debug("e-Paper busy release\r\n");
+    Clock_SetPhase(Phase);
 }
 
 
@@ -201,27 +263,27 @@ static void EPD_13IN3E_ReadBusyH(void)
 function :  Turn On Display
 parameter:
 ******************************************************************************/
-static void EPD_13IN3E_TurnOnDisplay(void)
+void EPD_13IN3E_TurnOnDisplay(void)
 {
-    printf("Write PON \r\n");
+    LOG_I("Write PON \r\n");
     EPD_13IN3E_CS_ALL(0);
     EPD_13IN3E_SendCommand(0x04); // POWER_ON
     EPD_13IN3E_CS_ALL(1);
     EPD_13IN3E_ReadBusyH();
 
-    printf("Write DRF \r\n");
+    LOG_I("Write DRF \r\n");
     DEV_Delay_ms(50);
     EPD_13IN3E_CS_ALL(0);
     EPD_13IN3E_SPI_Sand(DRF, DRF_V, sizeof(DRF_V));
     EPD_13IN3E_CS_ALL(1);
     EPD_13IN3E_ReadBusyH();
 
-    printf("Write POF \r\n");
+    LOG_I("Write POF \r\n");
     EPD_13IN3E_CS_ALL(0);
     EPD_13IN3E_SPI_Sand(POF, POF_V, sizeof(POF_V));
     EPD_13IN3E_CS_ALL(1);
     // EPD_13IN3E_ReadBusyH();
-    printf("Display Done!! \r\n");
+    LOG_I("Display Done!! \r\n");
 }
 
 /******************************************************************************
@@ -508,6 +570,234 @@ void EPD_13IN3E_Show6Block(void)
 }
 
 
+/******************************************************************************
+function :  Battery outline with a sliver of red charge, drawn row by row so
+            it needs neither the SD card nor a frame buffer
+******************************************************************************/
+#define LOWBAT_X0       360
+#define LOWBAT_X1       800
+#define LOWBAT_Y0       700
+#define LOWBAT_Y1       900
+#define LOWBAT_LINE     16
+#define LOWBAT_NUB      40
+
+static void EPD_13IN3E_FillRow(UBYTE *Row, UWORD Xstart, UWORD Xend, UBYTE Color)
+{
+    for (UWORD x = Xstart; x < Xend; x++) {
+        if (x % 2)
+            Row[x / 2] = (Row[x / 2] & 0xF0) | Color;
+        else
+            Row[x / 2] = (Row[x / 2] & 0x0F) | (Color << 4);
+    }
+}
+
+static const UBYTE *EPD_13IN3E_LowBatteryRow(void *Ctx, UWORD y, UBYTE Half, UBYTE *Buf)
+{
+    static UBYTE Row[EPD_13IN3E_ROW_BYTES];
+
+    memset(Row, (EPD_13IN3E_WHITE << 4) | EPD_13IN3E_WHITE, sizeof(Row));
+    if (y >= LOWBAT_Y0 && y < LOWBAT_Y1) {
+        if (y < LOWBAT_Y0 + LOWBAT_LINE || y >= LOWBAT_Y1 - LOWBAT_LINE) {
+            EPD_13IN3E_FillRow(Row, LOWBAT_X0, LOWBAT_X1, EPD_13IN3E_BLACK);
+        } else {
+            EPD_13IN3E_FillRow(Row, LOWBAT_X0, LOWBAT_X0 + LOWBAT_LINE, EPD_13IN3E_BLACK);
+            EPD_13IN3E_FillRow(Row, LOWBAT_X1 - LOWBAT_LINE, LOWBAT_X1, EPD_13IN3E_BLACK);
+            EPD_13IN3E_FillRow(Row, LOWBAT_X0 + 2 * LOWBAT_LINE, LOWBAT_X0 + 2 * LOWBAT_LINE + LOWBAT_NUB, EPD_13IN3E_RED);
+        }
+        if (y >= LOWBAT_Y0 + 3 * LOWBAT_NUB / 2 && y < LOWBAT_Y1 - 3 * LOWBAT_NUB / 2)
+            EPD_13IN3E_FillRow(Row, LOWBAT_X1, LOWBAT_X1 + LOWBAT_NUB, EPD_13IN3E_BLACK);
+    }
+    return Row + Half * EPD_13IN3E_SEG_BYTES;
+}
+
+void EPD_13IN3E_ShowLowBattery(void)
+{
+    EPD_13IN3E_SendRows(EPD_13IN3E_LowBatteryRow, NULL);
+    EPD_13IN3E_TurnOnDisplay();
+}
+
+/******************************************************************************
+function :  Stream a full frame to both controllers, one half row at a time
+parameter:
+    Source : Supplies each half row, see EPD_ROW_SOURCE
+    Ctx    : Passed through to Source
+return   :  0 on success, 1 if Source failed
+info     :  Only loads the frame (DTM); EPD_13IN3E_TurnOnDisplay() shows it.
+            The master gets every row's left half first, then the slave
+            every right half.
+******************************************************************************/
+UBYTE EPD_13IN3E_SendRows(EPD_ROW_SOURCE Source, void *Ctx)
+{
+    static UBYTE Seg[EPD_13IN3E_SEG_BYTES];
+
+    for (UBYTE Half = 0; Half < 2; Half++) {
+        DEV_Digital_Write(Half == 0 ? EPD_CS_M_PIN : EPD_CS_S_PIN, 0);
+        EPD_13IN3E_SendCommand(DTM);
+        for (UWORD y = 0; y < EPD_13IN3E_HEIGHT; y++) {
+            const UBYTE *Data = Source(Ctx, y, Half, Seg);
+            if (Data == NULL) {
+                EPD_13IN3E_CS_ALL(1);
+                return 1;
+            }
+            EPD_13IN3E_SendData2(Data, EPD_13IN3E_SEG_BYTES);
+            DEV_Delay_ms(1);                            // Small delay for data integrity
+        }
+        EPD_13IN3E_CS_ALL(1);
+    }
+    return 0;
+}
+
+/******************************************************************************
+function :  Row source reading a raw 4bpp picture from the SD card
+info     :  Rows are read EPD_13IN3E_FILE_BLOCK at a time. A vertical flip
+            walks the blocks backwards; a horizontal mirror takes the other
+            half of the file row, reversed and with the nibbles swapped, so
+            neither costs more than a table lookup per byte.
+******************************************************************************/
+#define EPD_13IN3E_FILE_BLOCK   8       // rows per SD read
+
+typedef struct {
+    File *Img;
+    UBYTE Orientation;          // EPD_13IN3E_ORIENT_x
+    UWORD BlockStart;           // first file row in Block
+    UWORD BlockRows;            // rows in Block, 0 if empty
+    UDOUBLE BytesRead;
+    UBYTE Block[EPD_13IN3E_FILE_BLOCK * EPD_13IN3E_ROW_BYTES];
+} EPD_FILE_SOURCE;
+
+static const UBYTE *EPD_13IN3E_FileRow(void *Ctx, UWORD Row, UBYTE Half, UBYTE *Buf)
+{
+    EPD_FILE_SOURCE *Src = (EPD_FILE_SOURCE *)Ctx;
+    UWORD FileRow = (Src->Orientation & EPD_13IN3E_ORIENT_FLIP_V)? EPD_13IN3E_HEIGHT - 1 - Row : Row;
+
+    if (Src->BlockRows == 0 || FileRow < Src->BlockStart || FileRow >= Src->BlockStart + Src->BlockRows) {
+        UWORD Start = FileRow - FileRow % EPD_13IN3E_FILE_BLOCK;
+        UWORD Rows = EPD_13IN3E_HEIGHT - Start;
+        if (Rows > EPD_13IN3E_FILE_BLOCK)
+            Rows = EPD_13IN3E_FILE_BLOCK;
+        size_t Len = (size_t)Rows * EPD_13IN3E_ROW_BYTES;
+        if (!Src->Img->seek((uint32_t)Start * EPD_13IN3E_ROW_BYTES) ||
+            Src->Img->read(Src->Block, Len) != Len) {
+            LOG_E("Incomplete row read from file.\r\n");
+            return NULL;
+        }
+        Src->BytesRead += Len;
+        Src->BlockStart = Start;
+        Src->BlockRows = Rows;
+    }
+
+    const UBYTE *Line = Src->Block + (UDOUBLE)(FileRow - Src->BlockStart) * EPD_13IN3E_ROW_BYTES;
+    if (!(Src->Orientation & EPD_13IN3E_ORIENT_MIRROR_H))
+        return Line + Half * EPD_13IN3E_SEG_BYTES;
+
+    // Screen pixel x shows file pixel WIDTH-1-x
+    const UBYTE *In = Line + (2 - Half) * EPD_13IN3E_SEG_BYTES - 1;
+    for (UWORD i = 0; i < EPD_13IN3E_SEG_BYTES; i++)
+        Buf[i] = EPD_13IN3E_NibbleSwap[*In--];
+    return Buf;
+}
+
+/******************************************************************************
+function :  Row source for a landscape picture stored as tiles (.s6t)
+info     :  The file holds the 1600x1200 picture as it is meant to be seen,
+            in 40x40 pixel tiles (4bpp, row major inside the tile), after a
+            16 byte header. Tiles are ordered by tile column, then tile row.
+
+            A panel row is one picture column, so the tiles covering half
+            a panel row are 15 consecutive tiles of one tile column: one
+            12000 byte read that then serves the next 40 panel rows. Each
+            half reads only its own tiles, so the whole picture is read
+            once per frame instead of twice for a .raw file.
+
+            Rotate 90 matches the converter's np.rot90(k=1): panel pixel
+            (x, y) shows picture pixel (1599 - y, x). Rotate 270 shows
+            picture pixel (y, 1199 - x).
+******************************************************************************/
+#define EPD_13IN3E_TILE         40
+#define EPD_13IN3E_TILE_BYTES   (EPD_13IN3E_TILE * EPD_13IN3E_TILE / 2)
+#define EPD_13IN3E_TILE_ROWS    (EPD_13IN3E_WIDTH / EPD_13IN3E_TILE)           // 30
+#define EPD_13IN3E_TILE_GROUP   (EPD_13IN3E_TILE_ROWS / 2)                     // per half
+#define EPD_13IN3E_TILE_MAGIC   0x31543653                                     // "S6T1"
+
+typedef struct {
+    UDOUBLE Magic;
+    UWORD Width;                // picture width, EPD_13IN3E_HEIGHT
+    UWORD Height;               // picture height, EPD_13IN3E_WIDTH
+    UWORD Tile;                 // EPD_13IN3E_TILE
+    UWORD Rotate;               // 90 or 270
+    UDOUBLE Reserved;
+} EPD_TILE_HEADER;
+
+typedef struct {
+    File *Img;
+    UWORD Rotate;
+    UWORD Column;               // tile column in Cache, 0xFFFF if empty
+    UBYTE Group;                // tile group (half of the picture height) in Cache
+    UDOUBLE BytesRead;
+    UDOUBLE Reads;
+    UBYTE Cache[EPD_13IN3E_TILE_GROUP * EPD_13IN3E_TILE_BYTES];
+} EPD_TILE_SOURCE;
+
+static UBYTE EPD_13IN3E_TileOpen(EPD_TILE_SOURCE *Src, File *Img)
+{
+    EPD_TILE_HEADER Header;
+
+    if (Img->read((UBYTE *)&Header, sizeof(Header)) != sizeof(Header) ||
+        Header.Magic != EPD_13IN3E_TILE_MAGIC ||
+        Header.Width != EPD_13IN3E_HEIGHT || Header.Height != EPD_13IN3E_WIDTH ||
+        Header.Tile != EPD_13IN3E_TILE || (Header.Rotate != 90 && Header.Rotate != 270)) {
+        LOG_E("Not a 1600x1200 tiled picture.\r\n");
+        return 1;
+    }
+    Src->Img = Img;
+    Src->Rotate = Header.Rotate;
+    Src->Column = 0xFFFF;
+    Src->BytesRead = sizeof(Header);
+    Src->Reads = 1;
+    return 0;
+}
+
+static const UBYTE *EPD_13IN3E_TileRow(void *Ctx, UWORD Row, UBYTE Half, UBYTE *Buf)
+{
+    EPD_TILE_SOURCE *Src = (EPD_TILE_SOURCE *)Ctx;
+    UWORD Col = (Src->Rotate == 90)? EPD_13IN3E_HEIGHT - 1 - Row : Row;
+    UWORD TileCol = Col / EPD_13IN3E_TILE;
+    UBYTE Group = (Src->Rotate == 90)? Half : 1 - Half;
+
+    if (TileCol != Src->Column || Group != Src->Group) {
+        UDOUBLE Offset = sizeof(EPD_TILE_HEADER) +
+            ((UDOUBLE)TileCol * EPD_13IN3E_TILE_ROWS + Group * EPD_13IN3E_TILE_GROUP) * EPD_13IN3E_TILE_BYTES;
+        if (!Src->Img->seek(Offset) || Src->Img->read(Src->Cache, sizeof(Src->Cache)) != sizeof(Src->Cache)) {
+            LOG_E("Incomplete tile read from file.\r\n");
+            return NULL;
+        }
+        Src->BytesRead += sizeof(Src->Cache);
+        Src->Reads++;
+        Src->Column = TileCol;
+        Src->Group = Group;
+    }
+
+    // The cached tiles stack into a strip 40 pixels wide and 600 high,
+    // 20 bytes per picture row; take one nibble from every row of it
+    UBYTE Cx = Col % EPD_13IN3E_TILE;
+    const UBYTE *Strip = Src->Cache + Cx / 2;
+    UBYTE Shift = (Cx % 2)? 0 : 4;
+    const UWORD Pitch = EPD_13IN3E_TILE / 2;
+
+    if (Src->Rotate == 90) {
+        for (UWORD k = 0; k < EPD_13IN3E_SEG_BYTES; k++) {
+            const UBYTE *p = Strip + (UDOUBLE)(2 * k) * Pitch;
+            Buf[k] = (((p[0] >> Shift) & 0x0F) << 4) | ((p[Pitch] >> Shift) & 0x0F);
+        }
+    } else {
+        for (UWORD k = 0; k < EPD_13IN3E_SEG_BYTES; k++) {
+            const UBYTE *p = Strip + (UDOUBLE)(EPD_13IN3E_ROW_BYTES - 1 - 2 * k) * Pitch;
+            Buf[k] = (((p[0] >> Shift) & 0x0F) << 4) | ((p[-Pitch] >> Shift) & 0x0F);
+        }
+    }
+    return Buf;
+}
+
 /******************************************************************************
 function :  Enter sleep mode
 parameter:
@@ -521,44 +811,190 @@ void EPD_13IN3E_Sleep(void)
 }
 
 
+#if LOG_TO_SD
+/******************************************************************************
+function :  Append the wake's log to LOG_FILE
+info     :  Called on the way to sleep, whatever the reason. A card that is
+            off is powered and mounted again: after an error, on a low
+            battery wake, or once a good wake has switched it off for the
+            refresh. Those are the wakes whose log matters, and a deployed
+            frame has nothing listening on Serial. What cannot be written
+            stays in the ring for Serial.
+******************************************************************************/
+static void EPD_13IN3E_LogToSD(void)
+{
+  pinMode(SD_power, OUTPUT);
+  if (!sdMounted) {
+    digitalWrite(SD_power, HIGH);
+    delay(100);
+    SPI.begin(SD_SCK, SD_MISO, SD_MOSI, SD_CS);
+    sdMounted = SD.begin(SD_CS, SPI);
+  }
+  if (sdMounted) {
+    File logFile = SD.open(LOG_FILE, FILE_APPEND);
+    if (logFile) {
+      Log_Drain(logFile);
+      logFile.close();
+    }
+    SD.end();
+    sdMounted = false;
+  }
+  digitalWrite(SD_power, LOW);
+}
+#endif
+
 void hilbernate(const UBYTE reason)
 {
   // --- Put the display to sleep and shut down ---
-  Serial.println("Putting display to sleep...");
+  Clock_SetPhase(CLOCK_PHASE_SHUTDOWN);
+  LOG_I("Putting display to sleep...\r\n");
   
   EPD_13IN3E_Sleep();
   DEV_Module_Exit();
    
 
  // --- Enter deep sleep ---
-  Serial.println("Entering deep sleep...");
+  LOG_I("Entering deep sleep...\r\n");
 
 
-Serial.print("Wakeup reason: ");
-Serial.println(esp_sleep_get_wakeup_cause());
+  LOG_I("Wakeup reason: %d\r\n", (int)esp_sleep_get_wakeup_cause());
 
 
-  if (reason != 1) {
-    Serial.println("Sleep after success...");
-    esp_sleep_enable_timer_wakeup(SLEEP_TIME);
+  if (reason == SLEEP_REASON_OK) {
+    LOG_I("Sleep after success...\r\n");
+  } else if (reason == SLEEP_REASON_ERROR) {
+    LOG_E("Sleep after error...\r\n");
   } else {
-    Serial.println("Sleep after error...");
+    LOG_W("Sleep after low battery frame...\r\n");
   }
-  delay(1000);
+  Sched_Arm(reason);
+  Clock_Report();
+
+#if LOG_TO_SD
+  EPD_13IN3E_LogToSD();
+#endif
+  // Whatever is still buffered (everything without LOG_TO_SD or a card)
+  Log_Drain(Serial);
+  Serial.flush();
 //Serial.end();
-  esp_sleep_enable_timer_wakeup(SLEEP_TIME);
   delay(100);
 
   esp_deep_sleep_start();
 }
 
 
+#ifdef CAPTION_SDFONT
+/******************************************************************************
+function :  Draw the caption in the CAPTION_SDFONT font from the SD card
+parameter:
+    Overlay : As for EPD_13IN3E_DrawOverlays()
+    Caption : UTF-8 text
+return   :  0 if drawn, 1 if the font cannot be used
+info     :  One line, centred, black on a white box; a caption wider than
+            the box is cut at its right edge. The font's cache hit rate and
+            SD reads are logged afterwards.
+******************************************************************************/
+static UBYTE EPD_13IN3E_DrawSDCaption(GUI_OVERLAY *Overlay, const String &Caption)
+{
+    static GUI_SDFONT Font;     // about 14 KB
+    UWORD MaxWidth = Overlay->Width - 2 * CAPTION_MARGIN - 2 * CAPTION_PAD;
+    UBYTE Failed = 1;
+
+    if (GUI_SDFont_Open(&Font, CAPTION_SDFONT))
+        return 1;
+    UWORD TextWidth = GUI_SDFont_Measure(&Font, Caption.c_str());
+    if (TextWidth > MaxWidth)
+        TextWidth = MaxWidth;
+    UWORD W = TextWidth + 2 * CAPTION_PAD, H = Font.Height + 2 * CAPTION_PAD;
+    UWORD X = (Overlay->Width - W) / 2, Y = Overlay->Height - CAPTION_MARGIN - H;
+    if (TextWidth > 0 && GUI_Overlay_Begin(Overlay, X, Y, X + W, Y + H) == 0) {
+        Paint_ClearWindows(X, Y, X + W, Y + H, S6_WHITE);
+        // The layer drops whatever runs past the box
+        GUI_SDFont_DrawString(&Font, X + CAPTION_PAD, Y + CAPTION_PAD, Caption.c_str(), S6_BLACK, FONT_BACKGROUND);
+        Failed = 0;
+    }
+    GUI_SDFont_Log(&Font);
+    GUI_SDFont_Close(&Font);
+    return Failed;
+}
+#endif
+
+/******************************************************************************
+function :  Draw the caption and the battery gauge over a picture
+parameter:
+    Overlay : Initialised with the picture's rotation
+    Caption : Text after '|' in order.txt, may be empty
+info     :  The caption is centred near the bottom edge, black on a white
+            box, wrapped to at most CAPTION_LINES lines, fewer if a
+            CAPTION_FONT taller than CAPTION_HEIGHT leaves no room for them
+            and the gauge; characters outside printable ASCII show as '?'.
+            With CAPTION_SDFONT the caption is drawn in that font instead,
+            if it opens (EPD_13IN3E_DrawSDCaption()). The gauge
+            sits in the top right corner once the battery is below GAUGE_MV
+            and shows the charge left above SCHED_RESERVE_MV.
+******************************************************************************/
+static void EPD_13IN3E_DrawOverlays(GUI_OVERLAY *Overlay, const String &Caption)
+{
+    static GUI_TEXT Text;
+    UWORD MaxWidth = Overlay->Width - 2 * CAPTION_MARGIN - 2 * CAPTION_PAD;
+    UDOUBLE Room = Overlay->Size - Overlay->Used;
+    UWORD Lines = CAPTION_LINES;
+#ifdef CAPTION_SDFONT
+    UBYTE Drawn = Caption.length() > 0 && EPD_13IN3E_DrawSDCaption(Overlay, Caption) == 0;
+#else
+    UBYTE Drawn = 0;
+#endif
+
+    Room = (Room > GAUGE_BOX)? Room - GAUGE_BOX : 0;
+    while (Lines > 1 && OVERLAY_BOX((UDOUBLE)Overlay->Width - 2 * CAPTION_MARGIN,
+                                    (UDOUBLE)Lines * CAPTION_FONT.Height + 2 * CAPTION_PAD) > Room)
+        Lines--;
+    if (Lines < CAPTION_LINES)
+        LOG_W("Caption cut to %u lines, OVERLAY_BYTES is too small\r\n", (unsigned)Lines);
+    GUI_Text_Layout(&Text, &CAPTION_FONT, Drawn? "" : Caption.c_str(), MaxWidth, Lines, TEXT_ALIGN_CENTER);
+    if (Text.TextWidth > 0) {
+        UWORD W = Text.TextWidth + 2 * CAPTION_PAD, H = Text.Height + 2 * CAPTION_PAD;
+        UWORD X = (Overlay->Width - W) / 2, Y = Overlay->Height - CAPTION_MARGIN - H;
+        if (GUI_Overlay_Begin(Overlay, X, Y, X + W, Y + H) == 0) {
+            Paint_ClearWindows(X, Y, X + W, Y + H, S6_WHITE);
+            // Lines are centred in MaxWidth, the box only spans the widest.
+            // Black text, the box shows through: GUI_Text_Draw() takes the
+            // foreground first, Paint_DrawString_EN() swaps the two
+            GUI_Text_Draw(&Text, X + CAPTION_PAD - (MaxWidth - Text.TextWidth) / 2, Y + CAPTION_PAD,
+                          S6_BLACK, FONT_BACKGROUND);
+        }
+    }
+
+    UWORD mV = Sched_Battery_mV();
+    if (GAUGE_MV != 0 && mV != 0 && mV < GAUGE_MV) {
+        const UWORD W = GAUGE_W, H = GAUGE_H, Nub = GAUGE_NUB, Line = 3;
+        const UWORD BoxW = W + Nub + 2 * CAPTION_PAD, BoxH = H + 2 * CAPTION_PAD;
+        UWORD Level = (mV <= SCHED_RESERVE_MV)? 0 :
+                      (mV >= GAUGE_FULL_MV)? 100 :
+                      (UDOUBLE)(mV - SCHED_RESERVE_MV) * 100 / (GAUGE_FULL_MV - SCHED_RESERVE_MV);
+        UWORD Fill = (UDOUBLE)(W - 4 * Line) * Level / 100;
+        UWORD X = Overlay->Width - CAPTION_MARGIN - BoxW, Y = CAPTION_MARGIN;
+        if (GUI_Overlay_Begin(Overlay, X, Y, X + BoxW, Y + BoxH) == 0) {
+            Paint_ClearWindows(X, Y, X + BoxW, Y + BoxH, S6_WHITE);
+            X += CAPTION_PAD;
+            Y += CAPTION_PAD;
+            Paint_ClearWindows(X, Y, X + W, Y + Line, S6_BLACK);
+            Paint_ClearWindows(X, Y + H - Line, X + W, Y + H, S6_BLACK);
+            Paint_ClearWindows(X, Y, X + Line, Y + H, S6_BLACK);
+            Paint_ClearWindows(X + W - Line, Y, X + W, Y + H, S6_BLACK);
+            Paint_ClearWindows(X + W, Y + H / 3, X + W + Nub, Y + H - H / 3, S6_BLACK);
+            Paint_ClearWindows(X + 2 * Line, Y + 2 * Line, X + 2 * Line + Fill, Y + H - 2 * Line,
+                               (Level > 50)? S6_GREEN : (Level > 20)? S6_YELLOW : S6_RED);
+        }
+    }
+}
+
 // Utility function: ensures filename begins with '/'
 String ensureLeadingSlash(const String &filename) {
   String name = filename;
   name.trim();
-  // add .raw if it's missing
-  if (!name.endsWith(".raw")) {
+  // add .raw if it's missing (.s6t is a tiled landscape picture)
+  if (!name.endsWith(".raw") && !name.endsWith(".s6t")) {
     name += ".raw";
   }
   // add leading slash if it's missing
@@ -571,25 +1007,34 @@ String ensureLeadingSlash(const String &filename) {
 
 
 void EPD_13IN3E_demo(void) {
-  //hilbernate(0);
+  //hilbernate(SLEEP_REASON_OK);
+  if (Sched_LowBattery()) {
+    LOG_W("Battery below reserve, showing the low battery frame\r\n");
+    Clock_SetPhase(CLOCK_PHASE_TRANSFER);
+    EPD_13IN3E_ShowLowBattery();
+    hilbernate(SLEEP_REASON_LOW_BAT);
+  }
+
+  Clock_SetPhase(CLOCK_PHASE_TRANSFER);
   pinMode(SD_power, OUTPUT); // SD3 / IO10
   digitalWrite(SD_power, HIGH);
   delay(100);
   
-  Serial.println("Initializing SD card");
+  LOG_I("Initializing SD card\r\n");
   // Initialize SD card.
   SPI.begin(SD_SCK, SD_MISO, SD_MOSI, SD_CS);
 
   if (!SD.begin(SD_CS, SPI)) {
-    Serial.println("SD card initialization failed! Check connections and card format.");
-    hilbernate(1);
+    LOG_E("SD card initialization failed! Check connections and card format.\r\n");
+    hilbernate(SLEEP_REASON_ERROR);
   }
-  Serial.println("SD card initialized successfully on HSPI!");
+  sdMounted = true;
+  LOG_I("SD card initialized successfully on HSPI!\r\n");
 
   File orderFile = SD.open(ORDER_FILE, FILE_READ);
   if (!orderFile) {
-    Serial.print("Failed to open order file '");
-    hilbernate(1);
+    LOG_E("Failed to open order file '%s'\r\n", ORDER_FILE);
+    hilbernate(SLEEP_REASON_ERROR);
   }
   String orderContent = "";
   while (orderFile.available()) {
@@ -605,22 +1050,20 @@ void EPD_13IN3E_demo(void) {
       line = orderContent.substring(startIdx);
       line.trim();
       if (line.length() > 0) {
-        pictureList[pictureCount++] = ensureLeadingSlash(line);
+        pictureList[pictureCount++] = line;
       }
       break;
     }
     line = orderContent.substring(startIdx, newLineIdx);
     line.trim();
     if (line.length() > 0) {
-      pictureList[pictureCount++] = ensureLeadingSlash(line);
+      pictureList[pictureCount++] = line;
     }
     startIdx = newLineIdx + 1;
     if (pictureCount >= maxPictures)
       break;
   }
-  Serial.print("Found ");
-  Serial.print(pictureCount);
-  Serial.println(" picture(s) in order file.");
+  LOG_I("Found %d picture(s) in order file.\r\n", pictureCount);
 
   // --- Read the current picture index from the index file ---
   int index = 0;
@@ -633,14 +1076,20 @@ void EPD_13IN3E_demo(void) {
     }
     indexFile.close();
   }
-  Serial.print("Current picture index (from SD): ");
-  Serial.println(index);
+  LOG_I("Current picture index (from SD): %d\r\n", index);
 
   // Wrap the index within range.
   index = index % pictureCount;
   String fileName = pictureList[index];
-  Serial.print("Displaying picture: ");
-  Serial.println(fileName);
+  String caption = "";
+  int captionIdx = fileName.indexOf('|');
+  if (captionIdx != -1) {
+    caption = fileName.substring(captionIdx + 1);
+    caption.trim();
+    fileName = fileName.substring(0, captionIdx);
+  }
+  fileName = ensureLeadingSlash(fileName);
+  LOG_I("Displaying picture: %s\r\n", fileName.c_str());
 
 
 
@@ -649,75 +1098,64 @@ void EPD_13IN3E_demo(void) {
   // This file should contain 600 bytes per row (i.e. 4bpp for 1200 pixels per row)
   File file = SD.open(fileName, FILE_READ);
   if (!file) {
-    Serial.print("Failed to open file "); Serial.print(fileName);
-    Serial.println();
-    hilbernate(1);
-  }
-  Serial.println("Opened for display update.");
-  const size_t ROW_SIZE = 600;
-  const size_t SEG_SIZE = 300;
-  // Allocate buffers for one full row and for each segment.
-  static uint8_t rowBuffer[ROW_SIZE];
-  //DEV_Digital_Write(SD_CS, 1); 
-  
-  DEV_Digital_Write(EPD_CS_M_PIN, 0);
-  EPD_13IN3E_SendCommand(0x10);
-  //DEV_Delay_ms(1); 
-
-  // Process each row of the display.
-  uint32_t rowCount = 0;
-  
-  while (file.available() && (rowCount < EPD_13IN3E_HEIGHT)) {
-     int bytesRead = file.read(rowBuffer, ROW_SIZE);
-    if (bytesRead != ROW_SIZE) {
-      Serial.println("Error: Incomplete row read from file.");
-      hilbernate(1);
-    }
-   // DEV_Digital_Write(SD_CS, 1);
-    EPD_13IN3E_SendData2(rowBuffer, SEG_SIZE); // Send 300 bytes
-    DEV_Delay_ms(1);                            // Small delay for data integrity
-    rowCount++;
+    LOG_E("Failed to open file %s\r\n", fileName.c_str());
+    hilbernate(SLEEP_REASON_ERROR);
   }
-  EPD_13IN3E_CS_ALL(1);
-  DEV_Digital_Write(EPD_CS_S_PIN, 0);
-  EPD_13IN3E_SendCommand(0x10);
-  rowCount = 0;
-  file.seek(0);
-  while (file.available() && (rowCount < EPD_13IN3E_HEIGHT)) {
-    // Read one row (600 bytes) from the file.
-    int bytesRead = file.read(rowBuffer, ROW_SIZE);
-    if (bytesRead != ROW_SIZE) {
-      Serial.println("Error: Incomplete row read from file.");
-      hilbernate(1);
+  LOG_I("Opened for display update.\r\n");
+  uint32_t sendStart = millis();
+  UDOUBLE bytesRead;
+  UBYTE failed;
+  static GUI_OVERLAY overlay;
+  static UBYTE overlayArena[OVERLAY_BYTES];
+  if (fileName.endsWith(".s6t")) {
+    static EPD_TILE_SOURCE tiles;
+    failed = EPD_13IN3E_TileOpen(&tiles, &file);
+    if (!failed) {
+      // Paint's rotation by 270 maps like the tiles' rotation by 90
+      GUI_Overlay_Init(&overlay, overlayArena, sizeof(overlayArena), (tiles.Rotate + 180) % 360, MIRROR_NONE);
+      EPD_13IN3E_DrawOverlays(&overlay, caption);
+      failed = GUI_Overlay_Send(&overlay, EPD_13IN3E_TileRow, &tiles);
     }
-    EPD_13IN3E_SendData2(rowBuffer + SEG_SIZE, SEG_SIZE); // Send 300 bytes
-    DEV_Delay_ms(1);                            // Small delay for data integrity
-    rowCount++;
+    bytesRead = tiles.BytesRead;
+    LOG_I("Tiled picture rotated by %u, %lu tile reads\r\n", (unsigned)tiles.Rotate, (unsigned long)tiles.Reads);
+  } else {
+    static EPD_FILE_SOURCE source;
+    source.Img = &file;
+    source.Orientation = EPD_13IN3E_ORIENTATION;
+    source.BlockRows = 0;
+    source.BytesRead = 0;
+    GUI_Overlay_Init(&overlay, overlayArena, sizeof(overlayArena), ROTATE_0, EPD_13IN3E_ORIENTATION);
+    EPD_13IN3E_DrawOverlays(&overlay, caption);
+    failed = GUI_Overlay_Send(&overlay, EPD_13IN3E_FileRow, &source);
+    bytesRead = source.BytesRead;
   }
   file.close();
-  Serial.print("Finished sending ");
-  Serial.print(rowCount);
-  Serial.println(" rows from file.");
+  if (failed)
+    hilbernate(SLEEP_REASON_ERROR);
+  // Read amplification: bytes read from the SD card per byte sent to the panel
+  LOG_I("Finished sending %u rows in %lu ms, %lu bytes read (x%u.%02u)\r\n",
+        (unsigned)EPD_13IN3E_HEIGHT, (unsigned long)(millis() - sendStart), (unsigned long)bytesRead,
+        (unsigned)(bytesRead / (EPD_13IN3E_ROW_BYTES * EPD_13IN3E_HEIGHT)),
+        (unsigned)(bytesRead * 100ULL / (EPD_13IN3E_ROW_BYTES * EPD_13IN3E_HEIGHT) % 100));
 
-  EPD_13IN3E_CS_ALL(1);
   // --- Update the index ---
   index = (index + 1) % pictureCount;
   File indexFileWrite = SD.open(INDEX_FILE, FILE_WRITE);
   indexFileWrite.print(index);
   indexFileWrite.close();
-  Serial.print("Updated index stored on SD: ");
-  Serial.println(index);
+  LOG_I("Updated index stored on SD: %d\r\n", index);
 
   // Finalize the update by refreshing the display.
   SPI.endTransaction();
   SD.end();
+  sdMounted = false;
   delay(100);
   digitalWrite(SD_power, LOW);
   delay(100);
   EPD_13IN3E_TurnOnDisplay();
   
   // --- Put the display to sleep and shut down ---
-  hilbernate(0);
+  hilbernate(SLEEP_REASON_OK);
 
 }
 
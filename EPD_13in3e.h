@@ -35,6 +35,20 @@
 // M/S 控制区域 600*1600
 #define EPD_13IN3E_WIDTH        1200
 #define EPD_13IN3E_HEIGHT       1600    
+#define EPD_13IN3E_ROW_BYTES    (EPD_13IN3E_WIDTH / 2)      // 4bpp
+#define EPD_13IN3E_SEG_BYTES    (EPD_13IN3E_ROW_BYTES / 2)  // per controller
+
+/**
+ * Orientation applied while streaming a picture from the SD card, for a
+ * frame mounted mirrored or upside down. The file stays as converted.
+**/
+#define EPD_13IN3E_ORIENT_NORMAL        0x00
+#define EPD_13IN3E_ORIENT_MIRROR_H      0x01
+#define EPD_13IN3E_ORIENT_FLIP_V        0x02
+#define EPD_13IN3E_ORIENT_ROTATE_180    (EPD_13IN3E_ORIENT_MIRROR_H | EPD_13IN3E_ORIENT_FLIP_V)
+#ifndef EPD_13IN3E_ORIENTATION
+#define EPD_13IN3E_ORIENTATION          EPD_13IN3E_ORIENT_NORMAL
+#endif
 
 
 #define EPD_13IN3E_BLACK        0x0
@@ -65,6 +79,14 @@
 #define PWS             0xE3
 #define CMD66           0xF0
 
+/**
+ * Row source for EPD_13IN3E_SendRows()
+ * Returns the EPD_13IN3E_SEG_BYTES bytes of one half row (Half 0: master,
+ * left; 1: slave, right), either in Buf or in its own storage, or NULL on
+ * error.
+**/
+typedef const UBYTE *(*EPD_ROW_SOURCE)(void *Ctx, UWORD Row, UBYTE Half, UBYTE *Buf);
+
 
 
 
@@ -74,6 +96,9 @@ void EPD_13IN3E_Display(const UBYTE *Image);
 void EPD_13IN3E_Display2(const UBYTE *Image);
 void EPD_13IN3E_DisplayPart(const UBYTE *Image, UWORD xstart, UWORD ystart, UWORD image_width, UWORD image_heigh);
 void EPD_13IN3E_Show6Block(void);
+UBYTE EPD_13IN3E_SendRows(EPD_ROW_SOURCE Source, void *Ctx);
+void EPD_13IN3E_TurnOnDisplay(void);
+void EPD_13IN3E_ShowLowBattery(void);
 void EPD_13IN3E_Sleep(void);
 void EPD_13IN3E_demo(void); 
 void hilbernate(const UBYTE reason);
@@ -0,0 +1,209 @@
+/*****************************************************************************
+* | File      	:   GUI_Band.cpp
+* | Author      :   lernerc606
+* | Function    :   Draw with GUI_Paint straight to the panel, one band at a time
+* | Info        :
+*   Bands are half a row wide (600 pixels) because each controller takes
+*   its own DTM pass, the master every left half first, then the slave
+*   every right half. A band is rendered the first time one of its rows
+*   is asked for and then served row by row.
+*
+*   GUI_Band_Benchmark() renders a calendar page from a display list
+*   twice, replaying every call for every band and replaying only the
+*   calls that meet each band, and logs both times.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+*
+******************************************************************************/
+#include "GUI_Band.h"
+#include "GUI_Paint.h"
+#include "GUI_DList.h"
+#include "EPD_13in3e.h"
+#include "Clock_Profile.h"
+#include "Debug.h"
+
+typedef struct {
+    GUI_BAND_DRAW Draw;
+    void *Ctx;
+    UBYTE *Buffer;
+    UWORD Rows;                 // rows per band
+    UWORD Background;
+    UWORD Start;                // first panel row in Buffer
+    UBYTE Half;                 // half in Buffer, 0xFF if none yet
+    UWORD Renders;
+    UDOUBLE Render_us;
+} GUI_BAND;
+
+/******************************************************************************
+function :  Set a band up before its first row, and Paint on its buffer
+******************************************************************************/
+static void GUI_Band_Init(GUI_BAND *Band, GUI_BAND_DRAW Draw, void *Ctx, UWORD Rotate, UWORD Background,
+                          UBYTE *Buffer, UWORD Rows)
+{
+    Band->Draw = Draw;
+    Band->Ctx = Ctx;
+    Band->Buffer = Buffer;
+    Band->Rows = Rows;
+    Band->Background = Background;
+    Band->Start = 0;
+    Band->Half = 0xFF;
+    Band->Renders = 0;
+    Band->Render_us = 0;
+
+    Paint_NewImage(Buffer, EPD_13IN3E_WIDTH, EPD_13IN3E_HEIGHT, Rotate, WHITE);
+    Paint_SetScale(6);
+}
+
+/******************************************************************************
+function :  Row source rendering the band that holds Row
+******************************************************************************/
+static const UBYTE *GUI_Band_Row(void *Ctx, UWORD Row, UBYTE Half, UBYTE *)
+{
+    GUI_BAND *Band = (GUI_BAND *)Ctx;
+
+    if (Half != Band->Half || Row < Band->Start || Row >= Band->Start + Band->Rows) {
+        UDOUBLE t0 = micros();
+        UWORD Rows = Band->Rows;
+
+        Band->Half = Half;
+        Band->Start = Row - Row % Band->Rows;
+        if (Rows > EPD_13IN3E_HEIGHT - Band->Start)
+            Rows = EPD_13IN3E_HEIGHT - Band->Start;
+        Paint_SetBand(Half * (EPD_13IN3E_WIDTH / 2), Band->Start, EPD_13IN3E_WIDTH / 2, Rows);
+        Paint_Clear(Band->Background);
+        Band->Draw(Band->Ctx);
+
+        Band->Renders++;
+        Band->Render_us += micros() - t0;
+    }
+    return Band->Buffer + (UDOUBLE)(Row - Band->Start) * EPD_13IN3E_SEG_BYTES;
+}
+
+/******************************************************************************
+function :  Draw a frame band by band and show it
+parameter:
+    Draw       : Draws the whole frame, called once per band
+    Ctx        : Passed through to Draw
+    Rotate     : Paint rotation, ROTATE_90 or ROTATE_270 for landscape
+    Background : Color every band is cleared to (S6_x or WHITE)
+    Buffer     : Rows * EPD_13IN3E_SEG_BYTES bytes
+    Rows       : Rows per band, e.g. GUI_BAND_ROWS
+return   :  0 on success, 1 on error
+info     :  Paint is set up here with scale 6; Draw only calls Paint_Draw*().
+            The panel must be initialised; it is refreshed but not put to
+            sleep.
+******************************************************************************/
+UBYTE GUI_Band_Show(GUI_BAND_DRAW Draw, void *Ctx, UWORD Rotate, UWORD Background, UBYTE *Buffer, UWORD Rows)
+{
+    GUI_BAND Band;
+    UDOUBLE t0 = millis();
+
+    if (Draw == NULL || Buffer == NULL || Rows == 0)
+        return 1;
+
+    GUI_Band_Init(&Band, Draw, Ctx, Rotate, Background, Buffer, Rows);
+
+    UBYTE Phase = Clock_SetPhase(CLOCK_PHASE_TRANSFER);
+    UBYTE Failed = EPD_13IN3E_SendRows(GUI_Band_Row, &Band);
+    Clock_SetPhase(Phase);
+    if (Failed)
+        return 1;
+
+    LOG_I("Band: %u rows (%lu bytes), %u bands rendered in %lu ms, sent in %lu ms\r\n",
+          (unsigned)Rows, (unsigned long)Rows * EPD_13IN3E_SEG_BYTES, (unsigned)Band.Renders,
+          (unsigned long)(Band.Render_us / 1000), (unsigned long)(millis() - t0));
+
+    EPD_13IN3E_TurnOnDisplay();
+    return 0;
+}
+
+/******************************************************************************
+function :  Record a month calendar: title, weekday row, a 7 x 6 grid of
+            numbered cells, and icons, markers and text on some days
+******************************************************************************/
+static const unsigned char GUI_Band_SunIcon[] = {   // 16 x 16, 1bpp
+    0x00, 0x00, 0x01, 0x80, 0x21, 0x84, 0x10, 0x08, 0x03, 0xC0, 0x07, 0xE0, 0x0F, 0xF0, 0x6F, 0xF6,
+    0x6F, 0xF6, 0x0F, 0xF0, 0x07, 0xE0, 0x03, 0xC0, 0x10, 0x08, 0x21, 0x84, 0x01, 0x80, 0x00, 0x00,
+};
+
+static void GUI_Band_CalendarScene(GUI_DLIST *List)
+{
+    static const char *Weekday[7] = { "Mon", "Tue", "Wed", "Thu", "Fri", "Sat", "Sun" };
+    const UWORD Left = 30, Top = 120, CellW = 220, CellH = 175;
+    const UWORD FirstDay = 3, Days = 31;   // month starting on a Thursday
+
+    GUI_DList_ClearWindows(List, 0, 0, 1600, 90, S6_BLUE);
+    GUI_DList_String_EN(List, 680, 33, "October 2026", &Font24, S6_BLUE, S6_WHITE);
+    for (UBYTE d = 0; d < 7; d++)
+        GUI_DList_String_EN(List, Left + d * CellW + 8, Top - 26, Weekday[d], &Font20, WHITE,
+                            (d >= 5)? S6_RED : S6_BLACK);
+
+    for (UBYTE Cell = 0; Cell < 42; Cell++) {
+        UWORD X = Left + (Cell % 7) * CellW;
+        UWORD Y = Top + (Cell / 7) * CellH;
+        int Day = Cell - FirstDay + 1;
+
+        GUI_DList_Rectangle(List, X, Y, X + CellW, Y + CellH, S6_BLACK, DOT_PIXEL_2X2, DRAW_FILL_EMPTY);
+        if (Day < 1 || Day > Days)
+            continue;
+        GUI_DList_Num(List, X + 10, Y + 10, Day, &Font24, (Cell % 7 >= 5)? S6_RED : S6_BLACK, WHITE);
+        if (Day % 4 == 1)
+            GUI_DList_BitMap_Paste(List, GUI_Band_SunIcon, X + CellW - 30, Y + 12, 16, 16, 1);
+        if (Day % 5 == 2) {
+            GUI_DList_Circle(List, X + 20, Y + 70, 8, S6_GREEN, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+            GUI_DList_String_EN(List, X + 36, Y + 62, "Meeting", &Font16, WHITE, S6_BLACK);
+        }
+        if (Day % 7 == 3)
+            GUI_DList_Line(List, X + 12, Y + CellH - 20, X + CellW - 12, Y + CellH - 20,
+                           S6_YELLOW, DOT_PIXEL_4X4, LINE_STYLE_SOLID);
+    }
+}
+
+// Render every band of both halves and fold the result into a checksum
+static UDOUBLE GUI_Band_RenderAll(GUI_BAND *Band, UDOUBLE *Sum)
+{
+    UDOUBLE t0 = micros();
+    *Sum = 0;
+    for (UBYTE Half = 0; Half < 2; Half++) {
+        for (UWORD Row = 0; Row < EPD_13IN3E_HEIGHT; Row++) {
+            const UBYTE *Data = GUI_Band_Row(Band, Row, Half, NULL);
+            for (UWORD i = 0; i < EPD_13IN3E_SEG_BYTES; i++)
+                *Sum = *Sum * 31 + Data[i];
+        }
+    }
+    return micros() - t0;
+}
+
+/******************************************************************************
+function :  Compare full and culled display list replay on a calendar page
+parameter:
+    Buffer    : Rows * EPD_13IN3E_SEG_BYTES bytes
+    Rows      : Rows per band
+    Arena     : Display list storage, 4 byte aligned, 8 KB is plenty
+    ArenaSize : Bytes in Arena
+info     :  Only renders, nothing is sent to the panel.
+******************************************************************************/
+void GUI_Band_Benchmark(UBYTE *Buffer, UWORD Rows, UBYTE *Arena, UDOUBLE ArenaSize)
+{
+    GUI_DLIST List;
+    GUI_BAND Band;
+    UDOUBLE SumAll, SumCulled, AllUs, CulledUs;
+
+    GUI_DList_Init(&List, Arena, ArenaSize);
+    GUI_Band_CalendarScene(&List);
+
+    GUI_Band_Init(&Band, GUI_DList_DrawAll, &List, ROTATE_90, WHITE, Buffer, Rows);
+    AllUs = GUI_Band_RenderAll(&Band, &SumAll);
+
+    GUI_Band_Init(&Band, GUI_DList_Draw, &List, ROTATE_90, WHITE, Buffer, Rows);
+    CulledUs = GUI_Band_RenderAll(&Band, &SumCulled);
+
+    LOG_I("Band benchmark: %u calls in %lu bytes, %u rows x %u bands\r\n",
+          (unsigned)List.Count, (unsigned long)List.Used, (unsigned)Rows,
+          (unsigned)(2 * ((EPD_13IN3E_HEIGHT + Rows - 1) / Rows)));
+    LOG_I("  replay all %lu ms, culled %lu ms (%lu of %lu calls drawn), output %s\r\n",
+          (unsigned long)(AllUs / 1000), (unsigned long)(CulledUs / 1000),
+          (unsigned long)List.Drawn, (unsigned long)List.Visited,
+          (SumAll == SumCulled)? "identical" : "DIFFERENT");
+}
@@ -0,0 +1,40 @@
+/*****************************************************************************
+* | File      	:   GUI_Band.h
+* | Author      :   lernerc606
+* | Function    :   Draw with GUI_Paint straight to the panel, one band at a time
+* | Info        :
+*   A full 1200x1600 Spectra 6 frame is 960000 bytes, more than the
+*   ESP32-C6 has. GUI_Band_Show() instead renders the frame into a small
+*   buffer holding GUI_BAND_ROWS rows of one controller's half, streams
+*   those rows and renders the next band. The draw callback is called once
+*   per band and simply draws the whole frame; GUI_Paint clips everything
+*   outside the current band. Drawing recorded in a display list
+*   (GUI_DList.h) and replayed with GUI_DList_Draw() is only rasterized
+*   for the bands it touches.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+*
+******************************************************************************/
+#ifndef _GUI_BAND_H_
+#define _GUI_BAND_H_
+
+#include "DEV_Config.h"
+
+/**
+ * Rows per band. The buffer needs GUI_BAND_ROWS * EPD_13IN3E_SEG_BYTES
+ * bytes; fewer rows save RAM but call the draw callback more often
+ * (2 * 1600 / GUI_BAND_ROWS times per frame).
+**/
+#define GUI_BAND_ROWS       40
+
+/**
+ * Draws the whole frame with Paint_x() calls. Must draw the same thing
+ * every time it is called.
+**/
+typedef void (*GUI_BAND_DRAW)(void *Ctx);
+
+UBYTE GUI_Band_Show(GUI_BAND_DRAW Draw, void *Ctx, UWORD Rotate, UWORD Background, UBYTE *Buffer, UWORD Rows);
+void GUI_Band_Benchmark(UBYTE *Buffer, UWORD Rows, UBYTE *Arena, UDOUBLE ArenaSize);
+
+#endif
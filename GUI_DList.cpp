@@ -0,0 +1,457 @@
+/*****************************************************************************
+* | File      	:   GUI_DList.cpp
+* | Author      :   lernerc606
+* | Function    :   Record Paint_Draw*() calls and replay them band by band
+* | Info        :
+*   Each call is one record: a 12 byte header with the opcode and the
+*   bounding box, the font or bitmap pointer if the call has one, the
+*   UWORD arguments and the zero terminated text, padded to 4 bytes. On
+*   the ESP32 a rectangle or a number takes 28 bytes.
+*
+*   Bounding boxes are in image coordinates and depend on the image size
+*   (strings wrap at the right edge), so they are worked out on the first
+*   replay, not while recording. They may be larger than what is drawn,
+*   never smaller; the band still clips every pixel.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+*
+******************************************************************************/
+#include "GUI_DList.h"
+#include <string.h>
+
+#define GUI_DLIST_POINT         0
+#define GUI_DLIST_LINE          1
+#define GUI_DLIST_RECTANGLE     2
+#define GUI_DLIST_CIRCLE        3
+#define GUI_DLIST_WINDOW        4
+#define GUI_DLIST_CHAR          5
+#define GUI_DLIST_STRING_EN     6
+#define GUI_DLIST_STRING_CN     7
+#define GUI_DLIST_NUM           8
+#define GUI_DLIST_BITMAP        9
+#define GUI_DLIST_IMAGE4        10
+#define GUI_DLIST_POLYGON       11
+#define GUI_DLIST_TEXT          12
+#define GUI_DLIST_PTR           0x80    // opcode flag: a pointer follows the header
+
+#define GUI_DLIST_MAX_ARGS      8
+
+typedef struct {
+    UBYTE Op;
+    UBYTE Argc;                 // UWORD arguments
+    UWORD Size;                 // whole record, a multiple of 4
+    UWORD Xstart;               // bounding box, end exclusive
+    UWORD Ystart;
+    UWORD Xend;
+    UWORD Yend;
+} GUI_DLIST_RECORD;
+
+typedef struct {
+    const void *Ptr;
+    UWORD Arg[GUI_DLIST_MAX_ARGS];
+    const char *Text;
+} GUI_DLIST_CALL;
+
+/******************************************************************************
+function:	Use Arena for a new, empty display list
+parameter:
+    List  : List to set up
+    Arena : Record storage, 4 byte aligned
+    Size  : Bytes in Arena
+******************************************************************************/
+void GUI_DList_Init(GUI_DLIST *List, UBYTE *Arena, UDOUBLE Size)
+{
+    List->Arena = Arena;
+    List->Size = Size;
+    List->Used = 0;
+    List->Count = 0;
+    List->Overflow = 0;
+    List->BoundWidth = 0;
+    List->BoundHeight = 0;
+    List->Visited = 0;
+    List->Drawn = 0;
+}
+
+// Append a record, 1 if it does not fit
+static UBYTE GUI_DList_Add(GUI_DLIST *List, UBYTE Op, const void *Ptr,
+                           const UWORD *Arg, UBYTE Argc, const char *Text)
+{
+    UDOUBLE TextLen = (Text != NULL)? strlen(Text) + 1 : 0;
+    UDOUBLE Size = sizeof(GUI_DLIST_RECORD) + ((Ptr != NULL)? sizeof(Ptr) : 0) + Argc * sizeof(UWORD) + TextLen;
+    Size = (Size + 3) & ~3UL;
+
+    if (Size > 0xFFFF || List->Used + Size > List->Size) {
+        if (!List->Overflow)
+            LOG_W("Display list full (%lu bytes), calls dropped\r\n", (unsigned long)List->Size);
+        List->Overflow = 1;
+        return 1;
+    }
+
+    UBYTE *p = List->Arena + List->Used;
+    GUI_DLIST_RECORD *Rec = (GUI_DLIST_RECORD *)p;
+    Rec->Op = Op | ((Ptr != NULL)? GUI_DLIST_PTR : 0);
+    Rec->Argc = Argc;
+    Rec->Size = Size;
+    p += sizeof(GUI_DLIST_RECORD);
+    if (Ptr != NULL) {
+        memcpy(p, &Ptr, sizeof(Ptr));
+        p += sizeof(Ptr);
+    }
+    memcpy(p, Arg, Argc * sizeof(UWORD));
+    p += Argc * sizeof(UWORD);
+    if (TextLen)
+        memcpy(p, Text, TextLen);
+
+    List->Used += Size;
+    List->Count++;
+    List->BoundWidth = 0;
+    return 0;
+}
+
+static void GUI_DList_Unpack(const GUI_DLIST_RECORD *Rec, GUI_DLIST_CALL *Call)
+{
+    const UBYTE *p = (const UBYTE *)(Rec + 1);
+    Call->Ptr = NULL;
+    if (Rec->Op & GUI_DLIST_PTR) {
+        memcpy(&Call->Ptr, p, sizeof(Call->Ptr));
+        p += sizeof(Call->Ptr);
+    }
+    memcpy(Call->Arg, p, Rec->Argc * sizeof(UWORD));
+    Call->Text = (const char *)(p + Rec->Argc * sizeof(UWORD));
+}
+
+UBYTE GUI_DList_Point(GUI_DLIST *List, UWORD Xpoint, UWORD Ypoint, UWORD Color,
+                      DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_Style)
+{
+    UWORD Arg[] = { Xpoint, Ypoint, Color, (UWORD)Dot_Pixel, (UWORD)Dot_Style };
+    return GUI_DList_Add(List, GUI_DLIST_POINT, NULL, Arg, 5, NULL);
+}
+
+UBYTE GUI_DList_Line(GUI_DLIST *List, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+                     UWORD Color, DOT_PIXEL Line_width, LINE_STYLE Line_Style)
+{
+    UWORD Arg[] = { Xstart, Ystart, Xend, Yend, Color, (UWORD)Line_width, (UWORD)Line_Style };
+    return GUI_DList_Add(List, GUI_DLIST_LINE, NULL, Arg, 7, NULL);
+}
+
+UBYTE GUI_DList_Rectangle(GUI_DLIST *List, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+                          UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+{
+    UWORD Arg[] = { Xstart, Ystart, Xend, Yend, Color, (UWORD)Line_width, (UWORD)Draw_Fill };
+    return GUI_DList_Add(List, GUI_DLIST_RECTANGLE, NULL, Arg, 7, NULL);
+}
+
+UBYTE GUI_DList_Circle(GUI_DLIST *List, UWORD X_Center, UWORD Y_Center, UWORD Radius,
+                       UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+{
+    UWORD Arg[] = { X_Center, Y_Center, Radius, Color, (UWORD)Line_width, (UWORD)Draw_Fill };
+    return GUI_DList_Add(List, GUI_DLIST_CIRCLE, NULL, Arg, 6, NULL);
+}
+
+UBYTE GUI_DList_Polygon(GUI_DLIST *List, const PAINT_POINT *Points, UWORD Count, UWORD Color, FILL_RULE Fill_Rule)
+{
+    UWORD Arg[] = { Count, Color, (UWORD)Fill_Rule };
+    return GUI_DList_Add(List, GUI_DLIST_POLYGON, Points, Arg, 3, NULL);
+}
+
+UBYTE GUI_DList_ClearWindows(GUI_DLIST *List, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
+{
+    UWORD Arg[] = { Xstart, Ystart, Xend, Yend, Color };
+    return GUI_DList_Add(List, GUI_DLIST_WINDOW, NULL, Arg, 5, NULL);
+}
+
+UBYTE GUI_DList_Char(GUI_DLIST *List, UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
+                     sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    UWORD Arg[] = { Xpoint, Ypoint, (UBYTE)Acsii_Char, Color_Foreground, Color_Background };
+    return GUI_DList_Add(List, GUI_DLIST_CHAR, Font, Arg, 5, NULL);
+}
+
+UBYTE GUI_DList_String_EN(GUI_DLIST *List, UWORD Xstart, UWORD Ystart, const char * pString,
+                          sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    UWORD Arg[] = { Xstart, Ystart, Color_Foreground, Color_Background };
+    return GUI_DList_Add(List, GUI_DLIST_STRING_EN, Font, Arg, 4, pString);
+}
+
+UBYTE GUI_DList_String_CN(GUI_DLIST *List, UWORD Xstart, UWORD Ystart, const char * pString,
+                          cFONT* font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    UWORD Arg[] = { Xstart, Ystart, Color_Foreground, Color_Background };
+    return GUI_DList_Add(List, GUI_DLIST_STRING_CN, font, Arg, 4, pString);
+}
+
+// A GUI_Text layout, drawn with GUI_Text_Draw()
+UBYTE GUI_DList_Text(GUI_DLIST *List, const GUI_TEXT *Text, UWORD Xstart, UWORD Ystart,
+                     UWORD Color_Foreground, UWORD Color_Background)
+{
+    UWORD Arg[] = { Xstart, Ystart, Color_Foreground, Color_Background };
+    return GUI_DList_Add(List, GUI_DLIST_TEXT, Text, Arg, 4, NULL);
+}
+
+UBYTE GUI_DList_Num(GUI_DLIST *List, UWORD Xpoint, UWORD Ypoint, int32_t Nummber,
+                    sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    UWORD Arg[] = { Xpoint, Ypoint, (UWORD)((uint32_t)Nummber >> 16), (UWORD)Nummber,
+                    Color_Foreground, Color_Background };
+    return GUI_DList_Add(List, GUI_DLIST_NUM, Font, Arg, 6, NULL);
+}
+
+UBYTE GUI_DList_BitMap_Paste(GUI_DLIST *List, const unsigned char* image_buffer, UWORD xStart, UWORD yStart,
+                             UWORD imageWidth, UWORD imageHeight, UBYTE flipColor)
+{
+    UWORD Arg[] = { xStart, yStart, imageWidth, imageHeight, flipColor };
+    return GUI_DList_Add(List, GUI_DLIST_BITMAP, image_buffer, Arg, 5, NULL);
+}
+
+UBYTE GUI_DList_Image4(GUI_DLIST *List, const unsigned char *image_buffer, UWORD xStart, UWORD yStart,
+                       UWORD W_Image, UWORD H_Image)
+{
+    UWORD Arg[] = { xStart, yStart, W_Image, H_Image, 0xFFFF };
+    return GUI_DList_Add(List, GUI_DLIST_IMAGE4, image_buffer, Arg, 5, NULL);
+}
+
+UBYTE GUI_DList_Sprite4(GUI_DLIST *List, const unsigned char *image_buffer, UWORD xStart, UWORD yStart,
+                        UWORD W_Image, UWORD H_Image, UWORD Transparent)
+{
+    UWORD Arg[] = { xStart, yStart, W_Image, H_Image, Transparent };
+    return GUI_DList_Add(List, GUI_DLIST_IMAGE4, image_buffer, Arg, 5, NULL);
+}
+
+// Width of a string drawn with Paint_DrawString_EN(), which wraps it at
+// the right edge and back to the top at the bottom: then assume it can
+// cover everything right of and below its start
+static void GUI_DList_TextBox(int X, int Y, UDOUBLE Chars, sFONT *Font, int *Xend, int *Yend)
+{
+    if (X + Chars * Font->Width <= Paint.Width && Y + Font->Height <= Paint.Height) {
+        *Xend = X + Chars * Font->Width;
+        *Yend = Y + Font->Height;
+    } else {
+        *Xend = Paint.Width;
+        *Yend = Paint.Height;
+    }
+}
+
+// Bounding box of a record for the current image size
+static void GUI_DList_Bound(GUI_DLIST_RECORD *Rec)
+{
+    GUI_DLIST_CALL Call;
+    const UWORD *A = Call.Arg;
+    int X0 = 0, Y0 = 0, X1 = 0, Y1 = 0, d;
+
+    GUI_DList_Unpack(Rec, &Call);
+    switch (Rec->Op & ~GUI_DLIST_PTR) {
+    case GUI_DLIST_POINT:
+        d = A[3];
+        X0 = A[0] - d; X1 = A[0] + d;
+        Y0 = A[1] - d; Y1 = A[1] + d;
+        break;
+    case GUI_DLIST_LINE:
+    case GUI_DLIST_RECTANGLE:
+        d = A[5];
+        X0 = ((A[0] < A[2])? A[0] : A[2]) - d;
+        X1 = ((A[0] < A[2])? A[2] : A[0]) + d;
+        Y0 = ((A[1] < A[3])? A[1] : A[3]) - d;
+        Y1 = ((A[1] < A[3])? A[3] : A[1]) + d;
+        break;
+    case GUI_DLIST_CIRCLE:
+        d = A[2] + ((A[5] == DRAW_FILL_FULL)? (int)DOT_PIXEL_DFT : A[4]);
+        X0 = A[0] - d; X1 = A[0] + d;
+        Y0 = A[1] - d; Y1 = A[1] + d;
+        break;
+    case GUI_DLIST_WINDOW:
+        X0 = A[0]; X1 = A[2];
+        Y0 = A[1]; Y1 = A[3];
+        break;
+    case GUI_DLIST_CHAR:
+        X0 = A[0]; X1 = A[0] + ((const sFONT *)Call.Ptr)->Width;
+        Y0 = A[1]; Y1 = A[1] + ((const sFONT *)Call.Ptr)->Height;
+        break;
+    case GUI_DLIST_STRING_EN:
+        X0 = A[0]; Y0 = A[1];
+        GUI_DList_TextBox(X0, Y0, strlen(Call.Text), (sFONT *)Call.Ptr, &X1, &Y1);
+        break;
+    case GUI_DLIST_NUM: {
+        int32_t Nummber = (int32_t)(((uint32_t)A[2] << 16) | A[3]);
+        UDOUBLE Digits = 0;
+        for (; Nummber; Nummber /= 10)
+            Digits++;
+        X0 = A[0]; Y0 = A[1];
+        if (Digits)
+            GUI_DList_TextBox(X0, Y0, Digits, (sFONT *)Call.Ptr, &X1, &Y1);
+        break;
+    }
+    case GUI_DLIST_STRING_CN: {
+        // Every glyph is drawn font->Width wide, ASCII ones only advance
+        // by ASCII_Width: the box ends with the last glyph
+        const cFONT *font = (const cFONT *)Call.Ptr;
+        const char *p = Call.Text;
+        int x = A[0];
+        X0 = X1 = A[0];
+        Y0 = A[1]; Y1 = A[1] + font->Height;
+        while (*p != 0) {
+            X1 = x + font->Width;
+            if ((*p & 0xff) <= 0x7F) {
+                x += font->ASCII_Width;
+                p += 1;
+            } else {
+                x += font->Width;
+                for (UBYTE i = 0; i < 3 && *p != 0; i++)
+                    p++;
+            }
+        }
+        break;
+    }
+    case GUI_DLIST_BITMAP:
+    case GUI_DLIST_IMAGE4:
+        X0 = A[0]; X1 = A[0] + A[2];
+        Y0 = A[1]; Y1 = A[1] + A[3];
+        break;
+    case GUI_DLIST_TEXT: {
+        // Line widths add up advances; a CN line's last glyph may be an
+        // ASCII one, drawn FontCN->Width wide past its advance
+        const GUI_TEXT *Text = (const GUI_TEXT *)Call.Ptr;
+        X0 = A[0]; X1 = A[0] + ((Text->TextWidth > Text->Width)? Text->TextWidth : Text->Width);
+        if (Text->FontCN != NULL)
+            X1 += Text->FontCN->Width - Text->FontCN->ASCII_Width;
+        Y0 = A[1]; Y1 = A[1] + Text->Height;
+        break;
+    }
+    case GUI_DLIST_POLYGON: {
+        const PAINT_POINT *Points = (const PAINT_POINT *)Call.Ptr;
+        X0 = Y0 = 0xFFFF;
+        for (UWORD i = 0; i < A[0]; i++) {
+            if (Points[i].X < X0)
+                X0 = Points[i].X;
+            if (Points[i].X > X1)
+                X1 = Points[i].X;
+            if (Points[i].Y < Y0)
+                Y0 = Points[i].Y;
+            if (Points[i].Y > Y1)
+                Y1 = Points[i].Y;
+        }
+        break;
+    }
+    }
+
+    if (X0 < 0)
+        X0 = 0;
+    if (Y0 < 0)
+        Y0 = 0;
+    if (X1 > Paint.Width)
+        X1 = Paint.Width;
+    if (Y1 > Paint.Height)
+        Y1 = Paint.Height;
+    if (X0 >= X1 || Y0 >= Y1)
+        X0 = Y0 = X1 = Y1 = 0;      // draws nothing
+    Rec->Xstart = X0;
+    Rec->Ystart = Y0;
+    Rec->Xend = X1;
+    Rec->Yend = Y1;
+}
+
+static void GUI_DList_Play(const GUI_DLIST_RECORD *Rec)
+{
+    GUI_DLIST_CALL Call;
+    const UWORD *A = Call.Arg;
+
+    GUI_DList_Unpack(Rec, &Call);
+    switch (Rec->Op & ~GUI_DLIST_PTR) {
+    case GUI_DLIST_POINT:
+        Paint_DrawPoint(A[0], A[1], A[2], (DOT_PIXEL)A[3], (DOT_STYLE)A[4]);
+        break;
+    case GUI_DLIST_LINE:
+        Paint_DrawLine(A[0], A[1], A[2], A[3], A[4], (DOT_PIXEL)A[5], (LINE_STYLE)A[6]);
+        break;
+    case GUI_DLIST_RECTANGLE:
+        Paint_DrawRectangle(A[0], A[1], A[2], A[3], A[4], (DOT_PIXEL)A[5], (DRAW_FILL)A[6]);
+        break;
+    case GUI_DLIST_CIRCLE:
+        Paint_DrawCircle(A[0], A[1], A[2], A[3], (DOT_PIXEL)A[4], (DRAW_FILL)A[5]);
+        break;
+    case GUI_DLIST_WINDOW:
+        Paint_ClearWindows(A[0], A[1], A[2], A[3], A[4]);
+        break;
+    case GUI_DLIST_CHAR:
+        Paint_DrawChar(A[0], A[1], (char)A[2], (sFONT *)Call.Ptr, A[3], A[4]);
+        break;
+    case GUI_DLIST_STRING_EN:
+        Paint_DrawString_EN(A[0], A[1], Call.Text, (sFONT *)Call.Ptr, A[2], A[3]);
+        break;
+    case GUI_DLIST_STRING_CN:
+        Paint_DrawString_CN(A[0], A[1], Call.Text, (cFONT *)Call.Ptr, A[2], A[3]);
+        break;
+    case GUI_DLIST_NUM:
+        Paint_DrawNum(A[0], A[1], (int32_t)(((uint32_t)A[2] << 16) | A[3]), (sFONT *)Call.Ptr, A[4], A[5]);
+        break;
+    case GUI_DLIST_BITMAP:
+        Paint_DrawBitMap_Paste((const unsigned char *)Call.Ptr, A[0], A[1], A[2], A[3], A[4]);
+        break;
+    case GUI_DLIST_IMAGE4:
+        if (A[4] == 0xFFFF)
+            Paint_DrawImage4((const unsigned char *)Call.Ptr, A[0], A[1], A[2], A[3]);
+        else
+            Paint_DrawSprite4((const unsigned char *)Call.Ptr, A[0], A[1], A[2], A[3], A[4]);
+        break;
+    case GUI_DLIST_POLYGON:
+        Paint_DrawPolygon((const PAINT_POINT *)Call.Ptr, A[0], A[1], (FILL_RULE)A[2]);
+        break;
+    case GUI_DLIST_TEXT:
+        GUI_Text_Draw((const GUI_TEXT *)Call.Ptr, A[0], A[1], A[2], A[3]);
+        break;
+    }
+}
+
+/******************************************************************************
+function:	Draw the calls that can touch the current Paint band
+parameter:
+    List : GUI_DLIST *, recorded calls in order
+info:
+    Calls are drawn in recording order, so overlapping calls paint over
+    each other as they would drawn directly.
+******************************************************************************/
+void GUI_DList_Draw(void *Ctx)
+{
+    GUI_DLIST *List = (GUI_DLIST *)Ctx;
+    UWORD Xstart, Ystart, Xend, Yend;
+    UDOUBLE Offset;
+    GUI_DLIST_RECORD *Rec;
+
+    if (List->BoundWidth != Paint.Width || List->BoundHeight != Paint.Height) {
+        for (Offset = 0; Offset < List->Used; Offset += Rec->Size) {
+            Rec = (GUI_DLIST_RECORD *)(List->Arena + Offset);
+            GUI_DList_Bound(Rec);
+        }
+        List->BoundWidth = Paint.Width;
+        List->BoundHeight = Paint.Height;
+    }
+
+    Paint_GetBandWindow(&Xstart, &Ystart, &Xend, &Yend);
+    for (Offset = 0; Offset < List->Used; Offset += Rec->Size) {
+        Rec = (GUI_DLIST_RECORD *)(List->Arena + Offset);
+        List->Visited++;
+        if (Rec->Xstart >= Xend || Rec->Xend <= Xstart ||
+            Rec->Ystart >= Yend || Rec->Yend <= Ystart)
+            continue;
+        List->Drawn++;
+        GUI_DList_Play(Rec);
+    }
+}
+
+/******************************************************************************
+function:	Draw every call, whatever the band
+parameter:
+    List : GUI_DLIST *, recorded calls in order
+******************************************************************************/
+void GUI_DList_DrawAll(void *Ctx)
+{
+    GUI_DLIST *List = (GUI_DLIST *)Ctx;
+    UDOUBLE Offset;
+    const GUI_DLIST_RECORD *Rec;
+
+    for (Offset = 0; Offset < List->Used; Offset += Rec->Size) {
+        Rec = (const GUI_DLIST_RECORD *)(List->Arena + Offset);
+        GUI_DList_Play(Rec);
+    }
+}
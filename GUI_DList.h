@@ -0,0 +1,57 @@
+/*****************************************************************************
+* | File      	:   GUI_DList.h
+* | Author      :   lernerc606
+* | Function    :   Record Paint_Draw*() calls and replay them band by band
+* | Info        :
+*   A display list stores drawing calls in an arena supplied by the caller
+*   instead of drawing them. GUI_DList_Draw() replays only the calls whose
+*   bounding box meets the current Paint band, so with GUI_Band_Show()
+*   each primitive is rasterized for the few bands it touches instead of
+*   for every band. Strings are copied into the arena; fonts, bitmaps,
+*   polygon vertices and text layouts are referenced and must stay valid.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+*
+******************************************************************************/
+#ifndef _GUI_DLIST_H_
+#define _GUI_DLIST_H_
+
+#include "GUI_Paint.h"
+#include "GUI_Text.h"
+
+typedef struct {
+    UBYTE *Arena;
+    UDOUBLE Size;
+    UDOUBLE Used;
+    UWORD Count;                // recorded calls
+    UBYTE Overflow;             // a call did not fit and was dropped
+    UWORD BoundWidth;           // image size the bounding boxes are for,
+    UWORD BoundHeight;          // 0 after a new call
+    UDOUBLE Visited;            // calls looked at by GUI_DList_Draw()
+    UDOUBLE Drawn;              // calls drawn by GUI_DList_Draw()
+} GUI_DLIST;
+
+void GUI_DList_Init(GUI_DLIST *List, UBYTE *Arena, UDOUBLE Size);
+
+//Recording, same arguments as Paint_x(), 1 if the arena is full
+UBYTE GUI_DList_Point(GUI_DLIST *List, UWORD Xpoint, UWORD Ypoint, UWORD Color, DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_Style);
+UBYTE GUI_DList_Line(GUI_DLIST *List, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, DOT_PIXEL Line_width, LINE_STYLE Line_Style);
+UBYTE GUI_DList_Rectangle(GUI_DLIST *List, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
+UBYTE GUI_DList_Circle(GUI_DLIST *List, UWORD X_Center, UWORD Y_Center, UWORD Radius, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
+UBYTE GUI_DList_Polygon(GUI_DLIST *List, const PAINT_POINT *Points, UWORD Count, UWORD Color, FILL_RULE Fill_Rule);
+UBYTE GUI_DList_ClearWindows(GUI_DLIST *List, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color);
+UBYTE GUI_DList_Char(GUI_DLIST *List, UWORD Xpoint, UWORD Ypoint, const char Acsii_Char, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+UBYTE GUI_DList_String_EN(GUI_DLIST *List, UWORD Xstart, UWORD Ystart, const char * pString, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+UBYTE GUI_DList_String_CN(GUI_DLIST *List, UWORD Xstart, UWORD Ystart, const char * pString, cFONT* font, UWORD Color_Foreground, UWORD Color_Background);
+UBYTE GUI_DList_Text(GUI_DLIST *List, const GUI_TEXT *Text, UWORD Xstart, UWORD Ystart, UWORD Color_Foreground, UWORD Color_Background);
+UBYTE GUI_DList_Num(GUI_DLIST *List, UWORD Xpoint, UWORD Ypoint, int32_t Nummber, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+UBYTE GUI_DList_BitMap_Paste(GUI_DLIST *List, const unsigned char* image_buffer, UWORD xStart, UWORD yStart, UWORD imageWidth, UWORD imageHeight, UBYTE flipColor);
+UBYTE GUI_DList_Image4(GUI_DLIST *List, const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image);
+UBYTE GUI_DList_Sprite4(GUI_DLIST *List, const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image, UWORD Transparent);
+
+//Replay, both fit GUI_BAND_DRAW with the list as Ctx
+void GUI_DList_Draw(void *List);
+void GUI_DList_DrawAll(void *List);
+
+#endif
@@ -0,0 +1,201 @@
+/*****************************************************************************
+* | File      	:   GUI_Overlay.cpp
+* | Author      :   lernerc606
+* | Function    :   Draw captions and icons over a picture while it streams
+* | Info        :
+*   A layer is a Paint band (Paint_SetBand()) over its panel rectangle,
+*   so drawing uses the coordinates of the whole picture and is clipped
+*   to the layer. Merging takes a mask per layer byte from a table: a
+*   nibble that is not GUI_OVERLAY_CLEAR replaces the picture's.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+*
+******************************************************************************/
+#include "GUI_Overlay.h"
+#include "GUI_Paint.h"
+#include "Debug.h"
+
+static UBYTE GUI_Overlay_Mask[256];     // layer byte -> nibbles it covers
+
+/******************************************************************************
+function :  Start an empty set of overlays
+parameter:
+    Overlay : Usually static
+    Arena   : Storage for the layer images, 4bpp
+    Size    : Bytes in Arena
+    Rotate  : Paint rotation the layers are drawn with, e.g. the one the
+              picture is meant to be seen in
+    Mirror  : Paint mirror, e.g. EPD_13IN3E_ORIENTATION for a frame
+              mounted mirrored
+******************************************************************************/
+void GUI_Overlay_Init(GUI_OVERLAY *Overlay, UBYTE *Arena, UDOUBLE Size, UWORD Rotate, UBYTE Mirror)
+{
+    Overlay->Arena = Arena;
+    Overlay->Size = Size;
+    Overlay->Used = 0;
+    Overlay->Rotate = Rotate;
+    Overlay->Mirror = Mirror;
+    Overlay->Width = (Rotate == ROTATE_90 || Rotate == ROTATE_270)? EPD_13IN3E_HEIGHT : EPD_13IN3E_WIDTH;
+    Overlay->Height = (Rotate == ROTATE_90 || Rotate == ROTATE_270)? EPD_13IN3E_WIDTH : EPD_13IN3E_HEIGHT;
+    Overlay->Layers = 0;
+    Overlay->Top = EPD_13IN3E_HEIGHT;
+    Overlay->Bottom = 0;
+    Overlay->Merged = 0;
+    Overlay->Merge_us = 0;
+
+    for (UWORD b = 0; b < 256; b++)
+        GUI_Overlay_Mask[b] = (((b >> 4) != GUI_OVERLAY_CLEAR)? 0xF0 : 0) |
+                              (((b & 0x0F) != GUI_OVERLAY_CLEAR)? 0x0F : 0);
+}
+
+// Panel position of picture pixel X, Y, as Paint_SetPixel() maps it
+static void GUI_Overlay_Map(GUI_OVERLAY *Overlay, UWORD X, UWORD Y, UWORD *Xpanel, UWORD *Ypanel)
+{
+    if (Overlay->Rotate == ROTATE_90) {
+        *Xpanel = EPD_13IN3E_WIDTH - Y - 1;
+        *Ypanel = X;
+    } else if (Overlay->Rotate == ROTATE_180) {
+        *Xpanel = EPD_13IN3E_WIDTH - X - 1;
+        *Ypanel = EPD_13IN3E_HEIGHT - Y - 1;
+    } else if (Overlay->Rotate == ROTATE_270) {
+        *Xpanel = Y;
+        *Ypanel = EPD_13IN3E_HEIGHT - X - 1;
+    } else {
+        *Xpanel = X;
+        *Ypanel = Y;
+    }
+    if (Overlay->Mirror & MIRROR_HORIZONTAL)
+        *Xpanel = EPD_13IN3E_WIDTH - *Xpanel - 1;
+    if (Overlay->Mirror & MIRROR_VERTICAL)
+        *Ypanel = EPD_13IN3E_HEIGHT - *Ypanel - 1;
+}
+
+/******************************************************************************
+function :  Add a layer and select it for drawing
+parameter:
+    Xstart, Ystart : Top left corner, in picture coordinates
+    Xend, Yend     : One past the bottom right corner
+return   :  0 on success, 1 if the arena or the layer table is full
+info     :  The layer starts transparent. Until the next GUI_Overlay_Begin()
+            or Paint_NewImage(), Paint_Draw*() calls draw into it; anything
+            outside the rectangle is dropped.
+******************************************************************************/
+UBYTE GUI_Overlay_Begin(GUI_OVERLAY *Overlay, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    GUI_OVERLAY_LAYER *Layer = &Overlay->Layer[Overlay->Layers];
+    UWORD X0, Y0, X1, Y1;
+
+    if (Xend > Overlay->Width)
+        Xend = Overlay->Width;
+    if (Yend > Overlay->Height)
+        Yend = Overlay->Height;
+    if (Overlay->Layers >= GUI_OVERLAY_LAYERS || Xstart >= Xend || Ystart >= Yend)
+        return 1;
+
+    GUI_Overlay_Map(Overlay, Xstart, Ystart, &X0, &Y0);
+    GUI_Overlay_Map(Overlay, Xend - 1, Yend - 1, &X1, &Y1);
+    Layer->Xstart = ((X0 < X1)? X0 : X1) & ~1;
+    Layer->Xend = (((X0 < X1)? X1 : X0) + 2) & ~1;
+    Layer->Ystart = (Y0 < Y1)? Y0 : Y1;
+    Layer->Yend = ((Y0 < Y1)? Y1 : Y0) + 1;
+
+    UDOUBLE Bytes = (UDOUBLE)(Layer->Xend - Layer->Xstart) / 2 * (Layer->Yend - Layer->Ystart);
+    if (Bytes > Overlay->Size - Overlay->Used) {
+        LOG_E("Overlay arena full, %lu more bytes needed\r\n", (unsigned long)(Bytes - (Overlay->Size - Overlay->Used)));
+        return 1;
+    }
+    Layer->Image = Overlay->Arena + Overlay->Used;
+    Overlay->Used += Bytes;
+    Overlay->Layers++;
+    if (Layer->Ystart < Overlay->Top)
+        Overlay->Top = Layer->Ystart;
+    if (Layer->Yend > Overlay->Bottom)
+        Overlay->Bottom = Layer->Yend;
+
+    Paint_NewImage(Layer->Image, EPD_13IN3E_WIDTH, EPD_13IN3E_HEIGHT, Overlay->Rotate, GUI_OVERLAY_CLEAR);
+    Paint_SetScale(6);
+    Paint_SetMirroring(Overlay->Mirror);
+    Paint_SetBand(Layer->Xstart, Layer->Ystart, Layer->Xend - Layer->Xstart, Layer->Yend - Layer->Ystart);
+    Paint_Clear(GUI_OVERLAY_CLEAR);
+    return 0;
+}
+
+/******************************************************************************
+function :  Row source merging the layers into the picture's rows
+******************************************************************************/
+static const UBYTE *GUI_Overlay_Row(void *Ctx, UWORD Row, UBYTE Half, UBYTE *Buf)
+{
+    GUI_OVERLAY *Overlay = (GUI_OVERLAY *)Ctx;
+
+    if (Row < Overlay->Top || Row >= Overlay->Bottom)
+        return Overlay->Source(Overlay->SourceCtx, Row, Half, Buf);
+
+    const UBYTE *Data = Overlay->Source(Overlay->SourceCtx, Row, Half, Buf);
+    if (Data == NULL)
+        return NULL;
+
+    UDOUBLE t0 = 0;
+    UWORD First = Half * EPD_13IN3E_SEG_BYTES;      // panel byte of Buf[0]
+    UBYTE Merged = 0;
+
+    for (UBYTE i = 0; i < Overlay->Layers; i++) {
+        const GUI_OVERLAY_LAYER *Layer = &Overlay->Layer[i];
+        if (Row < Layer->Ystart || Row >= Layer->Yend)
+            continue;
+        UWORD Start = Layer->Xstart / 2, End = Layer->Xend / 2;
+        if (Start < First)
+            Start = First;
+        if (End > First + EPD_13IN3E_SEG_BYTES)
+            End = First + EPD_13IN3E_SEG_BYTES;
+        if (Start >= End)
+            continue;
+
+        // The source's own storage may be a cache; merge into Buf
+        if (!Merged) {
+            t0 = micros();
+            if (Data != Buf)
+                memcpy(Buf, Data, EPD_13IN3E_SEG_BYTES);
+            Merged = 1;
+        }
+        const UBYTE *In = Layer->Image + (UDOUBLE)(Row - Layer->Ystart) * ((Layer->Xend - Layer->Xstart) / 2)
+                          + (Start - Layer->Xstart / 2);
+        UBYTE *Out = Buf + (Start - First);
+        for (UWORD k = 0; k < End - Start; k++) {
+            UBYTE Mask = GUI_Overlay_Mask[In[k]];
+            Out[k] = (Out[k] & ~Mask) | (In[k] & Mask);
+        }
+    }
+
+    if (!Merged)
+        return Data;
+    Overlay->Merged++;
+    Overlay->Merge_us += micros() - t0;
+    return Buf;
+}
+
+/******************************************************************************
+function :  Stream a picture with the overlays on top
+parameter:
+    Source : Row source of the picture, see EPD_ROW_SOURCE
+    Ctx    : Passed through to Source
+return   :  0 on success, 1 if Source failed
+info     :  Like EPD_13IN3E_SendRows(), only loads the frame.
+******************************************************************************/
+UBYTE GUI_Overlay_Send(GUI_OVERLAY *Overlay, EPD_ROW_SOURCE Source, void *Ctx)
+{
+    if (Overlay->Layers == 0)
+        return EPD_13IN3E_SendRows(Source, Ctx);
+
+    Overlay->Source = Source;
+    Overlay->SourceCtx = Ctx;
+    Overlay->Merged = 0;
+    Overlay->Merge_us = 0;
+    UBYTE Failed = EPD_13IN3E_SendRows(GUI_Overlay_Row, Overlay);
+
+    LOG_I("Overlay: %u layer(s) in %lu bytes over rows %u-%u, %lu half rows merged in %lu ms\r\n",
+          (unsigned)Overlay->Layers, (unsigned long)Overlay->Used, (unsigned)Overlay->Top,
+          (unsigned)(Overlay->Bottom - 1), (unsigned long)Overlay->Merged,
+          (unsigned long)(Overlay->Merge_us / 1000));
+    return Failed;
+}
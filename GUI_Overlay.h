@@ -0,0 +1,58 @@
+/*****************************************************************************
+* | File      	:   GUI_Overlay.h
+* | Author      :   lernerc606
+* | Function    :   Draw captions and icons over a picture while it streams
+* | Info        :
+*   A picture from the SD card goes to the panel row by row and is never
+*   in RAM as a whole, so text cannot simply be drawn on it. Instead each
+*   overlay is a small layer rendered with GUI_Paint beforehand, covering
+*   only its own rectangle. GUI_Overlay_Send() sits between the row source
+*   and the panel and merges the layers into the rows they cover; pixels
+*   left GUI_OVERLAY_CLEAR let the picture through. Rows no layer covers
+*   are passed on untouched, and without layers the row source is sent
+*   directly.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+*
+******************************************************************************/
+#ifndef _GUI_OVERLAY_H_
+#define _GUI_OVERLAY_H_
+
+#include "DEV_Config.h"
+#include "EPD_13in3e.h"
+
+#define GUI_OVERLAY_LAYERS  4
+#define GUI_OVERLAY_CLEAR   0x4     // transparent, not a Spectra 6 color
+
+typedef struct {
+    UWORD Xstart;               // panel rectangle, Xstart and Xend even
+    UWORD Ystart;
+    UWORD Xend;                 // one past the last column and row
+    UWORD Yend;
+    UBYTE *Image;               // 4bpp, (Xend - Xstart) / 2 bytes per row
+} GUI_OVERLAY_LAYER;
+
+typedef struct {
+    UBYTE *Arena;               // layer images
+    UDOUBLE Size;
+    UDOUBLE Used;
+    UWORD Rotate;               // Paint rotation and mirror of the layers
+    UBYTE Mirror;
+    UWORD Width;                // image size seen by Paint_Draw*()
+    UWORD Height;
+    UBYTE Layers;
+    GUI_OVERLAY_LAYER Layer[GUI_OVERLAY_LAYERS];
+    UWORD Top;                  // panel rows covered by some layer
+    UWORD Bottom;
+    EPD_ROW_SOURCE Source;      // picture, while sending
+    void *SourceCtx;
+    UDOUBLE Merged;             // half rows merged by the last send
+    UDOUBLE Merge_us;
+} GUI_OVERLAY;
+
+void GUI_Overlay_Init(GUI_OVERLAY *Overlay, UBYTE *Arena, UDOUBLE Size, UWORD Rotate, UBYTE Mirror);
+UBYTE GUI_Overlay_Begin(GUI_OVERLAY *Overlay, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+UBYTE GUI_Overlay_Send(GUI_OVERLAY *Overlay, EPD_ROW_SOURCE Source, void *Ctx);
+
+#endif
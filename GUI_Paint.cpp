@@ -12,6 +12,53 @@
 * | Date        :   2020-07-23
 * | Info        :
 * -----------------------------------------------------------------------------
+* V3.3(2026-10-18):
+* 1. Change: Pixels are written through writers specialised per scale,
+*           rotation and mirror, looked up once per primitive. Paint_SetPixel
+*           no longer prints on out of range pixels, and rejects X == Width
+*           and Y == Height, which used to spill into the next row.
+* 2. Change: Paint_SetScale(UBYTE scale)
+*           Scale 6 is now native Spectra 6 (S6_x colors, WHITE maps to
+*           S6_WHITE) instead of an alias of 7; 4bpp spans and Paint_Clear
+*           fill whole bytes.
+*           4bpp colors are masked to a nibble, WHITE (0xFF) used to
+*           overwrite the neighbouring pixel.
+* 3. Change: Paint_Clear, Paint_ClearWindows and filled rectangles
+*           Fill whole rows with masked edge bytes and memset in between.
+* 4. Add: Paint_SetBand()
+*           The buffer can hold a band of the image; drawing outside it is
+*           clipped.
+* 5. Add: Paint_GetBandWindow()
+*           The band in image coordinates, to skip drawing outside it.
+* 6. Change: Paint_DrawChar, Paint_DrawString_CN
+*           Glyphs are merged a font byte at a time through a lookup table;
+*           rotated or mirrored glyphs are transformed once and cached.
+* 7. Change: Paint_DrawString_CN
+*           Characters are found by binary search in the font's sorted
+*           index (fonts.h) instead of a scan of the table.
+* 8. Add: Paint_DrawGlyph(), Paint_ForgetGlyph()
+*           Draw glyphs that do not come from a font table, e.g. loaded
+*           from the SD card into a buffer that is reused.
+* 9. Change: Paint_DrawChar
+*           FONT_PACKED fonts (font_packed.cpp) are expanded a row at a
+*           time; the glyph cache keeps the least recently used glyphs.
+* 10. Add: Paint_DrawImage4(), Paint_DrawSprite4()
+*           4bpp images clipped to the image and the band, copied a row
+*           at a time. Paint_DrawImage() no longer writes past the buffer.
+* 11. Add: Paint_X_r(PAINT *P, ...) for every Paint_X()
+*           Draw on a given context; Paint_X() draws on Paint through it.
+*           PAINT_THREADS makes the glyph cache per thread.
+* 12. Add: Paint_DrawPolygon()
+*           Filled polygons, even-odd or nonzero, as spans from an active
+*           edge table, in fixed memory and only over the band's rows.
+* 13. Add: PAINT_TINT(), S6_GRAY, S6_ORANGE, ...
+*           Two colors mixed by an 8x8 ordered dither, as a color for any
+*           primitive. Spans write whole pattern bytes from tables.
+* 14. Add: Paint_FindCN()
+*           The table entry of a CN character, for GUI_Text.h.
+* 15. Add: PAINT_COUNT, Paint_Written
+*           Count the pixels shapes and text write, for tools/paint_bench.
+*
 * V3.2(2020-07-23):
 * 1. Change: Paint_SetScale(UBYTE scale)
 *			Add scale 7 for 5.65f e-Parper
@@ -83,6 +130,364 @@
 
 PAINT Paint;
 
+/******************************************************************************
+Contexts
+    Every function works on the PAINT passed to it, never on Paint, so
+    several images, or bands of one image, can be drawn at the same time.
+    Paint_X() is Paint_X_r(&Paint, ...), see the end of the file.
+******************************************************************************/
+
+// The few tables that are not part of a context, such as the glyph cache,
+// are per thread with PAINT_THREADS, so contexts need no lock
+#if PAINT_THREADS
+#define PAINT_LOCAL thread_local
+#else
+#define PAINT_LOCAL
+#endif
+
+#if PAINT_COUNT
+PAINT_LOCAL UDOUBLE Paint_Written;
+#define PAINT_COUNTED(n)    (Paint_Written += (n))
+#else
+#define PAINT_COUNTED(n)
+#endif
+
+typedef struct {
+    UWORD Two[256];             // 1bpp byte -> 2bpp pixel mask
+    UDOUBLE Four[256];          // 1bpp byte -> 4bpp pixel mask
+} PAINT_EXPAND;
+
+// Built by the compiler, so the tables are read-only and never initialised
+// at run time, by one thread or several
+static constexpr PAINT_EXPAND Paint_MakeExpand(void)
+{
+    PAINT_EXPAND E = {};
+    for (UWORD b = 0; b < 256; b++) {
+        for (UBYTE i = 0; i < 8; i++) {
+            if (b & (0x80 >> i)) {
+                E.Two[b] |= 0xC000 >> (i * 2);
+                E.Four[b] |= 0xF0000000UL >> (i * 4);
+            }
+        }
+    }
+    return E;
+}
+static constexpr PAINT_EXPAND Paint_Expand = Paint_MakeExpand();
+
+/******************************************************************************
+Tints
+    A PAINT_TINT() color is two colors mixed by an 8 x 8 ordered (Bayer)
+    dither. The pattern of every level is a table built by the compiler,
+    one byte per row; a span expands its row to four 4bpp bytes once and
+    repeats them, instead of choosing a color pixel by pixel. Patterns are
+    anchored to the memory, so bands and neighbouring shapes line up.
+******************************************************************************/
+static constexpr UBYTE Paint_Bayer[8][8] = {
+    {  0, 32,  8, 40,  2, 34, 10, 42 },
+    { 48, 16, 56, 24, 50, 18, 58, 26 },
+    { 12, 44,  4, 36, 14, 46,  6, 38 },
+    { 60, 28, 52, 20, 62, 30, 54, 22 },
+    {  3, 35, 11, 43,  1, 33,  9, 41 },
+    { 51, 19, 59, 27, 49, 17, 57, 25 },
+    { 15, 47,  7, 39, 13, 45,  5, 37 },
+    { 63, 31, 55, 23, 61, 29, 53, 21 },
+};
+
+typedef struct {
+    UBYTE Row[32][8];           // level, memory row % 8 -> Ink pixels, MSB first
+} PAINT_TINTS;
+
+static constexpr PAINT_TINTS Paint_MakeTints(void)
+{
+    PAINT_TINTS T = {};
+    for (UBYTE Level = 0; Level < 32; Level++)
+        for (UBYTE y = 0; y < 8; y++)
+            for (UBYTE x = 0; x < 8; x++)
+                if (Paint_Bayer[y][x] < Level * 4)
+                    T.Row[Level][y] |= 0x80 >> x;
+    return T;
+}
+static constexpr PAINT_TINTS Paint_Tints = Paint_MakeTints();
+
+// Plain color of a tint at memory position X, Y of the whole image
+static inline UWORD Paint_TintColor(UWORD Color, UWORD X, UWORD Y)
+{
+    UBYTE Ink = Paint_Tints.Row[(Color >> 8) & 0x1F][Y % 8];
+    return (Ink & (0x80 >> (X % 8)))? (Color >> 4) & 0x0F : Color & 0x0F;
+}
+
+/******************************************************************************
+Pixel writers
+    Paint_SetPixel used to check the bounds and switch on Rotate, Mirror and
+    Scale for every pixel. The writers below are specialised for each
+    (scale, rotation, mirror) combination at compile time; a primitive looks
+    its writer up once and then calls it for every pixel or span.
+******************************************************************************/
+typedef void (*PAINT_PIXEL)(PAINT *P, UWORD Xpoint, UWORD Ypoint, UWORD Color);
+typedef void (*PAINT_SPAN)(PAINT *P, UWORD Xstart, UWORD Xend, UWORD Ypoint, UWORD Color);
+typedef struct {
+    PAINT_PIXEL Pixel;      // one pixel, clipped
+    PAINT_SPAN HSpan;       // pixels Xstart..Xend-1 of one row, clipped
+} PAINT_WRITER;
+
+// Spectra 6 nibble code for a Paint color, WHITE (0xFF) included
+static inline UBYTE Paint_S6Color(UWORD Color)
+{
+    return (Color == WHITE)? S6_WHITE : (Color & 0x0F);
+}
+
+// Write a pixel at memory position X, Y
+template <UBYTE Scale>
+static inline void Paint_Put(PAINT *P, UWORD X, UWORD Y, UWORD Color)
+{
+    PAINT_COUNTED(1);
+    if (Color & PAINT_TINT_FLAG)
+        Color = Paint_TintColor(Color, X + P->BandX, Y + P->BandY);
+    if (Scale == 6)
+        Color = Paint_S6Color(Color);
+    if (Scale == 2) {
+        UDOUBLE Addr = X / 8 + Y * P->WidthByte;
+        UBYTE Rdata = P->Image[Addr];
+        if(Color == BLACK)
+            P->Image[Addr] = Rdata & ~(0x80 >> (X % 8));
+        else
+            P->Image[Addr] = Rdata | (0x80 >> (X % 8));
+    } else if (Scale == 4) {
+        UDOUBLE Addr = X / 4 + Y * P->WidthByte;
+        Color = Color % 4;//Guaranteed color scale is 4  --- 0~3
+        UBYTE Rdata = P->Image[Addr];
+        Rdata = Rdata & (~(0xC0 >> ((X % 4)*2)));
+        P->Image[Addr] = Rdata | ((Color << 6) >> ((X % 4)*2));
+    } else {
+        UDOUBLE Addr = X / 2  + Y * P->WidthByte;
+        Color = Color & 0x0F;//A wider value would spill into the other pixel
+        UBYTE Rdata = P->Image[Addr];
+        Rdata = Rdata & (~(0xF0 >> ((X % 2)*4)));//Clear first, then set value
+        P->Image[Addr] = Rdata | ((Color << 4) >> ((X % 2)*4));
+    }
+}
+
+// A byte with every pixel set to Color
+template <UBYTE Scale>
+static inline UBYTE Paint_FillByte(UWORD Color)
+{
+    // A tint has no single byte; text takes its nearer color
+    if (Color & PAINT_TINT_FLAG)
+        Color = (((Color >> 8) & 0x1F) >= 8)? (Color >> 4) & 0x0F : Color & 0x0F;
+    if (Scale == 2)
+        return (Color == BLACK)? 0x00 : 0xFF;
+    else if (Scale == 4)
+        return (Color % 4) * 0x55;
+    else
+        return ((Scale == 6)? Paint_S6Color(Color) : (Color & 0x0F)) * 0x11;
+}
+
+// Tint memory pixels Xstart..Xend-1 of row Y. At 4bpp the pattern row is
+// four bytes: the edge bytes are masked, the first whole bytes written and
+// then copied onto the rest in doubling runs
+template <UBYTE Scale>
+static void Paint_TintRow(PAINT *P, UWORD Y, UWORD Xstart, UWORD Xend, UWORD Color)
+{
+    if (Scale == 2 || Scale == 4 || (P->BandX & 1)) {
+        for (; Xstart < Xend; Xstart++)
+            Paint_Put<Scale>(P, Xstart, Y, Color);
+        return;
+    }
+    PAINT_COUNTED(Xend - Xstart);
+
+    UDOUBLE Ink = Paint_Expand.Four[Paint_Tints.Row[(Color >> 8) & 0x1F][(Y + P->BandY) % 8]];
+    UDOUBLE Word = (((Color >> 4) & 0x0F) * 0x11111111UL & Ink) | ((Color & 0x0F) * 0x11111111UL & ~Ink);
+    UBYTE Tile[4];
+    UWORD Phase = P->BandX / 2;     // memory byte of Row[0]
+    for (UBYTE k = 0; k < 4; k++)
+        Tile[(k - Phase) & 3] = Word >> (24 - 8 * k);
+
+    UBYTE *Row = P->Image + (UDOUBLE)Y * P->WidthByte;
+    UWORD First = Xstart / 2;
+    UWORD Last = (Xend - 1) / 2;
+    UBYTE Head = (Xstart & 1)? 0x0F : 0xFF;
+    UBYTE Tail = (Xend & 1)? 0xF0 : 0xFF;
+
+    if (First == Last) {
+        Head &= Tail;
+        Row[First] = (Row[First] & ~Head) | (Tile[First & 3] & Head);
+        return;
+    }
+    Row[First] = (Row[First] & ~Head) | (Tile[First & 3] & Head);
+    Row[Last] = (Row[Last] & ~Tail) | (Tile[Last & 3] & Tail);
+
+    UBYTE *Dst = Row + First + 1;
+    UWORD N = Last - First - 1, Done = (N < 4)? N : 4;
+    for (UWORD k = 0; k < Done; k++)
+        Dst[k] = Tile[(First + 1 + k) & 3];
+    while (Done < N) {
+        UWORD Copy = (Done < N - Done)? Done : N - Done;
+        memcpy(Dst + Done, Dst, Copy);
+        Done += Copy;
+    }
+}
+
+// Fill memory pixels Xstart..Xend-1 (Xstart < Xend) of row Y: masked
+// edge bytes, memset for the whole bytes in between
+template <UBYTE Scale>
+static inline void Paint_FillRow(PAINT *P, UWORD Y, UWORD Xstart, UWORD Xend, UWORD Color)
+{
+    const UBYTE Bpp = (Scale == 2)? 1 : (Scale == 4)? 2 : 4;
+    const UBYTE Ppb = 8 / Bpp;  // pixels per byte
+    if (Color & PAINT_TINT_FLAG) {
+        Paint_TintRow<Scale>(P, Y, Xstart, Xend, Color);
+        return;
+    }
+    UBYTE Fill = Paint_FillByte<Scale>(Color);
+    PAINT_COUNTED(Xend - Xstart);
+
+    UBYTE *Row = P->Image + (UDOUBLE)Y * P->WidthByte;
+    UWORD First = Xstart / Ppb;
+    UWORD Last = (Xend - 1) / Ppb;
+    UBYTE Head = 0xFF >> ((Xstart % Ppb) * Bpp);
+    UBYTE Tail = 0xFF << ((Ppb - 1 - (Xend - 1) % Ppb) * Bpp);
+
+    if (First == Last) {
+        Head &= Tail;
+        Row[First] = (Row[First] & ~Head) | (Fill & Head);
+        return;
+    }
+    Row[First] = (Row[First] & ~Head) | (Fill & Head);
+    Row[Last] = (Row[Last] & ~Tail) | (Fill & Tail);
+    if (Last > First + 1)
+        memset(Row + First + 1, Fill, Last - First - 1);
+}
+
+// Write a pixel at memory position X, Y if it falls inside the band
+template <UBYTE Scale>
+static inline void Paint_PutBand(PAINT *P, UWORD X, UWORD Y, UWORD Color)
+{
+    X -= P->BandX;
+    Y -= P->BandY;
+    if (X < P->BandWidth && Y < P->BandHeight)
+        Paint_Put<Scale>(P, X, Y, Color);
+}
+
+// Map a point of the rotated and mirrored image to its memory position
+template <UWORD Rotate, UBYTE Mirror>
+static inline void Paint_Map(PAINT *P, UWORD Xpoint, UWORD Ypoint, UWORD *X, UWORD *Y)
+{
+    if (Rotate == ROTATE_0) {
+        *X = Xpoint;
+        *Y = Ypoint;
+    } else if (Rotate == ROTATE_90) {
+        *X = P->WidthMemory - Ypoint - 1;
+        *Y = Xpoint;
+    } else if (Rotate == ROTATE_180) {
+        *X = P->WidthMemory - Xpoint - 1;
+        *Y = P->HeightMemory - Ypoint - 1;
+    } else {
+        *X = Ypoint;
+        *Y = P->HeightMemory - Xpoint - 1;
+    }
+    if (Mirror & MIRROR_HORIZONTAL)
+        *X = P->WidthMemory - *X - 1;
+    if (Mirror & MIRROR_VERTICAL)
+        *Y = P->HeightMemory - *Y - 1;
+}
+
+template <UBYTE Scale, UWORD Rotate, UBYTE Mirror>
+static void Paint_WritePixel(PAINT *P, UWORD Xpoint, UWORD Ypoint, UWORD Color)
+{
+    UWORD X, Y;
+    if (Xpoint >= P->Width || Ypoint >= P->Height)
+        return;
+    Paint_Map<Rotate, Mirror>(P, Xpoint, Ypoint, &X, &Y);
+    // P->Width/Height do not follow a later Paint_SetRotate()
+    if (X >= P->WidthMemory || Y >= P->HeightMemory)
+        return;
+    Paint_PutBand<Scale>(P, X, Y, Color);
+}
+
+template <UBYTE Scale, UWORD Rotate, UBYTE Mirror>
+static void Paint_WriteSpan(PAINT *P, UWORD Xstart, UWORD Xend, UWORD Ypoint, UWORD Color)
+{
+    UWORD X, Y;
+    if (Ypoint >= P->Height)
+        return;
+    if (Xend > P->Width)
+        Xend = P->Width;
+    if (Xstart >= Xend)
+        return;
+
+    // At 0 and 180 degrees a span stays within one memory row
+    if (Rotate == ROTATE_0 || Rotate == ROTATE_180) {
+        UWORD Xlast, Ylast;
+        Paint_Map<Rotate, Mirror>(P, Xstart, Ypoint, &X, &Y);
+        Paint_Map<Rotate, Mirror>(P, Xend - 1, Ypoint, &Xlast, &Ylast);
+        if (X < P->WidthMemory && Xlast < P->WidthMemory && Y < P->HeightMemory) {
+            UWORD Lo = (X < Xlast)? X : Xlast;
+            UWORD Hi = ((X < Xlast)? Xlast : X) + 1;
+            Y -= P->BandY;
+            if (Y >= P->BandHeight)
+                return;
+            if (Lo < P->BandX)
+                Lo = P->BandX;
+            if (Hi > P->BandX + P->BandWidth)
+                Hi = P->BandX + P->BandWidth;
+            if (Lo < Hi)
+                Paint_FillRow<Scale>(P, Y, Lo - P->BandX, Hi - P->BandX, Color);
+            return;
+        }
+    }
+
+    for (; Xstart < Xend; Xstart++) {
+        Paint_Map<Rotate, Mirror>(P, Xstart, Ypoint, &X, &Y);
+        if (X < P->WidthMemory && Y < P->HeightMemory)
+            Paint_PutBand<Scale>(P, X, Y, Color);
+    }
+}
+
+static void Paint_NoPixel(PAINT *, UWORD, UWORD, UWORD) {}
+static void Paint_NoSpan(PAINT *, UWORD, UWORD, UWORD, UWORD) {}
+
+#define PAINT_WRITER_ENTRY(S, R, M) { Paint_WritePixel<S, R, M>, Paint_WriteSpan<S, R, M> }
+#define PAINT_WRITER_MIRRORS(S, R)  { PAINT_WRITER_ENTRY(S, R, MIRROR_NONE), \
+                                      PAINT_WRITER_ENTRY(S, R, MIRROR_HORIZONTAL), \
+                                      PAINT_WRITER_ENTRY(S, R, MIRROR_VERTICAL), \
+                                      PAINT_WRITER_ENTRY(S, R, MIRROR_ORIGIN) }
+#define PAINT_WRITER_ROTATES(S)     { PAINT_WRITER_MIRRORS(S, ROTATE_0), \
+                                      PAINT_WRITER_MIRRORS(S, ROTATE_90), \
+                                      PAINT_WRITER_MIRRORS(S, ROTATE_180), \
+                                      PAINT_WRITER_MIRRORS(S, ROTATE_270) }
+
+static const PAINT_WRITER Paint_Writers[4][4][4] = {
+    PAINT_WRITER_ROTATES(2),
+    PAINT_WRITER_ROTATES(4),
+    PAINT_WRITER_ROTATES(6),
+    PAINT_WRITER_ROTATES(7),    // 7 and 16
+};
+static const PAINT_WRITER Paint_NoWriter = { Paint_NoPixel, Paint_NoSpan };
+
+/******************************************************************************
+function: Writer for the current scale, rotation and mirror
+info:     Look it up once per primitive; an unsupported setting gets a writer
+          that draws nothing.
+******************************************************************************/
+static const PAINT_WRITER *Paint_GetWriter(PAINT *P)
+{
+    UBYTE Depth;
+    if (P->Scale == 2)
+        Depth = 0;
+    else if (P->Scale == 4)
+        Depth = 1;
+    else if (P->Scale == 6)
+        Depth = 2;
+    else if (P->Scale == 7 || P->Scale == 16)
+        Depth = 3;
+    else
+        return &Paint_NoWriter;
+
+    if (P->Rotate % 90 != 0 || P->Rotate > ROTATE_270 || P->Mirror > MIRROR_ORIGIN)
+        return &Paint_NoWriter;
+    return &Paint_Writers[Depth][P->Rotate / 90][P->Mirror];
+}
+
 /******************************************************************************
 function: Create Image
 parameter:
@@ -91,29 +496,33 @@ parameter:
     Height  :   The height of the picture
     Color   :   Whether the picture is inverted
 ******************************************************************************/
-void Paint_NewImage(UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD Color)
+void Paint_NewImage_r(PAINT *P, UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD Color)
 {
-    Paint.Image = NULL;
-    Paint.Image = image;
+    P->Image = NULL;
+    P->Image = image;
 
-    Paint.WidthMemory = Width;
-    Paint.HeightMemory = Height;
-    Paint.Color = Color;    
-    Paint.Scale = 2;
-    Paint.WidthByte = (Width % 8 == 0)? (Width / 8 ): (Width / 8 + 1);
-    Paint.HeightByte = Height;    
+    P->WidthMemory = Width;
+    P->HeightMemory = Height;
+    P->BandX = 0;
+    P->BandY = 0;
+    P->BandWidth = Width;
+    P->BandHeight = Height;
+    P->Color = Color;    
+    P->Scale = 2;
+    P->WidthByte = (Width % 8 == 0)? (Width / 8 ): (Width / 8 + 1);
+    P->HeightByte = Height;    
 //    printf("WidthByte = %d, HeightByte = %d\r\n", Paint.WidthByte, Paint.HeightByte);
 //    printf(" EPD_WIDTH / 8 = %d\r\n",  122 / 8);
    
-    Paint.Rotate = Rotate;
-    Paint.Mirror = MIRROR_NONE;
+    P->Rotate = Rotate;
+    P->Mirror = MIRROR_NONE;
     
     if(Rotate == ROTATE_0 || Rotate == ROTATE_180) {
-        Paint.Width = Width;
-        Paint.Height = Height;
+        P->Width = Width;
+        P->Height = Height;
     } else {
-        Paint.Width = Height;
-        Paint.Height = Width;
+        P->Width = Height;
+        P->Height = Width;
     }
 }
 
@@ -122,9 +531,9 @@ function: Select Image
 parameter:
     image : Pointer to the image cache
 ******************************************************************************/
-void Paint_SelectImage(UBYTE *image)
+void Paint_SelectImage_r(PAINT *P, UBYTE *image)
 {
-    Paint.Image = image;
+    P->Image = image;
 }
 
 /******************************************************************************
@@ -132,11 +541,11 @@ function: Select Image Rotate
 parameter:
     Rotate : 0,90,180,270
 ******************************************************************************/
-void Paint_SetRotate(UWORD Rotate)
+void Paint_SetRotate_r(PAINT *P, UWORD Rotate)
 {
     if(Rotate == ROTATE_0 || Rotate == ROTATE_90 || Rotate == ROTATE_180 || Rotate == ROTATE_270) {
         // Debug("Set image Rotate %d\r\n", Rotate);
-        Paint.Rotate = Rotate;
+        P->Rotate = Rotate;
     } else {
         Debug("rotate = 0, 90, 180, 270\r\n");
     }
@@ -147,35 +556,104 @@ function:	Select Image mirror
 parameter:
     mirror   :Not mirror,Horizontal mirror,Vertical mirror,Origin mirror
 ******************************************************************************/
-void Paint_SetMirroring(UBYTE mirror)
+void Paint_SetMirroring_r(PAINT *P, UBYTE mirror)
 {
     if(mirror == MIRROR_NONE || mirror == MIRROR_HORIZONTAL || 
         mirror == MIRROR_VERTICAL || mirror == MIRROR_ORIGIN) {
         // Debug("mirror image x:%s, y:%s\r\n",(mirror & 0x01)? "mirror":"none", ((mirror >> 1) & 0x01)? "mirror":"none");
-        Paint.Mirror = mirror;
+        P->Mirror = mirror;
     } else {
         Debug("mirror should be MIRROR_NONE, MIRROR_HORIZONTAL, \
         MIRROR_VERTICAL or MIRROR_ORIGIN\r\n");
     }    
 }
 
-void Paint_SetScale(UBYTE scale)
+/******************************************************************************
+function:	Select the part of the image the buffer holds
+parameter:
+    Xstart : Memory column of the buffer's first pixel, a multiple of the
+             pixels per byte
+    Ystart : Memory row of the buffer's first row
+    Width  : Buffer width in pixels
+    Height : Buffer height in rows
+info:
+    Coordinates stay those of the whole image; pixels outside the band
+    are dropped. Replaying the same drawing once per band renders an image
+    far larger than the RAM available (GUI_Band.h). Paint_NewImage() resets
+    the band to the whole image.
+******************************************************************************/
+void Paint_SetBand_r(PAINT *P, UWORD Xstart, UWORD Ystart, UWORD Width, UWORD Height)
+{
+    UBYTE Ppb = (P->Scale == 2)? 8 : (P->Scale == 4)? 4 : 2;
+    P->BandX = Xstart;
+    P->BandY = Ystart;
+    P->BandWidth = Width;
+    P->BandHeight = Height;
+    P->WidthByte = (Width + Ppb - 1) / Ppb;
+    P->HeightByte = Height;
+}
+
+/******************************************************************************
+function:	The band as a rectangle of the rotated and mirrored image
+parameter:
+    Xstart, Ystart : First column and row
+    Xend, Yend     : One past the last column and row
+info:
+    Lets a caller skip drawing that cannot touch the band (GUI_DList.h).
+******************************************************************************/
+void Paint_GetBandWindow_r(PAINT *P, UWORD *Xstart, UWORD *Ystart, UWORD *Xend, UWORD *Yend)
+{
+    UWORD X[2] = { P->BandX, (UWORD)(P->BandX + P->BandWidth - 1) };
+    UWORD Y[2] = { P->BandY, (UWORD)(P->BandY + P->BandHeight - 1) };
+    UWORD Xpoint[2], Ypoint[2];
+
+    // Undo Paint_Map() for two opposite corners
+    for (UBYTE i = 0; i < 2; i++) {
+        if (P->Mirror & MIRROR_HORIZONTAL)
+            X[i] = P->WidthMemory - X[i] - 1;
+        if (P->Mirror & MIRROR_VERTICAL)
+            Y[i] = P->HeightMemory - Y[i] - 1;
+        if (P->Rotate == ROTATE_90) {
+            Xpoint[i] = Y[i];
+            Ypoint[i] = P->WidthMemory - X[i] - 1;
+        } else if (P->Rotate == ROTATE_180) {
+            Xpoint[i] = P->WidthMemory - X[i] - 1;
+            Ypoint[i] = P->HeightMemory - Y[i] - 1;
+        } else if (P->Rotate == ROTATE_270) {
+            Xpoint[i] = P->HeightMemory - Y[i] - 1;
+            Ypoint[i] = X[i];
+        } else {
+            Xpoint[i] = X[i];
+            Ypoint[i] = Y[i];
+        }
+    }
+    *Xstart = (Xpoint[0] < Xpoint[1])? Xpoint[0] : Xpoint[1];
+    *Xend = ((Xpoint[0] < Xpoint[1])? Xpoint[1] : Xpoint[0]) + 1;
+    *Ystart = (Ypoint[0] < Ypoint[1])? Ypoint[0] : Ypoint[1];
+    *Yend = ((Ypoint[0] < Ypoint[1])? Ypoint[1] : Ypoint[0]) + 1;
+}
+
+void Paint_SetScale_r(PAINT *P, UBYTE scale)
 {
     if(scale == 2){
-        Paint.Scale = scale;
-        Paint.WidthByte = (Paint.WidthMemory % 8 == 0)? (Paint.WidthMemory / 8 ): (Paint.WidthMemory / 8 + 1);
+        P->Scale = scale;
+        P->WidthByte = (P->BandWidth % 8 == 0)? (P->BandWidth / 8 ): (P->BandWidth / 8 + 1);
     }
 	else if(scale == 4) {
-        Paint.Scale = scale;
-        Paint.WidthByte = (Paint.WidthMemory % 4 == 0)? (Paint.WidthMemory / 4 ): (Paint.WidthMemory / 4 + 1);
+        P->Scale = scale;
+        P->WidthByte = (P->BandWidth % 4 == 0)? (P->BandWidth / 4 ): (P->BandWidth / 4 + 1);
     }
-	else if(scale == 6 || scale == 7) {//Only applicable with 5in65 e-Paper
-		Paint.Scale = 7;
-		Paint.WidthByte = (Paint.WidthMemory % 2 == 0)? (Paint.WidthMemory / 2 ): (Paint.WidthMemory / 2 + 1);
+	else if(scale == 6) {//Spectra 6, same layout as EPD_13IN3E_Display()
+		P->Scale = 6;
+		P->WidthByte = (P->BandWidth % 2 == 0)? (P->BandWidth / 2 ): (P->BandWidth / 2 + 1);
+	}
+	else if(scale == 7) {//Only applicable with 5in65 e-Paper
+		P->Scale = 7;
+		P->WidthByte = (P->BandWidth % 2 == 0)? (P->BandWidth / 2 ): (P->BandWidth / 2 + 1);
 	}
 	else {
         Debug("Set Scale Input parameter error\r\n");
-        Debug("Scale Only support: 2 4 7\r\n");
+        Debug("Scale Only support: 2 4 6 7\r\n");
     }
 }
 /******************************************************************************
@@ -185,77 +663,9 @@ parameter:
     Ypoint : At point Y
     Color  : Painted colors
 ******************************************************************************/
-void Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color)
+void Paint_SetPixel_r(PAINT *P, UWORD Xpoint, UWORD Ypoint, UWORD Color)
 {
-    if(Xpoint > Paint.Width || Ypoint > Paint.Height){
-        Debug("Exceeding display boundaries\r\n");
-        return;
-    }      
-    UWORD X, Y;
-    switch(Paint.Rotate) {
-    case 0:
-        X = Xpoint;
-        Y = Ypoint;  
-        break;
-    case 90:
-        X = Paint.WidthMemory - Ypoint - 1;
-        Y = Xpoint;
-        break;
-    case 180:
-        X = Paint.WidthMemory - Xpoint - 1;
-        Y = Paint.HeightMemory - Ypoint - 1;
-        break;
-    case 270:
-        X = Ypoint;
-        Y = Paint.HeightMemory - Xpoint - 1;
-        break;
-    default:
-        return;
-    }
-    
-    switch(Paint.Mirror) {
-    case MIRROR_NONE:
-        break;
-    case MIRROR_HORIZONTAL:
-        X = Paint.WidthMemory - X - 1;
-        break;
-    case MIRROR_VERTICAL:
-        Y = Paint.HeightMemory - Y - 1;
-        break;
-    case MIRROR_ORIGIN:
-        X = Paint.WidthMemory - X - 1;
-        Y = Paint.HeightMemory - Y - 1;
-        break;
-    default:
-        return;
-    }
-
-    if(X > Paint.WidthMemory || Y > Paint.HeightMemory){
-        Debug("Exceeding display boundaries\r\n");
-        return;
-    }
-    
-    if(Paint.Scale == 2){
-        UDOUBLE Addr = X / 8 + Y * Paint.WidthByte;
-        UBYTE Rdata = Paint.Image[Addr];
-        if(Color == BLACK)
-            Paint.Image[Addr] = Rdata & ~(0x80 >> (X % 8));
-        else
-            Paint.Image[Addr] = Rdata | (0x80 >> (X % 8));
-    }else if(Paint.Scale == 4){
-        UDOUBLE Addr = X / 4 + Y * Paint.WidthByte;
-        Color = Color % 4;//Guaranteed color scale is 4  --- 0~3
-        UBYTE Rdata = Paint.Image[Addr];
-        
-        Rdata = Rdata & (~(0xC0 >> ((X % 4)*2)));
-        Paint.Image[Addr] = Rdata | ((Color << 6) >> ((X % 4)*2));
-    }else if(Paint.Scale == 6 || Paint.Scale == 7 || Paint.Scale == 16){
-		UDOUBLE Addr = X / 2  + Y * Paint.WidthByte;
-		UBYTE Rdata = Paint.Image[Addr];
-		Rdata = Rdata & (~(0xF0 >> ((X % 2)*4)));//Clear first, then set value
-		Paint.Image[Addr] = Rdata | ((Color << 4) >> ((X % 2)*4));
-		// printf("Add =  %d ,data = %d\r\n",Addr,Rdata);	
-    }
+    Paint_GetWriter(P)->Pixel(P, Xpoint, Ypoint, Color);
 }
 
 /******************************************************************************
@@ -263,30 +673,26 @@ function: Clear the color of the picture
 parameter:
     Color : Painted colors
 ******************************************************************************/
-void Paint_Clear(UWORD Color)
+void Paint_Clear_r(PAINT *P, UWORD Color)
 {
-    if(Paint.Scale == 2) {
-		for (UWORD Y = 0; Y < Paint.HeightByte; Y++) {
-			for (UWORD X = 0; X < Paint.WidthByte; X++ ) {//8 pixel =  1 byte
-				UDOUBLE Addr = X + Y*Paint.WidthByte;
-				Paint.Image[Addr] = Color;
-			}
-		}
-    }else if(Paint.Scale == 4) {
-        for (UWORD Y = 0; Y < Paint.HeightByte; Y++) {
-            for (UWORD X = 0; X < Paint.WidthByte; X++ ) {
-                UDOUBLE Addr = X + Y*Paint.WidthByte;
-                Paint.Image[Addr] = (Color<<6)|(Color<<4)|(Color<<2)|Color;
-            }
-        }
-    }else if(Paint.Scale == 6 || Paint.Scale == 7 || Paint.Scale == 16) {
-		for (UWORD Y = 0; Y < Paint.HeightByte; Y++) {
-			for (UWORD X = 0; X < Paint.WidthByte; X++ ) {
-				UDOUBLE Addr = X + Y*Paint.WidthByte;
-				Paint.Image[Addr] = (Color<<4)|Color;
-			}
-		}		
-	}
+    UBYTE Fill;
+    if (Color & PAINT_TINT_FLAG) {
+        Paint_ClearWindows_r(P, 0, 0, P->Width, P->Height, Color);
+        return;
+    }
+    if(P->Scale == 2) {
+        Fill = Color;//8 pixel =  1 byte
+    }else if(P->Scale == 4) {
+        Fill = (Color<<6)|(Color<<4)|(Color<<2)|Color;
+    }else if(P->Scale == 6) {
+        UBYTE Code = Paint_S6Color(Color);
+        Fill = (Code << 4) | Code;
+    }else if(P->Scale == 7 || P->Scale == 16) {
+        Fill = (Color<<4)|Color;
+    }else {
+        return;
+    }
+    memset(P->Image, Fill, (UDOUBLE)P->WidthByte * P->HeightByte);
 }
 
 /******************************************************************************
@@ -298,13 +704,12 @@ parameter:
     Yend   : y end point
     Color  : Painted colors
 ******************************************************************************/
-void Paint_ClearWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
+void Paint_ClearWindows_r(PAINT *P, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
 {
-    UWORD X, Y;
+    const PAINT_WRITER *W = Paint_GetWriter(P);
+    UWORD Y;
     for (Y = Ystart; Y < Yend; Y++) {
-        for (X = Xstart; X < Xend; X++) {//8 pixel =  1 byte
-            Paint_SetPixel(X, Y, Color);
-        }
+        W->HSpan(P, Xstart, Xend, Y, Color);
     }
 }
 
@@ -317,33 +722,148 @@ parameter:
     Dot_Pixel	: point size
     Dot_Style	: point Style
 ******************************************************************************/
-void Paint_DrawPoint(UWORD Xpoint, UWORD Ypoint, UWORD Color,
-                     DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_Style)
+static void Paint_DrawPoint_W(PAINT *P, const PAINT_WRITER *W, UWORD Xpoint, UWORD Ypoint, UWORD Color,
+                             DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_Style)
+{
+    int Xstart, Ystart, Y;
+    int Xend = Xpoint + Dot_Pixel - 1;
+    int Yend = Ypoint + Dot_Pixel - 1;
+
+    // Circles pass points left of or above the image as wrapped UWORDs
+    if (Xpoint > P->Width || Ypoint > P->Height)
+        return;
+    if (Dot_Style == DOT_FILL_AROUND) {
+        // A (2 * Dot_Pixel - 1) square up and left of the point; nothing
+        // is drawn when it would cross the top edge, only the columns
+        // right of the edge when it crosses the left one
+        Xstart = Xpoint - Dot_Pixel;
+        Ystart = Ypoint - Dot_Pixel;
+        if (Ystart < 0)
+            return;
+        if (Xstart < 0)
+            Xstart = 0;
+    } else {
+        Xstart = Xpoint - 1;
+        Ystart = Ypoint - 1;
+        if (Xstart < 0)
+            Xstart = 0;
+        if (Ystart < 0)
+            Ystart = 0;
+    }
+    for (Y = Ystart; Y < Yend; Y++)
+        W->HSpan(P, Xstart, Xend, Y, Color);
+}
+
+void Paint_DrawPoint_r(PAINT *P, UWORD Xpoint, UWORD Ypoint, UWORD Color,
+                       DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_Style)
 {
-    if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
+    if (Xpoint > P->Width || Ypoint > P->Height) {
         Debug("Paint_DrawPoint Input exceeds the normal display range\r\n");
         return;
     }
+    Paint_DrawPoint_W(P, Paint_GetWriter(P), Xpoint, Ypoint, Color, Dot_Pixel, Dot_Style);
+}
 
-    int16_t XDir_Num , YDir_Num;
-    if (Dot_Style == DOT_FILL_AROUND) {
-        for (XDir_Num = 0; XDir_Num < 2 * Dot_Pixel - 1; XDir_Num++) {
-            for (YDir_Num = 0; YDir_Num < 2 * Dot_Pixel - 1; YDir_Num++) {
-                if(Xpoint + XDir_Num - Dot_Pixel < 0 || Ypoint + YDir_Num - Dot_Pixel < 0)
-                    break;
-                // printf("x = %d, y = %d\r\n", Xpoint + XDir_Num - Dot_Pixel, Ypoint + YDir_Num - Dot_Pixel);
-                Paint_SetPixel(Xpoint + XDir_Num - Dot_Pixel, Ypoint + YDir_Num - Dot_Pixel, Color);
-            }
-        }
-    } else {
-        for (XDir_Num = 0; XDir_Num <  Dot_Pixel; XDir_Num++) {
-            for (YDir_Num = 0; YDir_Num <  Dot_Pixel; YDir_Num++) {
-                Paint_SetPixel(Xpoint + XDir_Num - 1, Ypoint + YDir_Num - 1, Color);
-            }
-        }
+/******************************************************************************
+Thick solid lines as spans
+    Every point of a line covers the same (2 * Line_width - 1) square as
+    Paint_DrawPoint(), so each pixel used to be written up to that many
+    times over. The points of one line row are merged first, then the
+    squares of consecutive rows are merged into one span per image row.
+    An image row is written once no later point can widen it; at most
+    2 * Line_width - 1 rows are open at a time.
+******************************************************************************/
+#define PAINT_LINE_RING     16      // open rows, at least 2 * DOT_PIXEL_8X8 - 1
+
+typedef struct {
+    PAINT *P;
+    const PAINT_WRITER *W;
+    UWORD Color;
+    int Width;                      // Line_width
+    int Dir;                        // 1: rows are walked downwards, -1: upwards
+    int Next;                       // first image row not written yet
+    int Far;                        // last image row opened
+    int Row, RowLo, RowHi;          // line row being collected
+    int Lo[PAINT_LINE_RING];        // open image rows, pixels Lo..Hi-1
+    int Hi[PAINT_LINE_RING];
+} PAINT_LINE_SPANS;
+
+// Write the open image rows before Until, in walk order
+static void Paint_LineFlush(PAINT_LINE_SPANS *L, int Until)
+{
+    while ((Until - L->Next) * L->Dir > 0) {
+        int i = L->Next & (PAINT_LINE_RING - 1);
+        if (L->Lo[i] < L->Hi[i])
+            L->W->HSpan(L->P, L->Lo[i], L->Hi[i], L->Next, L->Color);
+        L->Next += L->Dir;
+    }
+}
+
+// Add the squares of the points Lo..Hi of line row Y
+static void Paint_LineRow(PAINT_LINE_SPANS *L, int Y, int Lo, int Hi)
+{
+    int d = L->Width;
+    int r;
+
+    // Rows Y - d .. Y + d - 2 are covered; the ones behind are final
+    Paint_LineFlush(L, (L->Dir > 0)? Y - d : Y + d - 2);
+    for (r = (L->Dir > 0)? Y + d - 2 : Y - d; (r - L->Far) * L->Dir > 0; ) {
+        L->Far += L->Dir;
+        L->Lo[L->Far & (PAINT_LINE_RING - 1)] = 0x7FFF;
+        L->Hi[L->Far & (PAINT_LINE_RING - 1)] = 0;
+    }
+
+    // Same clipping as Paint_DrawPoint()
+    if (Y < d)
+        return;
+    Lo -= d;
+    Hi += d - 1;
+    if (Lo < 0)
+        Lo = 0;
+    if (Lo >= Hi)
+        return;
+    for (r = Y - d; r <= Y + d - 2; r++) {
+        int i = r & (PAINT_LINE_RING - 1);
+        if (Lo < L->Lo[i])
+            L->Lo[i] = Lo;
+        if (Hi > L->Hi[i])
+            L->Hi[i] = Hi;
+    }
+}
+
+static void Paint_LineBegin(PAINT *P, PAINT_LINE_SPANS *L, const PAINT_WRITER *W, UWORD Color,
+                            int Width, int Ystart, int Dir)
+{
+    L->P = P;
+    L->W = W;
+    L->Color = Color;
+    L->Width = Width;
+    L->Dir = Dir;
+    L->Next = (Dir > 0)? Ystart - Width : Ystart + Width - 2;
+    L->Far = L->Next - Dir;
+    L->Row = -1;
+}
+
+static void Paint_LinePoint(PAINT_LINE_SPANS *L, int Xpoint, int Ypoint)
+{
+    if (Ypoint != L->Row) {
+        if (L->Row >= 0)
+            Paint_LineRow(L, L->Row, L->RowLo, L->RowHi);
+        L->Row = Ypoint;
+        L->RowLo = L->RowHi = Xpoint;
+    } else if (Xpoint < L->RowLo) {
+        L->RowLo = Xpoint;
+    } else if (Xpoint > L->RowHi) {
+        L->RowHi = Xpoint;
     }
 }
 
+static void Paint_LineEnd(PAINT_LINE_SPANS *L)
+{
+    Paint_LineRow(L, L->Row, L->RowLo, L->RowHi);
+    Paint_LineFlush(L, L->Far + L->Dir);
+}
+
 /******************************************************************************
 function: Draw a line of arbitrary slope
 parameter:
@@ -355,11 +875,11 @@ parameter:
     Line_width : Line width
     Line_Style: Solid and dotted lines
 ******************************************************************************/
-void Paint_DrawLine(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
-                    UWORD Color, DOT_PIXEL Line_width, LINE_STYLE Line_Style)
+void Paint_DrawLine_r(PAINT *P, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+                      UWORD Color, DOT_PIXEL Line_width, LINE_STYLE Line_Style)
 {
-    if (Xstart > Paint.Width || Ystart > Paint.Height ||
-        Xend > Paint.Width || Yend > Paint.Height) {
+    if (Xstart > P->Width || Ystart > P->Height ||
+        Xend > P->Width || Yend > P->Height) {
         Debug("Paint_DrawLine Input exceeds the normal display range\r\n");
         return;
     }
@@ -376,16 +896,23 @@ void Paint_DrawLine(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
     //Cumulative error
     int Esp = dx + dy;
     char Dotted_Len = 0;
+    const PAINT_WRITER *W = Paint_GetWriter(P);
+    PAINT_LINE_SPANS Spans;
+    UBYTE UseSpans = (Line_Style == LINE_STYLE_SOLID && Line_width >= DOT_PIXEL_1X1 && Line_width <= DOT_PIXEL_8X8);
 
+    if (UseSpans)
+        Paint_LineBegin(P, &Spans, W, Color, Line_width, Ystart, YAddway);
     for (;;) {
         Dotted_Len++;
-        //Painted dotted line, 2 point is really virtual
-        if (Line_Style == LINE_STYLE_DOTTED && Dotted_Len % 3 == 0) {
+        if (UseSpans) {
+            Paint_LinePoint(&Spans, Xpoint, Ypoint);
+        } else if (Line_Style == LINE_STYLE_DOTTED && Dotted_Len % 3 == 0) {
+            //Painted dotted line, 2 point is really virtual
             //Debug("LINE_DOTTED\r\n");
-            Paint_DrawPoint(Xpoint, Ypoint, IMAGE_BACKGROUND, Line_width, DOT_STYLE_DFT);
+            Paint_DrawPoint_W(P, W, Xpoint, Ypoint, IMAGE_BACKGROUND, Line_width, DOT_STYLE_DFT);
             Dotted_Len = 0;
         } else {
-            Paint_DrawPoint(Xpoint, Ypoint, Color, Line_width, DOT_STYLE_DFT);
+            Paint_DrawPoint_W(P, W, Xpoint, Ypoint, Color, Line_width, DOT_STYLE_DFT);
         }
         if (2 * Esp >= dy) {
             if (Xpoint == Xend)
@@ -400,6 +927,8 @@ void Paint_DrawLine(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
             Ypoint += YAddway;
         }
     }
+    if (UseSpans)
+        Paint_LineEnd(&Spans);
 }
 
 /******************************************************************************
@@ -413,28 +942,58 @@ parameter:
     Line_width: Line width
     Draw_Fill : Whether to fill the inside of the rectangle
 ******************************************************************************/
-void Paint_DrawRectangle(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
-                         UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+void Paint_DrawRectangle_r(PAINT *P, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+                           UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
 {
-    if (Xstart > Paint.Width || Ystart > Paint.Height ||
-        Xend > Paint.Width || Yend > Paint.Height) {
+    if (Xstart > P->Width || Ystart > P->Height ||
+        Xend > P->Width || Yend > P->Height) {
         Debug("Input exceeds the normal display range\r\n");
         return;
     }
 
     if (Draw_Fill) {
-        UWORD Ypoint;
-        for(Ypoint = Ystart; Ypoint < Yend; Ypoint++) {
-            Paint_DrawLine(Xstart, Ypoint, Xend, Ypoint, Color , Line_width, LINE_STYLE_SOLID);
+        // Same pixels as a Line_width line on every row from Ystart to
+        // Yend - 1, drawn as one span per row
+        const PAINT_WRITER *W = Paint_GetWriter(P);
+        int Xmin = (Xstart < Xend)? Xstart : Xend;
+        int Xmax = (Xstart < Xend)? Xend : Xstart;
+        int Yfirst = (Ystart > Line_width)? Ystart : (int)Line_width;
+        int Ypoint;
+        Xmin -= Line_width;
+        if (Xmin < 0)
+            Xmin = 0;
+        if (Yfirst >= Yend)
+            return;
+        for(Ypoint = Yfirst - Line_width; Ypoint < (int)Yend + Line_width - 2; Ypoint++) {
+            W->HSpan(P, Xmin, Xmax + Line_width - 1, Ypoint, Color);
         }
     } else {
-        Paint_DrawLine(Xstart, Ystart, Xend, Ystart, Color, Line_width, LINE_STYLE_SOLID);
-        Paint_DrawLine(Xstart, Ystart, Xstart, Yend, Color, Line_width, LINE_STYLE_SOLID);
-        Paint_DrawLine(Xend, Yend, Xend, Ystart, Color, Line_width, LINE_STYLE_SOLID);
-        Paint_DrawLine(Xend, Yend, Xstart, Yend, Color, Line_width, LINE_STYLE_SOLID);
+        Paint_DrawLine_r(P, Xstart, Ystart, Xend, Ystart, Color, Line_width, LINE_STYLE_SOLID);
+        Paint_DrawLine_r(P, Xstart, Ystart, Xstart, Yend, Color, Line_width, LINE_STYLE_SOLID);
+        Paint_DrawLine_r(P, Xend, Yend, Xend, Ystart, Color, Line_width, LINE_STYLE_SOLID);
+        Paint_DrawLine_r(P, Xend, Yend, Xstart, Yend, Color, Line_width, LINE_STYLE_SOLID);
     }
 }
 
+// Rows Y_Center + t and Y_Center - t of a filled circle, points
+// X_Center - Half .. X_Center + Half drawn as 1x1 Paint_DrawPoint()s
+static void Paint_CircleRow(PAINT *P, const PAINT_WRITER *W, int X_Center, int Y_Center, int t, int Half, UWORD Color)
+{
+    // A 1x1 point at X, Y sets pixel X - 1, Y - 1, nothing at X or Y 0
+    int Xstart = X_Center - Half;
+    int Xend = X_Center + Half;
+    if (Xstart < 1)
+        Xstart = 1;
+    if (Xend > P->Width)
+        Xend = P->Width;
+    if (Xstart > Xend)
+        return;
+    if (Y_Center + t >= 1 && Y_Center + t <= P->Height)
+        W->HSpan(P, Xstart - 1, Xend, Y_Center + t - 1, Color);
+    if (t > 0 && Y_Center - t >= 1)
+        W->HSpan(P, Xstart - 1, Xend, Y_Center - t - 1, Color);
+}
+
 /******************************************************************************
 function: Use the 8-point method to draw a circle of the
             specified size at the specified position->
@@ -446,10 +1005,10 @@ parameter:
     Line_width: Line width
     Draw_Fill : Whether to fill the inside of the Circle
 ******************************************************************************/
-void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius,
-                      UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+void Paint_DrawCircle_r(PAINT *P, UWORD X_Center, UWORD Y_Center, UWORD Radius,
+                        UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
 {
-    if (X_Center > Paint.Width || Y_Center >= Paint.Height) {
+    if (X_Center > P->Width || Y_Center >= P->Height) {
         Debug("Paint_DrawCircle Input exceeds the normal display range\r\n");
         return;
     }
@@ -463,36 +1022,36 @@ void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius,
     int16_t Esp = 3 - (Radius << 1 );
 
     int16_t sCountY;
+    const PAINT_WRITER *W = Paint_GetWriter(P);
     if (Draw_Fill == DRAW_FILL_FULL) {
+        // The points of the eight octants, filled in from XCurrent to
+        // YCurrent, cover every row Y_Center +- t from X_Center - Half to
+        // X_Center + Half: Half is YCurrent at the step where XCurrent is
+        // t, and for the rows beyond the last step, the last XCurrent
+        // whose YCurrent reached them. Each row is written as one span.
         while (XCurrent <= YCurrent ) { //Realistic circles
-            for (sCountY = XCurrent; sCountY <= YCurrent; sCountY ++ ) {
-                Paint_DrawPoint(X_Center + XCurrent, Y_Center + sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//1
-                Paint_DrawPoint(X_Center - XCurrent, Y_Center + sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//2
-                Paint_DrawPoint(X_Center - sCountY, Y_Center + XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//3
-                Paint_DrawPoint(X_Center - sCountY, Y_Center - XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//4
-                Paint_DrawPoint(X_Center - XCurrent, Y_Center - sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//5
-                Paint_DrawPoint(X_Center + XCurrent, Y_Center - sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//6
-                Paint_DrawPoint(X_Center + sCountY, Y_Center - XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//7
-                Paint_DrawPoint(X_Center + sCountY, Y_Center + XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-            }
+            int16_t YPrevious = YCurrent;
+            Paint_CircleRow(P, W, X_Center, Y_Center, XCurrent, YCurrent, Color);
             if (Esp < 0 )
                 Esp += 4 * XCurrent + 6;
             else {
                 Esp += 10 + 4 * (XCurrent - YCurrent );
                 YCurrent --;
             }
+            for (sCountY = YPrevious; sCountY > YCurrent && sCountY > XCurrent; sCountY--)
+                Paint_CircleRow(P, W, X_Center, Y_Center, sCountY, XCurrent, Color);
             XCurrent ++;
         }
     } else { //Draw a hollow circle
         while (XCurrent <= YCurrent ) {
-            Paint_DrawPoint(X_Center + XCurrent, Y_Center + YCurrent, Color, Line_width, DOT_STYLE_DFT);//1
-            Paint_DrawPoint(X_Center - XCurrent, Y_Center + YCurrent, Color, Line_width, DOT_STYLE_DFT);//2
-            Paint_DrawPoint(X_Center - YCurrent, Y_Center + XCurrent, Color, Line_width, DOT_STYLE_DFT);//3
-            Paint_DrawPoint(X_Center - YCurrent, Y_Center - XCurrent, Color, Line_width, DOT_STYLE_DFT);//4
-            Paint_DrawPoint(X_Center - XCurrent, Y_Center - YCurrent, Color, Line_width, DOT_STYLE_DFT);//5
-            Paint_DrawPoint(X_Center + XCurrent, Y_Center - YCurrent, Color, Line_width, DOT_STYLE_DFT);//6
-            Paint_DrawPoint(X_Center + YCurrent, Y_Center - XCurrent, Color, Line_width, DOT_STYLE_DFT);//7
-            Paint_DrawPoint(X_Center + YCurrent, Y_Center + XCurrent, Color, Line_width, DOT_STYLE_DFT);//0
+            Paint_DrawPoint_W(P, W, X_Center + XCurrent, Y_Center + YCurrent, Color, Line_width, DOT_STYLE_DFT);//1
+            Paint_DrawPoint_W(P, W, X_Center - XCurrent, Y_Center + YCurrent, Color, Line_width, DOT_STYLE_DFT);//2
+            Paint_DrawPoint_W(P, W, X_Center - YCurrent, Y_Center + XCurrent, Color, Line_width, DOT_STYLE_DFT);//3
+            Paint_DrawPoint_W(P, W, X_Center - YCurrent, Y_Center - XCurrent, Color, Line_width, DOT_STYLE_DFT);//4
+            Paint_DrawPoint_W(P, W, X_Center - XCurrent, Y_Center - YCurrent, Color, Line_width, DOT_STYLE_DFT);//5
+            Paint_DrawPoint_W(P, W, X_Center + XCurrent, Y_Center - YCurrent, Color, Line_width, DOT_STYLE_DFT);//6
+            Paint_DrawPoint_W(P, W, X_Center + YCurrent, Y_Center - XCurrent, Color, Line_width, DOT_STYLE_DFT);//7
+            Paint_DrawPoint_W(P, W, X_Center + YCurrent, Y_Center + XCurrent, Color, Line_width, DOT_STYLE_DFT);//0
 
             if (Esp < 0 )
                 Esp += 4 * XCurrent + 6;
@@ -505,6 +1064,500 @@ void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius,
     }
 }
 
+/******************************************************************************
+Filled polygons
+    Scanline fill with an edge table and an active edge table. The edges
+    are sorted by their top row once; going down the rows, edges enter the
+    active table at their top and leave it at their bottom, and the active
+    edges, kept in X order, give the spans of the row. X is stepped
+    exactly, as a whole part and a remainder over the edge's height.
+    A pixel is inside if its top left corner is, so edges shared by two
+    polygons are drawn once. Only the rows of the band are walked. The
+    tables have a fixed size, about 7 KB.
+******************************************************************************/
+#define PAINT_POLYGON_EDGES     1024    // vertices of one polygon
+#define PAINT_POLYGON_ACTIVE    256     // edges crossing one row
+
+typedef struct {
+    int32_t X;                  // edge at the current row: X + Rem / Dy
+    int32_t Step;               // per row: Step + RemStep / Dy
+    UWORD Rem;
+    UWORD RemStep;
+    UWORD Dy;                   // height in rows
+    UWORD Yend;                 // first row below the edge
+    int8_t Dir;                 // 1 downwards, -1 upwards
+} PAINT_EDGE;
+
+static PAINT_LOCAL UWORD Paint_EdgeTable[PAINT_POLYGON_EDGES];
+static PAINT_LOCAL PAINT_EDGE Paint_ActiveEdges[PAINT_POLYGON_ACTIVE];
+
+// Top row of edge i, from Points[i] to the next vertex
+static inline UWORD Paint_EdgeTop(const PAINT_POINT *Points, UWORD Count, UWORD i)
+{
+    UWORD Y0 = Points[i].Y, Y1 = Points[(i + 1 < Count)? i + 1 : 0].Y;
+    return (Y0 < Y1)? Y0 : Y1;
+}
+
+static void Paint_EdgeSift(const PAINT_POINT *Points, UWORD Count, UWORD *Table, UWORD Root, UWORD N)
+{
+    for (UWORD Child = 2 * Root + 1; Child < N; Root = Child, Child = 2 * Root + 1) {
+        if (Child + 1 < N && Paint_EdgeTop(Points, Count, Table[Child]) < Paint_EdgeTop(Points, Count, Table[Child + 1]))
+            Child++;
+        if (Paint_EdgeTop(Points, Count, Table[Root]) >= Paint_EdgeTop(Points, Count, Table[Child]))
+            return;
+        UWORD t = Table[Root];
+        Table[Root] = Table[Child];
+        Table[Child] = t;
+    }
+}
+
+// Activate edge i at row Y, anywhere between its top and bottom
+static void Paint_EdgeStart(PAINT_EDGE *E, const PAINT_POINT *Points, UWORD Count, UWORD i, UWORD Y)
+{
+    PAINT_POINT A = Points[i], B = Points[(i + 1 < Count)? i + 1 : 0];
+    E->Dir = 1;
+    if (A.Y > B.Y) {
+        PAINT_POINT t = A;
+        A = B;
+        B = t;
+        E->Dir = -1;
+    }
+    int32_t Dx = (int32_t)B.X - A.X;
+    E->Dy = B.Y - A.Y;
+    E->Yend = B.Y;
+    E->Step = (Dx >= 0)? Dx / E->Dy : -((-Dx + E->Dy - 1) / E->Dy);
+    E->RemStep = Dx - E->Step * E->Dy;
+
+    // X at row Y: A.X + Dx * (Y - A.Y) / Dy, rounded down
+    int64_t Num = (int64_t)Dx * (Y - A.Y);
+    int64_t Whole = (Num >= 0)? Num / E->Dy : -((-Num + E->Dy - 1) / E->Dy);
+    E->X = A.X + (int32_t)Whole;
+    E->Rem = (UWORD)(Num - Whole * E->Dy);
+}
+
+/******************************************************************************
+function: Fill a polygon
+parameter:
+    Points    : Vertices in order; the last one is joined to the first
+    Count     : Number of vertices, at most PAINT_POLYGON_EDGES
+    Color     : Fill color
+    Fill_Rule : FILL_EVEN_ODD: a point is inside if a ray from it crosses
+                the outline an odd number of times
+                FILL_NONZERO: inside if the outline winds around it, so
+                overlapping parts of a self-intersecting outline are filled
+info:
+    Pixels X, Y with the point X, Y inside are set: the square with corners
+    0, 0 and 10, 10 fills 10 x 10 pixels. Draw the outline with
+    Paint_DrawLine() if it is wanted. A row crossed by more than
+    PAINT_POLYGON_ACTIVE edges ends the fill there.
+******************************************************************************/
+void Paint_DrawPolygon_r(PAINT *P, const PAINT_POINT *Points, UWORD Count, UWORD Color, FILL_RULE Fill_Rule)
+{
+    UWORD *Table = Paint_EdgeTable;
+    PAINT_EDGE *Active = Paint_ActiveEdges;
+    UWORD Edges = 0, Live = 0, Next = 0;
+    UWORD Top = 0xFFFF, Bottom = 0;
+    UWORD Xstart, Ystart, Xend, Yend;
+
+    if (Count < 3)
+        return;
+    if (Count > PAINT_POLYGON_EDGES) {
+        LOG_W("Polygon of %u vertices, at most %u\r\n", (unsigned)Count, (unsigned)PAINT_POLYGON_EDGES);
+        return;
+    }
+
+    // Edge table of the edges reaching the band's rows, sorted by top
+    // row; horizontal edges add nothing
+    Paint_GetBandWindow_r(P, &Xstart, &Ystart, &Xend, &Yend);
+    for (UWORD i = 0; i < Count; i++) {
+        UWORD Y0 = Points[i].Y, Y1 = Points[(i + 1 < Count)? i + 1 : 0].Y;
+        UWORD Ya = (Y0 < Y1)? Y0 : Y1, Yb = (Y0 < Y1)? Y1 : Y0;
+        if (Ya == Yb || Yb <= Ystart || Ya >= Yend)
+            continue;
+        Table[Edges++] = i;
+        if (Ya < Top)
+            Top = Ya;
+        if (Yb > Bottom)
+            Bottom = Yb;
+    }
+    if (Edges == 0)
+        return;
+    for (UWORD i = Edges / 2; i > 0; i--)
+        Paint_EdgeSift(Points, Count, Table, i - 1, Edges);
+    for (UWORD n = Edges - 1; n > 0; n--) {
+        UWORD t = Table[0];
+        Table[0] = Table[n];
+        Table[n] = t;
+        Paint_EdgeSift(Points, Count, Table, 0, n);
+    }
+
+    if (Ystart > Top)
+        Top = Ystart;
+    if (Yend < Bottom)
+        Bottom = Yend;
+
+    const PAINT_WRITER *W = Paint_GetWriter(P);
+    for (UWORD Y = Top; Y < Bottom; Y++) {
+        UWORD Kept = 0;
+        for (UWORD a = 0; a < Live; a++) {
+            if (Active[a].Yend > Y)
+                Active[Kept++] = Active[a];
+        }
+        Live = Kept;
+        for (; Next < Edges && Paint_EdgeTop(Points, Count, Table[Next]) <= Y; Next++) {
+            PAINT_EDGE E;
+            Paint_EdgeStart(&E, Points, Count, Table[Next], Y);
+            if (E.Yend <= Y)
+                continue;           // ended above the band
+            if (Live == PAINT_POLYGON_ACTIVE) {
+                LOG_W("Polygon: more than %u edges cross row %u\r\n", (unsigned)PAINT_POLYGON_ACTIVE, (unsigned)Y);
+                return;
+            }
+            Active[Live++] = E;
+        }
+
+        // X order changes only where edges cross: insertion sort
+        for (UWORD a = 1; a < Live; a++) {
+            PAINT_EDGE E = Active[a];
+            int32_t Key = E.X + (E.Rem > 0);
+            UWORD b = a;
+            for (; b > 0 && Active[b - 1].X + (Active[b - 1].Rem > 0) > Key; b--)
+                Active[b] = Active[b - 1];
+            Active[b] = E;
+        }
+
+        int Wind = 0;
+        int32_t Xin = 0;
+        for (UWORD a = 0; a < Live; a++) {
+            PAINT_EDGE *E = &Active[a];
+            int32_t X = E->X + (E->Rem > 0);
+            UBYTE Was = (Fill_Rule == FILL_NONZERO)? Wind != 0 : Wind & 1;
+            Wind += E->Dir;
+            UBYTE Is = (Fill_Rule == FILL_NONZERO)? Wind != 0 : Wind & 1;
+            if (!Was && Is) {
+                Xin = X;
+            } else if (Was && !Is) {
+                if (Xin < Xstart)
+                    Xin = Xstart;
+                if (X > Xend)
+                    X = Xend;
+                if (Xin < X)
+                    W->HSpan(P, Xin, X, Y, Color);
+            }
+
+            UDOUBLE Rem = (UDOUBLE)E->Rem + E->RemStep;
+            E->X += E->Step;
+            if (Rem >= E->Dy) {
+                Rem -= E->Dy;
+                E->X++;
+            }
+            E->Rem = Rem;
+        }
+    }
+}
+
+/******************************************************************************
+Glyph blitter
+    A glyph is drawn row by row in memory orientation: each font byte is
+    expanded to a mask of destination bytes through a table and merged
+    with the foreground and background colors, instead of one bit test and
+    one writer call per pixel. At 0 degrees without mirror the font table
+    is already in memory orientation; otherwise the glyph is transformed
+    once and kept in a small cache keyed by glyph, rotation and mirror.
+    Packed glyphs (FONT_PACKED) are expanded into the same cache.
+******************************************************************************/
+#define PAINT_GLYPH_CACHE   32      // entries, the least recently used one is replaced
+#define PAINT_GLYPH_BYTES   (((MAX_HEIGHT_FONT + 7) / 8) * MAX_WIDTH_FONT)
+
+typedef struct {
+    const UBYTE *Glyph;         // font table entry, NULL if unused
+    UWORD Width;                // glyph size in the font
+    UWORD Height;
+    UWORD Rotate;
+    UWORD Mirror;
+    UDOUBLE Used;               // Paint_GlyphClock when last used
+    UBYTE Bits[PAINT_GLYPH_BYTES];  // memory orientation, rows byte aligned
+} PAINT_GLYPH;
+
+static PAINT_LOCAL PAINT_GLYPH Paint_Glyphs[PAINT_GLYPH_CACHE];
+static PAINT_LOCAL UDOUBLE Paint_GlyphClock;
+
+// Memory position of image point X, Y, for any Rotate and Mirror; points
+// outside the image map outside the memory
+static void Paint_MapSigned(PAINT *P, int Xpoint, int Ypoint, int *X, int *Y)
+{
+    if (P->Rotate == ROTATE_90) {
+        *X = P->WidthMemory - Ypoint - 1;
+        *Y = Xpoint;
+    } else if (P->Rotate == ROTATE_180) {
+        *X = P->WidthMemory - Xpoint - 1;
+        *Y = P->HeightMemory - Ypoint - 1;
+    } else if (P->Rotate == ROTATE_270) {
+        *X = Ypoint;
+        *Y = P->HeightMemory - Xpoint - 1;
+    } else {
+        *X = Xpoint;
+        *Y = Ypoint;
+    }
+    if (P->Mirror & MIRROR_HORIZONTAL)
+        *X = P->WidthMemory - *X - 1;
+    if (P->Mirror & MIRROR_VERTICAL)
+        *Y = P->HeightMemory - *Y - 1;
+}
+
+// Memory rectangle X0..X1, Y0..Y1 (inclusive) of image rectangle
+// Xstart..Xend, Ystart..Yend (inclusive)
+static void Paint_MapRect(PAINT *P, int Xstart, int Ystart, int Xend, int Yend, int *X0, int *Y0, int *X1, int *Y1)
+{
+    int Xa, Ya, Xb, Yb;
+    Paint_MapSigned(P, Xstart, Ystart, &Xa, &Ya);
+    Paint_MapSigned(P, Xend, Yend, &Xb, &Yb);
+    *X0 = (Xa < Xb)? Xa : Xb;
+    *X1 = (Xa < Xb)? Xb : Xa;
+    *Y0 = (Ya < Yb)? Ya : Yb;
+    *Y1 = (Ya < Yb)? Yb : Ya;
+}
+
+// A FONT_PACKED glyph (tools/pack_fonts.py) expanded into the font table
+// layout, one box row at a time; NULL if it does not fit
+static const UBYTE *Paint_Unpack(const UBYTE *Packed, UWORD Width, UWORD Height)
+{
+    static PAINT_LOCAL UBYTE Bits[PAINT_GLYPH_BYTES];
+    UDOUBLE Box = ((UDOUBLE)Packed[0] << 16) | ((UDOUBLE)Packed[1] << 8) | Packed[2];
+    UWORD Top = Box >> 18, Rows = (Box >> 12) & 0x3F, Left = (Box >> 6) & 0x3F, Cols = Box & 0x3F;
+    UWORD Stride = (Width + 7) / 8;
+    const UBYTE *Src = Packed + 3;
+    UDOUBLE Pos = 0;
+
+    if ((UDOUBLE)Stride * Height > sizeof(Bits) || Stride > 4 || Top + Rows > Height ||
+        Cols > 25 || Left + Cols > Stride * 8)
+        return NULL;
+    memset(Bits, 0, Stride * Top);
+    memset(Bits + (Top + Rows) * Stride, 0, Stride * (Height - Top - Rows));
+
+    // Each box row from a 32 bit window on the packed bits, placed at Left;
+    // the tables end with 3 pad bytes so the window never reads past them
+    UDOUBLE Mask = ~(0xFFFFFFFFUL >> Cols);
+    UBYTE *Dst = Bits + Top * Stride;
+    for (UWORD Row = 0; Row < Rows; Row++, Pos += Cols, Dst += Stride) {
+        const UBYTE *P = Src + Pos / 8;
+        UDOUBLE Win = ((UDOUBLE)P[0] << 24) | ((UDOUBLE)P[1] << 16) | ((UDOUBLE)P[2] << 8) | P[3];
+        Win = ((Win << (Pos % 8)) & Mask) >> Left;
+        for (UWORD k = 0; k < Stride; k++)
+            Dst[k] = Win >> (24 - 8 * k);
+    }
+    return Bits;
+}
+
+// The glyph in memory orientation for the current Rotate and Mirror, NULL
+// if it is too large for the cache
+static const UBYTE *Paint_GetGlyph(PAINT *P, const UBYTE *Glyph, UBYTE Packed, UWORD Width, UWORD Height)
+{
+    PAINT_GLYPH *Entry = &Paint_Glyphs[0];
+    int X0, Y0, X1, Y1, X, Y;
+
+    Paint_GlyphClock++;
+    for (UBYTE i = 0; i < PAINT_GLYPH_CACHE; i++) {
+        PAINT_GLYPH *Cached = &Paint_Glyphs[i];
+        if (Cached->Glyph == Glyph && Cached->Width == Width && Cached->Height == Height &&
+            Cached->Rotate == P->Rotate && Cached->Mirror == P->Mirror) {
+            Cached->Used = Paint_GlyphClock;
+            return Cached->Bits;
+        }
+        if (Cached->Used < Entry->Used)
+            Entry = Cached;
+    }
+
+    Paint_MapRect(P, 0, 0, Width - 1, Height - 1, &X0, &Y0, &X1, &Y1);
+    UWORD Stride = (X1 - X0 + 8) / 8;
+    if ((UDOUBLE)Stride * (Y1 - Y0 + 1) > PAINT_GLYPH_BYTES)
+        return NULL;
+    const UBYTE *Src = Packed? Paint_Unpack(Glyph, Width, Height) : Glyph;
+    if (Src == NULL)
+        return NULL;
+
+    Entry->Glyph = Glyph;
+    Entry->Used = Paint_GlyphClock;
+    Entry->Width = Width;
+    Entry->Height = Height;
+    Entry->Rotate = P->Rotate;
+    Entry->Mirror = P->Mirror;
+    if (P->Rotate == ROTATE_0 && P->Mirror == MIRROR_NONE) {
+        memcpy(Entry->Bits, Src, (UDOUBLE)Stride * Height);
+        return Entry->Bits;
+    }
+    memset(Entry->Bits, 0, sizeof(Entry->Bits));
+
+    UWORD FontStride = (Width + 7) / 8;
+    for (UWORD Row = 0; Row < Height; Row++) {
+        for (UWORD Column = 0; Column < Width; Column++) {
+            if (Src[Row * FontStride + Column / 8] & (0x80 >> (Column % 8))) {
+                Paint_MapSigned(P, Column, Row, &X, &Y);
+                X -= X0;
+                Y -= Y0;
+                Entry->Bits[Y * Stride + X / 8] |= 0x80 >> (X % 8);
+            }
+        }
+    }
+    return Entry->Bits;
+}
+
+/******************************************************************************
+function: Drop the rotated copy of a glyph
+parameter:
+    Glyph : Glyph passed to Paint_DrawGlyph()
+info:       Rotated glyphs are cached by address. Call this before a buffer
+            that held a drawn glyph is filled with another one. With
+            PAINT_THREADS only the calling thread's cache is cleared.
+******************************************************************************/
+void Paint_ForgetGlyph(const UBYTE *Glyph)
+{
+    for (UBYTE i = 0; i < PAINT_GLYPH_CACHE; i++) {
+        if (Paint_Glyphs[i].Glyph == Glyph) {
+            Paint_Glyphs[i].Glyph = NULL;
+            Paint_Glyphs[i].Used = 0;
+        }
+    }
+}
+
+// Merge the glyph rows Y0..Y1, columns X0..X1 (memory positions, inside
+// the band) into the band. Glyph bit 0 of row 0 is at GX, GY. Transparent
+// glyphs only write their set bits, opaque ones write Bg for the others.
+template <UBYTE Scale>
+static void Paint_GlyphRows(PAINT *P, const UBYTE *Bits, UWORD Stride, int GX, int GY,
+                            int X0, int Y0, int X1, int Y1, UWORD Fg, UWORD Bg, UBYTE Opaque)
+{
+    const UBYTE Bpp = (Scale == 2)? 1 : (Scale == 4)? 2 : 4;
+    const UBYTE Ppb = 8 / Bpp;
+    UBYTE FgFill = Paint_FillByte<Scale>(Fg);
+    UBYTE BgFill = Paint_FillByte<Scale>(Bg);
+    int X = GX - P->BandX;
+    int Shift = ((X % Ppb) + Ppb) % Ppb;    // glyph bits before the first whole byte
+    int First = X0 - GX + Shift;            // aligned bits First..Last-1 are drawn
+    int Last = X1 + 1 - GX + Shift;
+    int K0 = First / 8, K1 = (Last - 1) / 8;
+    UBYTE CoverFirst = 0xFF >> (First - K0 * 8);
+    UBYTE CoverLast = 0xFF << (K1 * 8 + 8 - Last);
+    UBYTE *Row = P->Image + (UDOUBLE)(Y0 - P->BandY) * P->WidthByte + (X - Shift) / Ppb + K0 * Bpp;
+    const UBYTE *Src = Bits + (Y0 - GY) * Stride;
+
+    for (int Y = Y0; Y <= Y1; Y++, Row += P->WidthByte, Src += Stride) {
+        for (int k = K0; k <= K1; k++) {
+            // Aligned byte k holds glyph bits 8k - Shift .. 8k - Shift + 7
+            UBYTE Cover = ((k == K0)? CoverFirst : 0xFF) & ((k == K1)? CoverLast : 0xFF);
+            UBYTE Ink = (k < Stride)? Src[k] >> Shift : 0;
+            if (Shift && k > 0)
+                Ink |= Src[k - 1] << (8 - Shift);
+            Ink &= Cover;
+            if (!Opaque)
+                Cover = Ink;
+            if (!Cover)
+                continue;
+            PAINT_COUNTED(__builtin_popcount(Cover));
+
+            UBYTE *Dst = Row + (k - K0) * Bpp;
+            if (Scale == 2) {
+                Dst[0] = (Dst[0] & ~Cover) | (FgFill & Ink) | (BgFill & Cover & ~Ink);
+            } else {
+                UDOUBLE CoverMask = (Scale == 4)? Paint_Expand.Two[Cover] : Paint_Expand.Four[Cover];
+                UDOUBLE InkMask = (Scale == 4)? Paint_Expand.Two[Ink] : Paint_Expand.Four[Ink];
+                for (UBYTE j = 0; j < Bpp; j++) {
+                    UBYTE c = CoverMask >> ((Bpp - 1 - j) * 8);
+                    UBYTE m = InkMask >> ((Bpp - 1 - j) * 8);
+                    if (c)
+                        Dst[j] = (Dst[j] & ~c) | (FgFill & m) | (BgFill & c & ~m);
+                }
+            }
+        }
+    }
+}
+
+// Draw a glyph of a font table (Packed 0) or of a FONT_PACKED table
+static void Paint_BlitGlyph(PAINT *P, UWORD Xpoint, UWORD Ypoint, const UBYTE *Glyph, UBYTE Packed,
+                            UWORD Width, UWORD Height, UWORD Color_Foreground, UWORD Color_Background)
+{
+    const PAINT_WRITER *W = Paint_GetWriter(P);
+    const UBYTE *Bits;
+    UBYTE Opaque = (FONT_BACKGROUND != Color_Background);
+    int GX, GY, GX1, GY1, X0, Y0, X1, Y1;
+
+    if (W == &Paint_NoWriter || Width == 0 || Height == 0)
+        return;
+
+    // The whole glyph sets the memory position of its bits, the part
+    // inside the image and the band is drawn
+    Paint_MapRect(P, Xpoint, Ypoint, Xpoint + Width - 1, Ypoint + Height - 1, &GX, &GY, &GX1, &GY1);
+    int Xend = (Xpoint + Width < P->Width)? Xpoint + Width : P->Width;
+    int Yend = (Ypoint + Height < P->Height)? Ypoint + Height : P->Height;
+    if (Xpoint >= Xend || Ypoint >= Yend)
+        return;
+    if (Xend == Xpoint + Width && Yend == Ypoint + Height) {
+        X0 = GX; Y0 = GY; X1 = GX1; Y1 = GY1;
+    } else {
+        Paint_MapRect(P, Xpoint, Ypoint, Xend - 1, Yend - 1, &X0, &Y0, &X1, &Y1);
+    }
+    if (X0 < P->BandX)
+        X0 = P->BandX;
+    if (Y0 < P->BandY)
+        Y0 = P->BandY;
+    if (X1 >= P->BandX + P->BandWidth)
+        X1 = P->BandX + P->BandWidth - 1;
+    if (Y1 >= P->BandY + P->BandHeight)
+        Y1 = P->BandY + P->BandHeight - 1;
+    if (X1 >= P->WidthMemory)
+        X1 = P->WidthMemory - 1;
+    if (Y1 >= P->HeightMemory)
+        Y1 = P->HeightMemory - 1;
+    if (X0 > X1 || Y0 > Y1)
+        return;
+
+    if (P->Rotate != ROTATE_0 || P->Mirror != MIRROR_NONE)
+        Bits = Paint_GetGlyph(P, Glyph, Packed, Width, Height);
+    else
+        Bits = Packed? Paint_Unpack(Glyph, Width, Height) : Glyph;
+    if (Bits == NULL) {
+        // Too large to cache: one pixel at a time
+        const UBYTE *Src = Packed? Paint_Unpack(Glyph, Width, Height) : Glyph;
+        UWORD FontStride = (Width + 7) / 8;
+        if (Src == NULL)
+            return;
+        for (UWORD Row = 0; Row < Height; Row++) {
+            for (UWORD Column = 0; Column < Width; Column++) {
+                if (Src[Row * FontStride + Column / 8] & (0x80 >> (Column % 8)))
+                    W->Pixel(P, Xpoint + Column, Ypoint + Row, Color_Foreground);
+                else if (Opaque)
+                    W->Pixel(P, Xpoint + Column, Ypoint + Row, Color_Background);
+            }
+        }
+        return;
+    }
+
+    UWORD Stride = (GX1 - GX + 8) / 8;
+    if (P->Scale == 2)
+        Paint_GlyphRows<2>(P, Bits, Stride, GX, GY, X0, Y0, X1, Y1, Color_Foreground, Color_Background, Opaque);
+    else if (P->Scale == 4)
+        Paint_GlyphRows<4>(P, Bits, Stride, GX, GY, X0, Y0, X1, Y1, Color_Foreground, Color_Background, Opaque);
+    else if (P->Scale == 6)
+        Paint_GlyphRows<6>(P, Bits, Stride, GX, GY, X0, Y0, X1, Y1, Color_Foreground, Color_Background, Opaque);
+    else
+        Paint_GlyphRows<7>(P, Bits, Stride, GX, GY, X0, Y0, X1, Y1, Color_Foreground, Color_Background, Opaque);
+}
+
+/******************************************************************************
+function: Draw a 1bpp glyph, rows byte aligned, MSB first
+parameter:
+    Xpoint, Ypoint : Top left corner
+    Glyph          : Font table entry, or a buffer (see Paint_ForgetGlyph())
+    Width, Height  : Glyph size
+    Color_Foreground : Color of the set bits
+    Color_Background : Color of the other bits, FONT_BACKGROUND leaves them
+******************************************************************************/
+void Paint_DrawGlyph_r(PAINT *P, UWORD Xpoint, UWORD Ypoint, const UBYTE *Glyph, UWORD Width, UWORD Height,
+                       UWORD Color_Foreground, UWORD Color_Background)
+{
+    Paint_BlitGlyph(P, Xpoint, Ypoint, Glyph, 0, Width, Height, Color_Foreground, Color_Background);
+}
+
 /******************************************************************************
 function: Show English characters
 parameter:
@@ -515,43 +1568,24 @@ parameter:
     Color_Foreground : Select the foreground color
     Color_Background : Select the background color
 ******************************************************************************/
-void Paint_DrawChar(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
-                    sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+void Paint_DrawChar_r(PAINT *P, UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
+                      sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
 {
-    UWORD Page, Column;
-
-    if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
+    if (Xpoint > P->Width || Ypoint > P->Height) {
         Debug("Paint_DrawChar Input exceeds the normal display range\r\n");
         return;
     }
 
+    if (Font->table == NULL) {
+        Paint_BlitGlyph(P, Xpoint, Ypoint, Font->packed + Font->offsets[Acsii_Char - ' '], 1,
+                        Font->Width, Font->Height, Color_Foreground, Color_Background);
+        return;
+    }
+
     uint32_t Char_Offset = (Acsii_Char - ' ') * Font->Height * (Font->Width / 8 + (Font->Width % 8 ? 1 : 0));
     const unsigned char *ptr = &Font->table[Char_Offset];
 
-    for (Page = 0; Page < Font->Height; Page ++ ) {
-        for (Column = 0; Column < Font->Width; Column ++ ) {
-
-            //To determine whether the font background color and screen background color is consistent
-            if (FONT_BACKGROUND == Color_Background) { //this process is to speed up the scan
-                if (*ptr & (0x80 >> (Column % 8)))
-                    Paint_SetPixel(Xpoint + Column, Ypoint + Page, Color_Foreground);
-                    // Paint_DrawPoint(Xpoint + Column, Ypoint + Page, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-            } else {
-                if (*ptr & (0x80 >> (Column % 8))) {
-                    Paint_SetPixel(Xpoint + Column, Ypoint + Page, Color_Foreground);
-                    // Paint_DrawPoint(Xpoint + Column, Ypoint + Page, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                } else {
-                    Paint_SetPixel(Xpoint + Column, Ypoint + Page, Color_Background);
-                    // Paint_DrawPoint(Xpoint + Column, Ypoint + Page, Color_Background, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                }
-            }
-            //One pixel is 8 bits
-            if (Column % 8 == 7)
-                ptr++;
-        }// Write a line
-        if (Font->Width % 8 != 0)
-            ptr++;
-    }// Write all
+    Paint_DrawGlyph_r(P, Xpoint, Ypoint, ptr, Font->Width, Font->Height, Color_Foreground, Color_Background);
 }
 
 /******************************************************************************
@@ -564,30 +1598,30 @@ parameter:
     Color_Foreground : Select the foreground color
     Color_Background : Select the background color
 ******************************************************************************/
-void Paint_DrawString_EN(UWORD Xstart, UWORD Ystart, const char * pString,
-                         sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+void Paint_DrawString_EN_r(PAINT *P, UWORD Xstart, UWORD Ystart, const char * pString,
+                           sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
 {
     UWORD Xpoint = Xstart;
     UWORD Ypoint = Ystart;
 
-    if (Xstart > Paint.Width || Ystart > Paint.Height) {
+    if (Xstart > P->Width || Ystart > P->Height) {
         Debug("Paint_DrawString_EN Input exceeds the normal display range\r\n");
         return;
     }
 
     while (* pString != '\0') {
         //if X direction filled , reposition to(Xstart,Ypoint),Ypoint is Y direction plus the Height of the character
-        if ((Xpoint + Font->Width ) > Paint.Width ) {
+        if ((Xpoint + Font->Width ) > P->Width ) {
             Xpoint = Xstart;
             Ypoint += Font->Height;
         }
 
         // If the Y direction is full, reposition to(Xstart, Ystart)
-        if ((Ypoint  + Font->Height ) > Paint.Height ) {
+        if ((Ypoint  + Font->Height ) > P->Height ) {
             Xpoint = Xstart;
             Ypoint = Ystart;
         }
-        Paint_DrawChar(Xpoint, Ypoint, * pString, Font, Color_Background, Color_Foreground);
+        Paint_DrawChar_r(P, Xpoint, Ypoint, * pString, Font, Color_Background, Color_Foreground);
 
         //The next character of the address
         pString ++;
@@ -598,6 +1632,53 @@ void Paint_DrawString_EN(UWORD Xstart, UWORD Ystart, const char * pString,
 }
 
 
+/******************************************************************************
+function:   Table entry of the character at p_text, NULL if the font lacks it
+parameter:
+    font   : CN font
+    p_text : An ASCII byte or the 3 UTF-8 bytes of a Chinese character
+info:       Binary search in font->keys when the font has an index, else a
+            scan of the table. The first of equal entries wins either way.
+******************************************************************************/
+const CH_CN *Paint_FindCN(const cFONT *font, const char *p_text)
+{
+    UDOUBLE Key;
+    UWORD Num;
+
+    if ((*p_text & 0xFF) <= 0x7F) {
+        if (font->keys == NULL) {
+            for (Num = 0; Num < font->size; Num++)
+                if (*p_text == font->table[Num].index[0])
+                    return &font->table[Num];
+            return NULL;
+        }
+        Key = (UDOUBLE)(*p_text & 0xFF) << 16;
+    } else {
+        if (font->keys == NULL) {
+            for (Num = 0; Num < font->size; Num++)
+                if (((p_text[0] & 0xFF) == font->table[Num].index[0]) &&
+                    ((p_text[1] & 0xFF) == font->table[Num].index[1]) &&
+                    ((p_text[2] & 0xFF) == font->table[Num].index[2]))
+                    return &font->table[Num];
+            return NULL;
+        }
+        Key = ((UDOUBLE)(p_text[0] & 0xFF) << 16) | ((UDOUBLE)(p_text[1] & 0xFF) << 8) | (p_text[2] & 0xFF);
+    }
+
+    // Lower bound: the first key not below Key
+    UWORD Lo = 0, Hi = font->size;
+    while (Lo < Hi) {
+        UWORD Mid = (Lo + Hi) / 2;
+        if (font->keys[Mid].key < Key)
+            Lo = Mid + 1;
+        else
+            Hi = Mid;
+    }
+    if (Lo < font->size && font->keys[Lo].key == Key)
+        return &font->table[font->keys[Lo].entry];
+    return NULL;
+}
+
 /******************************************************************************
 function: Display the string
 parameter:
@@ -609,98 +1690,25 @@ parameter:
     Color_Foreground : Select the foreground color
     Color_Background : Select the background color
 ******************************************************************************/
-void Paint_DrawString_CN(UWORD Xstart, UWORD Ystart, const char * pString, cFONT* font,
-                        UWORD Color_Foreground, UWORD Color_Background)
+void Paint_DrawString_CN_r(PAINT *P, UWORD Xstart, UWORD Ystart, const char * pString, cFONT* font,
+                           UWORD Color_Foreground, UWORD Color_Background)
 {
     const char* p_text = pString;
     int x = Xstart, y = Ystart;
-    int i, j,Num;
-    // for (size_t i = 0; p_text[i] != 0; i++)
-    // {
-    //     Serial.println(*(p_text+i)&0xff, HEX);
-    //     Serial.println(i);
-    //      if((*(p_text+i)&0xff) <= 0x7F)
-    //      {
-    //         Serial.println("111111");
-    //      }
-    //      else{
-    //         Serial.println("222222");
-    //      }
-    // }
-    
+    const CH_CN *Glyph;
 
     /* Send the string character by character on EPD */
     while (*p_text != 0) {
+        Glyph = Paint_FindCN(font, p_text);
+        if (Glyph != NULL)
+            Paint_DrawGlyph_r(P, x, y, Glyph->matrix, font->Width, font->Height,
+                              Color_Foreground, Color_Background);
         if((*p_text&0xff) <= 0x7F) {  //ASCII < 126
-            for(Num = 0; Num < font->size; Num++) {
-                if(*p_text== font->table[Num].index[0]) {
-                    const unsigned char* ptr = &font->table[Num].matrix[0];
-
-                    for (j = 0; j < font->Height; j++) {
-                        for (i = 0; i < font->Width; i++) {
-                            if (FONT_BACKGROUND == Color_Background) { //this process is to speed up the scan
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            } else {
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                } else {
-                                    Paint_SetPixel(x + i, y + j, Color_Background);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Background, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            }
-                            if (i % 8 == 7) {
-                                ptr++;
-                            }
-                        }
-                        if (font->Width % 8 != 0) {
-                            ptr++;
-                        }
-                    }
-                    break;
-                }
-            }
             /* Point on the next character */
             p_text += 1;
             /* Decrement the column position by 16 */
             x += font->ASCII_Width;
         } else {        //Chinese
-            for(Num = 0; Num < font->size; Num++) {
-                if ((((*p_text)&0xFF) == font->table[Num].index[0]) && \
-                    (((*(p_text + 1))&0xFF) == font->table[Num].index[1]) && \
-                    (((*(p_text + 2))&0xFF) == font->table[Num].index[2])) {
-                    const unsigned char* ptr = &font->table[Num].matrix[0];
-
-                    for (j = 0; j < font->Height; j++) {
-                        for (i = 0; i < font->Width; i++) {
-                            if (FONT_BACKGROUND == Color_Background) { //this process is to speed up the scan
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            } else {
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                } else {
-                                    Paint_SetPixel(x + i, y + j, Color_Background);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Background, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            }
-                            if (i % 8 == 7) {
-                                ptr++;
-                            }
-                        }
-                        if (font->Width % 8 != 0) {
-                            ptr++;
-                        }
-                    }
-                    break;
-                }
-            }
             /* Point on the next character */
             p_text += 3;
             /* Decrement the column position by 16 */
@@ -720,15 +1728,15 @@ parameter:
     Color_Background : Select the background color
 ******************************************************************************/
 #define  ARRAY_LEN 255
-void Paint_DrawNum(UWORD Xpoint, UWORD Ypoint, int32_t Nummber,
-                   sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+void Paint_DrawNum_r(PAINT *P, UWORD Xpoint, UWORD Ypoint, int32_t Nummber,
+                     sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
 {
 
     int16_t Num_Bit = 0, Str_Bit = 0;
     uint8_t Str_Array[ARRAY_LEN] = {0}, Num_Array[ARRAY_LEN] = {0};
     uint8_t *pStr = Str_Array;
 
-    if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
+    if (Xpoint > P->Width || Ypoint > P->Height) {
         Debug("Paint_DisNum Input exceeds the normal display range\r\n");
         return;
     }
@@ -748,7 +1756,7 @@ void Paint_DrawNum(UWORD Xpoint, UWORD Ypoint, int32_t Nummber,
     }
 
     //show
-    Paint_DrawString_EN(Xpoint, Ypoint, (const char*)pStr, Font, Color_Background, Color_Foreground);
+    Paint_DrawString_EN_r(P, Xpoint, Ypoint, (const char*)pStr, Font, Color_Background, Color_Foreground);
 }
 
 /******************************************************************************
@@ -761,22 +1769,22 @@ parameter:
     Color_Foreground : Select the foreground color
     Color_Background : Select the background color
 ******************************************************************************/
-void Paint_DrawTime(UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT* Font,
-                    UWORD Color_Foreground, UWORD Color_Background)
+void Paint_DrawTime_r(PAINT *P, UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT* Font,
+                      UWORD Color_Foreground, UWORD Color_Background)
 {
     uint8_t value[10] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9'};
 
     UWORD Dx = Font->Width;
 
     //Write data into the cache
-    Paint_DrawChar(Xstart                           , Ystart, value[pTime->Hour / 10], Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx                      , Ystart, value[pTime->Hour % 10], Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx  + Dx / 4 + Dx / 2   , Ystart, ':'                    , Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx * 2 + Dx / 2         , Ystart, value[pTime->Min / 10] , Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx * 3 + Dx / 2         , Ystart, value[pTime->Min % 10] , Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx * 4 + Dx / 2 - Dx / 4, Ystart, ':'                    , Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx * 5                  , Ystart, value[pTime->Sec / 10] , Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx * 6                  , Ystart, value[pTime->Sec % 10] , Font, Color_Background, Color_Foreground);
+    Paint_DrawChar_r(P, Xstart                           , Ystart, value[pTime->Hour / 10], Font, Color_Background, Color_Foreground);
+    Paint_DrawChar_r(P, Xstart + Dx                      , Ystart, value[pTime->Hour % 10], Font, Color_Background, Color_Foreground);
+    Paint_DrawChar_r(P, Xstart + Dx  + Dx / 4 + Dx / 2   , Ystart, ':'                    , Font, Color_Background, Color_Foreground);
+    Paint_DrawChar_r(P, Xstart + Dx * 2 + Dx / 2         , Ystart, value[pTime->Min / 10] , Font, Color_Background, Color_Foreground);
+    Paint_DrawChar_r(P, Xstart + Dx * 3 + Dx / 2         , Ystart, value[pTime->Min % 10] , Font, Color_Background, Color_Foreground);
+    Paint_DrawChar_r(P, Xstart + Dx * 4 + Dx / 2 - Dx / 4, Ystart, ':'                    , Font, Color_Background, Color_Foreground);
+    Paint_DrawChar_r(P, Xstart + Dx * 5                  , Ystart, value[pTime->Sec / 10] , Font, Color_Background, Color_Foreground);
+    Paint_DrawChar_r(P, Xstart + Dx * 6                  , Ystart, value[pTime->Sec % 10] , Font, Color_Background, Color_Foreground);
 }
 
 /******************************************************************************
@@ -787,15 +1795,15 @@ info:
     Use a computer to convert the image into a corresponding array,
     and then embed the array directly into Imagedata.cpp as a .c file.
 ******************************************************************************/
-void Paint_DrawBitMap(const unsigned char* image_buffer)
+void Paint_DrawBitMap_r(PAINT *P, const unsigned char* image_buffer)
 {
     UWORD x, y;
     UDOUBLE Addr = 0;
 
-    for (y = 0; y < Paint.HeightByte; y++) {
-        for (x = 0; x < Paint.WidthByte; x++) {//8 pixel =  1 byte
-            Addr = x + y * Paint.WidthByte;
-            Paint.Image[Addr] = (unsigned char)image_buffer[Addr];
+    for (y = 0; y < P->HeightByte; y++) {
+        for (x = 0; x < P->WidthByte; x++) {//8 pixel =  1 byte
+            Addr = x + y * P->WidthByte;
+            P->Image[Addr] = (unsigned char)image_buffer[Addr];
         }
     }
 }
@@ -812,11 +1820,12 @@ parameter:
 info:
     Use this function to paste image data into a buffer
 ******************************************************************************/
-void Paint_DrawBitMap_Paste(const unsigned char* image_buffer, UWORD xStart, UWORD yStart, UWORD imageWidth, UWORD imageHeight, UBYTE flipColor)
+void Paint_DrawBitMap_Paste_r(PAINT *P, const unsigned char* image_buffer, UWORD xStart, UWORD yStart, UWORD imageWidth, UWORD imageHeight, UBYTE flipColor)
 {
     UBYTE color, srcImage;
     UWORD x, y;
     UWORD width = (imageWidth%8==0 ? imageWidth/8 : imageWidth/8+1);
+    PAINT_PIXEL SetPixel = Paint_GetWriter(P)->Pixel;
     
     for (y = 0; y < imageHeight; y++) {
         for (x = 0; x < imageWidth; x++) {
@@ -825,7 +1834,7 @@ void Paint_DrawBitMap_Paste(const unsigned char* image_buffer, UWORD xStart, UWO
                 color = (((srcImage<<(x%8) & 0x80) == 0) ? 1 : 0);
             else
                 color = (((srcImage<<(x%8) & 0x80) == 0) ? 0 : 1);
-            Paint_SetPixel(x+xStart, y+yStart, color);
+            SetPixel(P, x+xStart, y+yStart, color);
         }
     }
 }
@@ -839,17 +1848,323 @@ parameter:
     xEnd             ：Image width
     yEnd             : Image height
 ******************************************************************************/
-void Paint_DrawImage(const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image) 
+void Paint_DrawImage_r(PAINT *P, const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image) 
 {
     UWORD x, y;
 	UWORD w_byte=(W_Image%8)?(W_Image/8)+1:W_Image/8;
     UDOUBLE Addr = 0;
 	UDOUBLE pAddr = 0;
-    for (y = 0; y < H_Image; y++) {
-        for (x = 0; x < w_byte; x++) {//8 pixel =  1 byte
+    for (y = 0; y < H_Image && y + yStart < P->HeightByte; y++) {
+        for (x = 0; x < w_byte && x + xStart / 8 < P->WidthByte; x++) {//8 pixel =  1 byte
             Addr = x + y * w_byte;
-			pAddr=x+(xStart/8)+((y+yStart)*Paint.WidthByte);
-            Paint.Image[pAddr] = (unsigned char)image_buffer[Addr];
+			pAddr=x+(xStart/8)+((y+yStart)*P->WidthByte);
+            P->Image[pAddr] = (unsigned char)image_buffer[Addr];
+        }
+    }
+}
+
+/******************************************************************************
+4bpp blits
+    At 0 and 180 degrees on a 4bpp image (scale 6 or 7) every source row
+    lands in one memory row, forwards or backwards. Where source and
+    destination pixels sit in the same half of their bytes the whole bytes
+    are copied with memcpy; otherwise each destination byte is put together
+    from two source nibbles. Other settings go through the pixel writer.
+******************************************************************************/
+#define PAINT_REVERSE_CHUNK     64      // bytes of a reversed row done at once
+
+// Source pixel I of a 4bpp row
+static inline UBYTE Paint_Nibble(const UBYTE *Row, UWORD I)
+{
+    return (I % 2)? (Row[I / 2] & 0x0F) : (Row[I / 2] >> 4);
+}
+
+// Nibbles of Byte that are not Key
+static inline UBYTE Paint_KeyMask(UBYTE Byte, UWORD Key)
+{
+    return (((Byte >> 4) != Key)? 0xF0 : 0x00) | (((Byte & 0x0F) != Key)? 0x0F : 0x00);
+}
+
+// Copy N source pixels from Sx to destination pixel Dx, leaving out Key
+// (any value above 0x0F copies all of them)
+static void Paint_CopyNibbles(UBYTE *Dst, UWORD Dx, const UBYTE *Src, UWORD Sx, UWORD N, UWORD Key)
+{
+    if (N == 0)
+        return;
+    if (Dx % 2) {
+        UBYTE Pixel = Paint_Nibble(Src, Sx);
+        if (Pixel != Key)
+            Dst[Dx / 2] = (Dst[Dx / 2] & 0xF0) | Pixel;
+        Dx++;
+        Sx++;
+        N--;
+    }
+
+    UBYTE *Out = Dst + Dx / 2;
+    const UBYTE *In = Src + Sx / 2;
+    UWORD Bytes = N / 2;
+    if (Sx % 2 == 0) {
+        if (Key > 0x0F) {
+            memcpy(Out, In, Bytes);
+        } else {
+            for (UWORD i = 0; i < Bytes; i++) {
+                UBYTE Mask = Paint_KeyMask(In[i], Key);
+                Out[i] = (Out[i] & ~Mask) | (In[i] & Mask);
+            }
+        }
+    } else {
+        for (UWORD i = 0; i < Bytes; i++) {
+            UBYTE Byte = (In[i] << 4) | (In[i + 1] >> 4);
+            UBYTE Mask = (Key > 0x0F)? 0xFF : Paint_KeyMask(Byte, Key);
+            Out[i] = (Out[i] & ~Mask) | (Byte & Mask);
         }
     }
+
+    if (N % 2) {
+        UBYTE Pixel = Paint_Nibble(Src, Sx + N - 1);
+        if (Pixel != Key)
+            Out[Bytes] = (Out[Bytes] & 0x0F) | (Pixel << 4);
+    }
+}
+
+static void Paint_Blit4(PAINT *P, const UBYTE *Image, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image, UWORD Key)
+{
+    const PAINT_WRITER *W = Paint_GetWriter(P);
+    UWORD Stride = (W_Image + 1) / 2;
+    int X0 = xStart, Y0 = yStart;
+    int X1 = xStart + W_Image, Y1 = yStart + H_Image;
+
+    if (W == &Paint_NoWriter || Image == NULL)
+        return;
+    if (X1 > P->Width)
+        X1 = P->Width;
+    if (Y1 > P->Height)
+        Y1 = P->Height;
+
+    if ((P->Scale != 6 && P->Scale != 7 && P->Scale != 16) ||
+        (P->Rotate != ROTATE_0 && P->Rotate != ROTATE_180)) {
+        for (int y = Y0; y < Y1; y++) {
+            const UBYTE *Row = Image + (UDOUBLE)(y - yStart) * Stride;
+            for (int x = X0; x < X1; x++) {
+                UBYTE Pixel = Paint_Nibble(Row, x - xStart);
+                if (Pixel != Key)
+                    W->Pixel(P, x, y, Pixel);
+            }
+        }
+        return;
+    }
+
+    // Memory row and column of picture pixel x, y are x or WidthMemory-1-x
+    // and y or HeightMemory-1-y; clip to the memory and the band
+    UBYTE FlipX = (P->Rotate == ROTATE_180) ^ ((P->Mirror & MIRROR_HORIZONTAL) != 0);
+    UBYTE FlipY = (P->Rotate == ROTATE_180) ^ ((P->Mirror & MIRROR_VERTICAL) != 0);
+    int BandX0 = FlipX? P->WidthMemory - P->BandX - P->BandWidth : P->BandX;
+    int BandY0 = FlipY? P->HeightMemory - P->BandY - P->BandHeight : P->BandY;
+    if (X0 < BandX0)
+        X0 = BandX0;
+    if (X1 > BandX0 + P->BandWidth)
+        X1 = BandX0 + P->BandWidth;
+    if (Y0 < BandY0)
+        Y0 = BandY0;
+    if (Y1 > BandY0 + P->BandHeight)
+        Y1 = BandY0 + P->BandHeight;
+    if (X1 > P->WidthMemory)
+        X1 = P->WidthMemory;
+    if (Y1 > P->HeightMemory)
+        Y1 = P->HeightMemory;
+    if (X0 >= X1 || Y0 >= Y1)
+        return;
+
+    UWORD N = X1 - X0;
+    for (int y = Y0; y < Y1; y++) {
+        const UBYTE *Row = Image + (UDOUBLE)(y - yStart) * Stride;
+        int My = (FlipY? P->HeightMemory - 1 - y : y) - P->BandY;
+        UBYTE *Dst = P->Image + (UDOUBLE)My * P->WidthByte;
+
+        if (!FlipX) {
+            Paint_CopyNibbles(Dst, X0 - P->BandX, Row, X0 - xStart, N, Key);
+            continue;
+        }
+        // Backwards: reverse a chunk of the source, then copy it forwards
+        UBYTE Reversed[PAINT_REVERSE_CHUNK];
+        for (UWORD Done = 0; Done < N; ) {
+            UWORD Count = N - Done;
+            if (Count > 2 * PAINT_REVERSE_CHUNK)
+                Count = 2 * PAINT_REVERSE_CHUNK;
+            UWORD Last = X1 - 1 - Done - xStart;        // source pixel at the chunk's left end
+            for (UWORD i = 0; i < Count; i++) {
+                UBYTE Pixel = Paint_Nibble(Row, Last - i);
+                if (i % 2)
+                    Reversed[i / 2] = (Reversed[i / 2] & 0xF0) | Pixel;
+                else
+                    Reversed[i / 2] = Pixel << 4;
+            }
+            Paint_CopyNibbles(Dst, P->WidthMemory - 1 - (X1 - 1 - Done) - P->BandX, Reversed, 0, Count, Key);
+            Done += Count;
+        }
+    }
+}
+
+/******************************************************************************
+function:	Paste a 4bpp image, e.g. a thumbnail
+parameter:
+    image_buffer     : (W_Image + 1) / 2 bytes per row, left pixel in the high
+                       nibble, the layout of EPD_13IN3E_Display()
+    xStart, yStart   : Top left corner
+    W_Image, H_Image : Image size
+info:
+    Nibbles are written as they are, S6_x codes for scale 6. Clipped to the
+    image and the band.
+******************************************************************************/
+void Paint_DrawImage4_r(PAINT *P, const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image)
+{
+    Paint_Blit4(P, image_buffer, xStart, yStart, W_Image, H_Image, 0xFFFF);
+}
+
+/******************************************************************************
+function:	Paste a 4bpp image with a transparent color, e.g. an icon
+parameter:
+    image_buffer     : As Paint_DrawImage4()
+    xStart, yStart   : Top left corner
+    W_Image, H_Image : Image size
+    Transparent      : Nibble value (0 to 15) that leaves the image as it is
+******************************************************************************/
+void Paint_DrawSprite4_r(PAINT *P, const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image,
+                         UWORD Transparent)
+{
+    Paint_Blit4(P, image_buffer, xStart, yStart, W_Image, H_Image, Transparent & 0x0F);
+}
+
+/******************************************************************************
+Global context
+    The original API, drawing on Paint.
+******************************************************************************/
+void Paint_NewImage(UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD Color)
+{
+    Paint_NewImage_r(&Paint, image, Width, Height, Rotate, Color);
+}
+
+void Paint_SelectImage(UBYTE *image)
+{
+    Paint_SelectImage_r(&Paint, image);
+}
+
+void Paint_SetRotate(UWORD Rotate)
+{
+    Paint_SetRotate_r(&Paint, Rotate);
+}
+
+void Paint_SetMirroring(UBYTE mirror)
+{
+    Paint_SetMirroring_r(&Paint, mirror);
+}
+
+void Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color)
+{
+    Paint_SetPixel_r(&Paint, Xpoint, Ypoint, Color);
+}
+
+void Paint_SetScale(UBYTE scale)
+{
+    Paint_SetScale_r(&Paint, scale);
+}
+
+void Paint_SetBand(UWORD Xstart, UWORD Ystart, UWORD Width, UWORD Height)
+{
+    Paint_SetBand_r(&Paint, Xstart, Ystart, Width, Height);
+}
+
+void Paint_GetBandWindow(UWORD *Xstart, UWORD *Ystart, UWORD *Xend, UWORD *Yend)
+{
+    Paint_GetBandWindow_r(&Paint, Xstart, Ystart, Xend, Yend);
+}
+
+void Paint_Clear(UWORD Color)
+{
+    Paint_Clear_r(&Paint, Color);
+}
+
+void Paint_ClearWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
+{
+    Paint_ClearWindows_r(&Paint, Xstart, Ystart, Xend, Yend, Color);
+}
+
+void Paint_DrawPoint(UWORD Xpoint, UWORD Ypoint, UWORD Color, DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_FillWay)
+{
+    Paint_DrawPoint_r(&Paint, Xpoint, Ypoint, Color, Dot_Pixel, Dot_FillWay);
+}
+
+void Paint_DrawLine(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, DOT_PIXEL Line_width, LINE_STYLE Line_Style)
+{
+    Paint_DrawLine_r(&Paint, Xstart, Ystart, Xend, Yend, Color, Line_width, Line_Style);
+}
+
+void Paint_DrawRectangle(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+{
+    Paint_DrawRectangle_r(&Paint, Xstart, Ystart, Xend, Yend, Color, Line_width, Draw_Fill);
+}
+
+void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+{
+    Paint_DrawCircle_r(&Paint, X_Center, Y_Center, Radius, Color, Line_width, Draw_Fill);
+}
+
+void Paint_DrawChar(UWORD Xstart, UWORD Ystart, const char Acsii_Char, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    Paint_DrawChar_r(&Paint, Xstart, Ystart, Acsii_Char, Font, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawString_EN(UWORD Xstart, UWORD Ystart, const char * pString, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    Paint_DrawString_EN_r(&Paint, Xstart, Ystart, pString, Font, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawString_CN(UWORD Xstart, UWORD Ystart, const char * pString, cFONT* font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    Paint_DrawString_CN_r(&Paint, Xstart, Ystart, pString, font, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawNum(UWORD Xpoint, UWORD Ypoint, int32_t Nummber, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    Paint_DrawNum_r(&Paint, Xpoint, Ypoint, Nummber, Font, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawTime(UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    Paint_DrawTime_r(&Paint, Xstart, Ystart, pTime, Font, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawGlyph(UWORD Xpoint, UWORD Ypoint, const UBYTE *Glyph, UWORD Width, UWORD Height, UWORD Color_Foreground, UWORD Color_Background)
+{
+    Paint_DrawGlyph_r(&Paint, Xpoint, Ypoint, Glyph, Width, Height, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawBitMap(const unsigned char* image_buffer)
+{
+    Paint_DrawBitMap_r(&Paint, image_buffer);
+}
+
+void Paint_DrawBitMap_Paste(const unsigned char* image_buffer, UWORD xStart, UWORD yStart, UWORD imageWidth, UWORD imageHeight, UBYTE flipColor)
+{
+    Paint_DrawBitMap_Paste_r(&Paint, image_buffer, xStart, yStart, imageWidth, imageHeight, flipColor);
+}
+
+void Paint_DrawImage(const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image)
+{
+    Paint_DrawImage_r(&Paint, image_buffer, xStart, yStart, W_Image, H_Image);
+}
+
+void Paint_DrawImage4(const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image)
+{
+    Paint_DrawImage4_r(&Paint, image_buffer, xStart, yStart, W_Image, H_Image);
+}
+
+void Paint_DrawSprite4(const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image, UWORD Transparent)
+{
+    Paint_DrawSprite4_r(&Paint, image_buffer, xStart, yStart, W_Image, H_Image, Transparent);
+}
+
+void Paint_DrawPolygon(const PAINT_POINT *Points, UWORD Count, UWORD Color, FILL_RULE Fill_Rule)
+{
+    Paint_DrawPolygon_r(&Paint, Points, Count, Color, Fill_Rule);
 }
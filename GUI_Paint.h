@@ -12,6 +12,53 @@
 * | Date        :   2020-07-23
 * | Info        :
 * -----------------------------------------------------------------------------
+* V3.3(2026-10-18):
+* 1. Change: Pixels are written through writers specialised per scale,
+*           rotation and mirror, looked up once per primitive. Paint_SetPixel
+*           no longer prints on out of range pixels, and rejects X == Width
+*           and Y == Height, which used to spill into the next row.
+* 2. Change: Paint_SetScale(UBYTE scale)
+*           Scale 6 is now native Spectra 6 (S6_x colors, WHITE maps to
+*           S6_WHITE) instead of an alias of 7; 4bpp spans and Paint_Clear
+*           fill whole bytes.
+*           4bpp colors are masked to a nibble, WHITE (0xFF) used to
+*           overwrite the neighbouring pixel.
+* 3. Change: Paint_Clear, Paint_ClearWindows and filled rectangles
+*           Fill whole rows with masked edge bytes and memset in between.
+* 4. Add: Paint_SetBand()
+*           The buffer can hold a band of the image; drawing outside it is
+*           clipped.
+* 5. Add: Paint_GetBandWindow()
+*           The band in image coordinates, to skip drawing outside it.
+* 6. Change: Paint_DrawChar, Paint_DrawString_CN
+*           Glyphs are merged a font byte at a time through a lookup table;
+*           rotated or mirrored glyphs are transformed once and cached.
+* 7. Change: Paint_DrawString_CN
+*           Characters are found by binary search in the font's sorted
+*           index (fonts.h) instead of a scan of the table.
+* 8. Add: Paint_DrawGlyph(), Paint_ForgetGlyph()
+*           Draw glyphs that do not come from a font table, e.g. loaded
+*           from the SD card into a buffer that is reused.
+* 9. Change: Paint_DrawChar
+*           FONT_PACKED fonts (font_packed.cpp) are expanded a row at a
+*           time; the glyph cache keeps the least recently used glyphs.
+* 10. Add: Paint_DrawImage4(), Paint_DrawSprite4()
+*           4bpp images clipped to the image and the band, copied a row
+*           at a time. Paint_DrawImage() no longer writes past the buffer.
+* 11. Add: Paint_X_r(PAINT *P, ...) for every Paint_X()
+*           Draw on a given context; Paint_X() draws on Paint through it.
+*           PAINT_THREADS makes the glyph cache per thread.
+* 12. Add: Paint_DrawPolygon()
+*           Filled polygons, even-odd or nonzero, as spans from an active
+*           edge table, in fixed memory and only over the band's rows.
+* 13. Add: PAINT_TINT(), S6_GRAY, S6_ORANGE, ...
+*           Two colors mixed by an 8x8 ordered dither, as a color for any
+*           primitive. Spans write whole pattern bytes from tables.
+* 14. Add: Paint_FindCN()
+*           The table entry of a CN character, for GUI_Text.h.
+* 15. Add: PAINT_COUNT, Paint_Written
+*           Count the pixels shapes and text write, for tools/paint_bench.
+*
 * V3.2(2020-07-23):
 * 1. Change: Paint_SetScale(UBYTE scale)
 *			Add scale 7 for 5.65f e-Parper
@@ -97,9 +144,37 @@ typedef struct {
     UWORD WidthByte;
     UWORD HeightByte;
     UWORD Scale;
+    UWORD BandX;        // memory position and size of the buffer,
+    UWORD BandY;        // the whole image unless Paint_SetBand() is used
+    UWORD BandWidth;
+    UWORD BandHeight;
 } PAINT;
 extern PAINT Paint;
 
+/**
+ * 1: contexts may be drawn on from several threads at once, each thread
+ * keeps its own glyph cache and polygon tables (thread_local). One context
+ * must not be used by two threads at a time.
+**/
+#ifndef PAINT_THREADS
+#define PAINT_THREADS       0
+#endif
+
+/**
+ * 1: Paint_Written counts the memory pixels shapes and text write, one
+ * for every time a pixel is written, so overdraw shows. Image blits are
+ * not counted. For tools/paint_bench; with PAINT_THREADS each thread
+ * counts its own.
+**/
+#ifndef PAINT_COUNT
+#define PAINT_COUNT         0
+#endif
+#if PAINT_COUNT && PAINT_THREADS
+extern thread_local UDOUBLE Paint_Written;
+#elif PAINT_COUNT
+extern UDOUBLE Paint_Written;
+#endif
+
 /**
  * Display rotate
 **/
@@ -133,6 +208,39 @@ typedef enum {
 #define TRUE 1
 #define FALSE 0
 
+/**
+ * Spectra 6 colors for Paint_SetScale(6)
+ * These are the panel's nibble codes (EPD_13IN3E_x). The buffer is 4bpp,
+ * left pixel in the high nibble, so a 1200x1600 image is exactly what
+ * EPD_13IN3E_Display() sends. WHITE and BLACK work as well.
+**/
+#define S6_BLACK       0x0
+#define S6_WHITE       0x1
+#define S6_YELLOW      0x2
+#define S6_RED         0x3
+#define S6_BLUE        0x5
+#define S6_GREEN       0x6
+
+/**
+ * Tints for any scale, best at 6: Ink and Base, nibble codes such as S6_x,
+ * mixed by an 8x8 ordered dither with Level (0 to 16) sixteenths of Ink.
+ * Shapes and clears draw the pattern, aligned to the image memory so
+ * neighbouring shapes and bands match; text takes the nearer of the two
+ * colors.
+**/
+#define PAINT_TINT_FLAG     0x8000
+#define PAINT_TINT(Ink, Base, Level)    (PAINT_TINT_FLAG | ((Level) << 8) | (((Ink) & 0x0F) << 4) | ((Base) & 0x0F))
+
+#define S6_GRAY        PAINT_TINT(S6_BLACK, S6_WHITE, 8)
+#define S6_LIGHT_GRAY  PAINT_TINT(S6_BLACK, S6_WHITE, 4)
+#define S6_DARK_GRAY   PAINT_TINT(S6_BLACK, S6_WHITE, 12)
+#define S6_ORANGE      PAINT_TINT(S6_RED, S6_YELLOW, 8)
+#define S6_PINK        PAINT_TINT(S6_RED, S6_WHITE, 8)
+#define S6_PURPLE      PAINT_TINT(S6_RED, S6_BLUE, 8)
+#define S6_CYAN        PAINT_TINT(S6_BLUE, S6_GREEN, 8)
+#define S6_SKY         PAINT_TINT(S6_BLUE, S6_WHITE, 8)
+#define S6_LIME        PAINT_TINT(S6_GREEN, S6_YELLOW, 8)
+
 //4 Gray level
 #define  GRAY1 0x03 //Blackest
 #define  GRAY2 0x02
@@ -178,6 +286,19 @@ typedef enum {
     DRAW_FILL_FULL,
 } DRAW_FILL;
 
+/**
+ * Polygon vertex and fill rule, for Paint_DrawPolygon()
+**/
+typedef struct {
+    UWORD X;
+    UWORD Y;
+} PAINT_POINT;
+
+typedef enum {
+    FILL_EVEN_ODD = 0,
+    FILL_NONZERO,
+} FILL_RULE;
+
 /**
  * Custom structure of a time attribute
 **/
@@ -198,6 +319,8 @@ void Paint_SetRotate(UWORD Rotate);
 void Paint_SetMirroring(UBYTE mirror);
 void Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color);
 void Paint_SetScale(UBYTE scale);
+void Paint_SetBand(UWORD Xstart, UWORD Ystart, UWORD Width, UWORD Height);
+void Paint_GetBandWindow(UWORD *Xstart, UWORD *Ystart, UWORD *Xend, UWORD *Yend);
 
 void Paint_Clear(UWORD Color);
 void Paint_ClearWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color);
@@ -207,6 +330,7 @@ void Paint_DrawPoint(UWORD Xpoint, UWORD Ypoint, UWORD Color, DOT_PIXEL Dot_Pixe
 void Paint_DrawLine(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, DOT_PIXEL Line_width, LINE_STYLE Line_Style);
 void Paint_DrawRectangle(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
 void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
+void Paint_DrawPolygon(const PAINT_POINT *Points, UWORD Count, UWORD Color, FILL_RULE Fill_Rule);
 
 //Display string
 void Paint_DrawChar(UWORD Xstart, UWORD Ystart, const char Acsii_Char, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
@@ -214,11 +338,44 @@ void Paint_DrawString_EN(UWORD Xstart, UWORD Ystart, const char * pString, sFONT
 void Paint_DrawString_CN(UWORD Xstart, UWORD Ystart, const char * pString, cFONT* font, UWORD Color_Foreground, UWORD Color_Background);
 void Paint_DrawNum(UWORD Xpoint, UWORD Ypoint, int32_t Nummber, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
 void Paint_DrawTime(UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+void Paint_DrawGlyph(UWORD Xpoint, UWORD Ypoint, const UBYTE *Glyph, UWORD Width, UWORD Height, UWORD Color_Foreground, UWORD Color_Background);
+void Paint_ForgetGlyph(const UBYTE *Glyph);
+const CH_CN *Paint_FindCN(const cFONT *font, const char *p_text);
 
 //pic
 void Paint_DrawBitMap(const unsigned char* image_buffer);
 void Paint_DrawBitMap_Paste(const unsigned char* image_buffer, UWORD xStart, UWORD yStart, UWORD imageWidth, UWORD imageHeight, UBYTE flipColor);
 void Paint_DrawImage(const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image); 
+void Paint_DrawImage4(const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image);
+void Paint_DrawSprite4(const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image, UWORD Transparent);
+
+//The same on a given context instead of Paint, see PAINT_THREADS
+void Paint_NewImage_r(PAINT *P, UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD Color);
+void Paint_SelectImage_r(PAINT *P, UBYTE *image);
+void Paint_SetRotate_r(PAINT *P, UWORD Rotate);
+void Paint_SetMirroring_r(PAINT *P, UBYTE mirror);
+void Paint_SetPixel_r(PAINT *P, UWORD Xpoint, UWORD Ypoint, UWORD Color);
+void Paint_SetScale_r(PAINT *P, UBYTE scale);
+void Paint_SetBand_r(PAINT *P, UWORD Xstart, UWORD Ystart, UWORD Width, UWORD Height);
+void Paint_GetBandWindow_r(PAINT *P, UWORD *Xstart, UWORD *Ystart, UWORD *Xend, UWORD *Yend);
+void Paint_Clear_r(PAINT *P, UWORD Color);
+void Paint_ClearWindows_r(PAINT *P, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color);
+void Paint_DrawPoint_r(PAINT *P, UWORD Xpoint, UWORD Ypoint, UWORD Color, DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_FillWay);
+void Paint_DrawLine_r(PAINT *P, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, DOT_PIXEL Line_width, LINE_STYLE Line_Style);
+void Paint_DrawRectangle_r(PAINT *P, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
+void Paint_DrawCircle_r(PAINT *P, UWORD X_Center, UWORD Y_Center, UWORD Radius, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
+void Paint_DrawPolygon_r(PAINT *P, const PAINT_POINT *Points, UWORD Count, UWORD Color, FILL_RULE Fill_Rule);
+void Paint_DrawChar_r(PAINT *P, UWORD Xstart, UWORD Ystart, const char Acsii_Char, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+void Paint_DrawString_EN_r(PAINT *P, UWORD Xstart, UWORD Ystart, const char * pString, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+void Paint_DrawString_CN_r(PAINT *P, UWORD Xstart, UWORD Ystart, const char * pString, cFONT* font, UWORD Color_Foreground, UWORD Color_Background);
+void Paint_DrawNum_r(PAINT *P, UWORD Xpoint, UWORD Ypoint, int32_t Nummber, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+void Paint_DrawTime_r(PAINT *P, UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+void Paint_DrawGlyph_r(PAINT *P, UWORD Xpoint, UWORD Ypoint, const UBYTE *Glyph, UWORD Width, UWORD Height, UWORD Color_Foreground, UWORD Color_Background);
+void Paint_DrawBitMap_r(PAINT *P, const unsigned char* image_buffer);
+void Paint_DrawBitMap_Paste_r(PAINT *P, const unsigned char* image_buffer, UWORD xStart, UWORD yStart, UWORD imageWidth, UWORD imageHeight, UBYTE flipColor);
+void Paint_DrawImage_r(PAINT *P, const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image);
+void Paint_DrawImage4_r(PAINT *P, const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image);
+void Paint_DrawSprite4_r(PAINT *P, const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image, UWORD Transparent);
 
 #endif
 
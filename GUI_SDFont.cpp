@@ -0,0 +1,304 @@
+/*****************************************************************************
+* | File      	:   GUI_SDFont.cpp
+* | Author      :   lernerc606
+* | Function    :   Draw text with a font file read from the SD card
+* | Info        :
+*   Glyphs are looked up by code point in a cache of GUI_SDFONT_CACHE
+*   slots. A miss takes the least recently used slot: the page table in
+*   RAM gives the index page, the page (kept until another one is needed)
+*   gives the bitmap offset and width, and the bitmap is read into the
+*   slot. Code points the font does not have are cached too, so they are
+*   only searched for once.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+*
+******************************************************************************/
+#include "GUI_SDFont.h"
+#include "GUI_Paint.h"
+#include "Debug.h"
+
+#define GUI_SDFONT_FREE     0xFFFFFFFFUL
+
+// Read Len bytes at Offset, 0 on success
+static UBYTE GUI_SDFont_Read(GUI_SDFONT *Font, UDOUBLE Offset, void *Buf, UDOUBLE Len)
+{
+    UDOUBLE t0 = micros();
+    UBYTE Failed = !Font->Img.seek(Offset) || Font->Img.read((UBYTE *)Buf, Len) != Len;
+
+    Font->Reads++;
+    Font->Read_us += micros() - t0;
+    return Failed;
+}
+
+// Forget every cached glyph, including Paint's rotated copies of them
+static void GUI_SDFont_Flush(GUI_SDFONT *Font)
+{
+    for (UWORD i = 0; i < GUI_SDFONT_CACHE; i++) {
+        Paint_ForgetGlyph(Font->Cache[i].Bits);
+        Font->Cache[i].Code = GUI_SDFONT_FREE;
+        Font->Cache[i].Used = 0;
+        Font->Cache[i].Width = 0;
+    }
+    Font->PageLoaded = 0xFFFF;
+    Font->Clock = 0;
+}
+
+/******************************************************************************
+function :  Open a .s6f font
+parameter:
+    Font : Usually static, it holds the glyph cache (about 12 KB)
+    Path : File on the SD card, which must be initialised
+return   :  0 on success, 1 on error
+******************************************************************************/
+UBYTE GUI_SDFont_Open(GUI_SDFONT *Font, const char *Path)
+{
+    GUI_SDFONT_HEADER Header;
+
+    Font->Img = SD.open(Path, FILE_READ);
+    if (!Font->Img) {
+        LOG_E("Failed to open font %s\r\n", Path);
+        return 1;
+    }
+    if (Font->Img.read((UBYTE *)&Header, sizeof(Header)) != sizeof(Header) ||
+        Header.Magic != GUI_SDFONT_MAGIC ||
+        Header.Height == 0 || Header.Height > MAX_HEIGHT_FONT ||
+        Header.MaxWidth == 0 || Header.MaxWidth > MAX_WIDTH_FONT ||
+        Header.Pages != (Header.Count + GUI_SDFONT_PAGE - 1) / GUI_SDFONT_PAGE ||
+        Header.Pages > GUI_SDFONT_MAX_PAGES) {
+        LOG_E("%s is not a usable .s6f font\r\n", Path);
+        Font->Img.close();
+        return 1;
+    }
+
+    Font->Height = Header.Height;
+    Font->MaxWidth = Header.MaxWidth;
+    Font->Count = Header.Count;
+    Font->Pages = Header.Pages;
+    Font->IndexOffset = Header.IndexOffset;
+    if (GUI_SDFont_Read(Font, Header.PageOffset, Font->PageFirst, (UDOUBLE)Header.Pages * sizeof(UDOUBLE))) {
+        LOG_E("Failed to read the page table of %s\r\n", Path);
+        Font->Img.close();
+        return 1;
+    }
+    GUI_SDFont_Flush(Font);
+    Font->Hits = 0;
+    Font->Misses = 0;
+    Font->Reads = 0;
+    Font->Read_us = 0;
+    Font->Draw_us = 0;
+    LOG_I("Font %s: %lu glyphs, %u pixels high\r\n", Path, (unsigned long)Font->Count, (unsigned)Font->Height);
+    return 0;
+}
+
+/******************************************************************************
+function :  Close the font file; Font can then be opened again
+******************************************************************************/
+void GUI_SDFont_Close(GUI_SDFONT *Font)
+{
+    GUI_SDFont_Flush(Font);
+    Font->Img.close();
+}
+
+// Free a slot whose glyph could not be read
+static GUI_SDFONT_GLYPH *GUI_SDFont_Failed(GUI_SDFONT_GLYPH *Slot)
+{
+    LOG_E("Font read failed\r\n");
+    Slot->Code = GUI_SDFONT_FREE;
+    Slot->Used = 0;
+    return NULL;
+}
+
+/******************************************************************************
+function :  Cached glyph of a code point
+return   :  The slot, Width 0 if the font has no such glyph; NULL if the
+            SD card could not be read
+******************************************************************************/
+static GUI_SDFONT_GLYPH *GUI_SDFont_Glyph(GUI_SDFONT *Font, UDOUBLE Code)
+{
+    GUI_SDFONT_GLYPH *Slot = &Font->Cache[0];
+    UWORD Lo, Hi, Mid;
+
+    Font->Clock++;
+    for (UWORD i = 0; i < GUI_SDFONT_CACHE; i++) {
+        if (Font->Cache[i].Code == Code) {
+            Font->Hits++;
+            Font->Cache[i].Used = Font->Clock;
+            return &Font->Cache[i];
+        }
+        if (Font->Cache[i].Used < Slot->Used)
+            Slot = &Font->Cache[i];
+    }
+
+    Font->Misses++;
+    Paint_ForgetGlyph(Slot->Bits);
+    Slot->Code = Code;
+    Slot->Used = Font->Clock;
+    Slot->Width = 0;
+
+    // Last page starting at or before Code
+    Lo = 0;
+    Hi = Font->Pages;
+    while (Lo < Hi) {
+        Mid = (Lo + Hi) / 2;
+        if (Font->PageFirst[Mid] <= Code)
+            Lo = Mid + 1;
+        else
+            Hi = Mid;
+    }
+    if (Lo == 0)
+        return Slot;
+    UWORD Page = Lo - 1;
+
+    if (Font->PageLoaded != Page) {
+        UDOUBLE First = (UDOUBLE)Page * GUI_SDFONT_PAGE;
+        UWORD Entries = (Font->Count - First < GUI_SDFONT_PAGE)? Font->Count - First : GUI_SDFONT_PAGE;
+        Font->PageLoaded = 0xFFFF;
+        if (GUI_SDFont_Read(Font, Font->IndexOffset + First * sizeof(GUI_SDFONT_ENTRY), Font->Page,
+                            (UDOUBLE)Entries * sizeof(GUI_SDFONT_ENTRY)))
+            return GUI_SDFont_Failed(Slot);
+        Font->PageLoaded = Page;
+        Font->PageEntries = Entries;
+    }
+
+    Lo = 0;
+    Hi = Font->PageEntries;
+    while (Lo < Hi) {
+        Mid = (Lo + Hi) / 2;
+        if ((Font->Page[Mid].Code & 0xFFFFFF) < Code)
+            Lo = Mid + 1;
+        else
+            Hi = Mid;
+    }
+    if (Lo < Font->PageEntries && (Font->Page[Lo].Code & 0xFFFFFF) == Code) {
+        UBYTE Width = Font->Page[Lo].Code >> 24;
+        if (Width == 0 || Width > MAX_WIDTH_FONT)
+            return Slot;
+        if (GUI_SDFont_Read(Font, Font->Page[Lo].Offset, Slot->Bits, (UDOUBLE)(Width + 7) / 8 * Font->Height))
+            return GUI_SDFont_Failed(Slot);
+        Slot->Width = Width;
+    }
+    return Slot;
+}
+
+// Next code point of a UTF-8 string, U+FFFD for a malformed sequence
+static UDOUBLE GUI_SDFont_Next(const char **pString)
+{
+    const UBYTE *p = (const UBYTE *)*pString;
+    UDOUBLE Code;
+    UBYTE More;
+
+    if (p[0] < 0x80) {
+        *pString += 1;
+        return p[0];
+    } else if ((p[0] & 0xE0) == 0xC0) {
+        Code = p[0] & 0x1F;
+        More = 1;
+    } else if ((p[0] & 0xF0) == 0xE0) {
+        Code = p[0] & 0x0F;
+        More = 2;
+    } else if ((p[0] & 0xF8) == 0xF0) {
+        Code = p[0] & 0x07;
+        More = 3;
+    } else {
+        *pString += 1;
+        return 0xFFFD;
+    }
+    for (UBYTE i = 1; i <= More; i++) {
+        if ((p[i] & 0xC0) != 0x80) {
+            *pString += i;
+            return 0xFFFD;
+        }
+        Code = (Code << 6) | (p[i] & 0x3F);
+    }
+    *pString += More + 1;
+    return Code;
+}
+
+/******************************************************************************
+function :  Width of a UTF-8 string without drawing it
+parameter:
+    Font    : Opened font
+    pString : UTF-8 text; '\n' starts a new line
+return   :  Width of the widest line
+info     :  Glyphs are looked up through the cache, so drawing the string
+            next reads nothing more from the SD card. Lines only break at
+            '\n', not at the image width.
+******************************************************************************/
+UWORD GUI_SDFont_Measure(GUI_SDFONT *Font, const char *pString)
+{
+    UWORD Width = 0, Widest = 0;
+
+    while (*pString != '\0') {
+        UDOUBLE Code = GUI_SDFont_Next(&pString);
+        if (Code == '\n') {
+            Width = 0;
+            continue;
+        }
+        GUI_SDFONT_GLYPH *Glyph = GUI_SDFont_Glyph(Font, Code);
+        if (Glyph == NULL)
+            break;
+        Width += Glyph->Width? Glyph->Width : Font->MaxWidth / 2;
+        if (Width > Widest)
+            Widest = Width;
+    }
+    return Widest;
+}
+
+/******************************************************************************
+function :  Display a UTF-8 string
+parameter:
+    Font             : Opened font
+    Xstart, Ystart   : Top left corner
+    pString          : UTF-8 text; '\n' starts a new line
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color, FONT_BACKGROUND leaves it
+return   :  X after the last glyph
+info     :  Lines wrap at the image width like Paint_DrawString_EN().
+            Characters missing from the font advance by half the widest
+            glyph and draw nothing.
+******************************************************************************/
+UWORD GUI_SDFont_DrawString(GUI_SDFONT *Font, UWORD Xstart, UWORD Ystart, const char *pString,
+                            UWORD Color_Foreground, UWORD Color_Background)
+{
+    UDOUBLE t0 = micros();
+    UWORD Xpoint = Xstart, Ypoint = Ystart;
+
+    while (*pString != '\0') {
+        UDOUBLE Code = GUI_SDFont_Next(&pString);
+        if (Code == '\n') {
+            Xpoint = Xstart;
+            Ypoint += Font->Height;
+            continue;
+        }
+
+        GUI_SDFONT_GLYPH *Glyph = GUI_SDFont_Glyph(Font, Code);
+        if (Glyph == NULL)
+            break;
+        UWORD Advance = Glyph->Width? Glyph->Width : Font->MaxWidth / 2;
+        if (Xpoint + Advance > Paint.Width) {
+            Xpoint = Xstart;
+            Ypoint += Font->Height;
+        }
+        if (Glyph->Width)
+            Paint_DrawGlyph(Xpoint, Ypoint, Glyph->Bits, Glyph->Width, Font->Height,
+                            Color_Foreground, Color_Background);
+        Xpoint += Advance;
+    }
+
+    Font->Draw_us += micros() - t0;
+    return Xpoint;
+}
+
+/******************************************************************************
+function :  Log the cache hit rate, SD reads and drawing time so far
+******************************************************************************/
+void GUI_SDFont_Log(GUI_SDFONT *Font)
+{
+    UDOUBLE Lookups = Font->Hits + Font->Misses;
+
+    LOG_I("Font: %lu glyph lookups, %lu%% from cache, %lu SD reads in %lu ms, drawn in %lu ms\r\n",
+          (unsigned long)Lookups, (unsigned long)(Lookups? Font->Hits * 100 / Lookups : 0),
+          (unsigned long)Font->Reads, (unsigned long)(Font->Read_us / 1000),
+          (unsigned long)(Font->Draw_us / 1000));
+}
@@ -0,0 +1,91 @@
+/*****************************************************************************
+* | File      	:   GUI_SDFont.h
+* | Author      :   lernerc606
+* | Function    :   Draw text with a font file read from the SD card
+* | Info        :
+*   The CN fonts compiled into flash only hold a few hand-picked glyphs.
+*   A .s6f file (built with tools/make_s6f.py) can hold any number of
+*   glyphs of any script; only the page table stays in RAM and glyphs are
+*   read when a string needs them, into a fixed cache of GUI_SDFONT_CACHE
+*   glyphs that drops the least recently used one.
+*
+*   File layout, little endian:
+*     Header        GUI_SDFONT_HEADER, 28 bytes
+*     Page table    Pages x UDOUBLE, first code point of each index page
+*     Index         Count x GUI_SDFONT_ENTRY sorted by code point, in pages
+*                   of GUI_SDFONT_PAGE entries, from a 512 byte boundary so
+*                   a page is one SD sector
+*     Bitmaps       1bpp, rows byte aligned, MSB first, Height rows each
+*
+*   A glyph not in the cache costs at most two SD reads: its index page,
+*   unless it is the page read last, and its bitmap.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+*
+******************************************************************************/
+#ifndef _GUI_SDFONT_H_
+#define _GUI_SDFONT_H_
+
+#include <SD.h>
+#include "DEV_Config.h"
+#include "fonts.h"
+
+#define GUI_SDFONT_MAGIC        0x31463653  // "S6F1"
+#define GUI_SDFONT_PAGE         64          // index entries per page
+#define GUI_SDFONT_MAX_PAGES    512         // 32768 glyphs, 2 KB of page table
+#define GUI_SDFONT_CACHE        64          // cached glyphs
+#define GUI_SDFONT_GLYPH_BYTES  (MAX_WIDTH_FONT / 8 * MAX_HEIGHT_FONT)
+
+typedef struct {
+    UDOUBLE Magic;
+    UWORD Height;               // rows of every glyph, at most MAX_HEIGHT_FONT
+    UWORD MaxWidth;             // widest glyph, at most MAX_WIDTH_FONT
+    UDOUBLE Count;              // glyphs
+    UWORD Pages;                // index pages
+    UWORD Reserved0;
+    UDOUBLE PageOffset;         // page table
+    UDOUBLE IndexOffset;        // first index page
+    UDOUBLE Reserved1;
+} GUI_SDFONT_HEADER;
+
+typedef struct {
+    UDOUBLE Code;               // code point in bits 0..23, width in bits 24..31
+    UDOUBLE Offset;             // bitmap
+} GUI_SDFONT_ENTRY;
+
+typedef struct {
+    UDOUBLE Code;               // code point, 0xFFFFFFFF if the slot is free
+    UDOUBLE Used;               // LRU stamp
+    UBYTE Width;                // 0 if the font has no such glyph
+    UBYTE Bits[GUI_SDFONT_GLYPH_BYTES];
+} GUI_SDFONT_GLYPH;
+
+typedef struct {
+    File Img;
+    UWORD Height;
+    UWORD MaxWidth;
+    UDOUBLE Count;
+    UWORD Pages;
+    UDOUBLE IndexOffset;
+    UDOUBLE PageFirst[GUI_SDFONT_MAX_PAGES];
+    UWORD PageLoaded;           // index page in Page, 0xFFFF if none
+    UWORD PageEntries;          // entries in Page
+    GUI_SDFONT_ENTRY Page[GUI_SDFONT_PAGE];
+    GUI_SDFONT_GLYPH Cache[GUI_SDFONT_CACHE];
+    UDOUBLE Clock;              // LRU stamp of the last lookup
+    UDOUBLE Hits;               // lookups served from the cache
+    UDOUBLE Misses;
+    UDOUBLE Reads;              // SD reads after opening
+    UDOUBLE Read_us;            // time spent in them
+    UDOUBLE Draw_us;            // time in GUI_SDFont_DrawString(), reads included
+} GUI_SDFONT;
+
+UBYTE GUI_SDFont_Open(GUI_SDFONT *Font, const char *Path);
+void GUI_SDFont_Close(GUI_SDFONT *Font);
+UWORD GUI_SDFont_Measure(GUI_SDFONT *Font, const char *pString);
+UWORD GUI_SDFont_DrawString(GUI_SDFONT *Font, UWORD Xstart, UWORD Ystart, const char *pString,
+                            UWORD Color_Foreground, UWORD Color_Background);
+void GUI_SDFont_Log(GUI_SDFONT *Font);
+
+#endif
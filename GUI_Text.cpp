@@ -0,0 +1,323 @@
+/*****************************************************************************
+* | File      	:   GUI_Text.cpp
+* | Author      :   lernerc606
+* | Function    :   Measure, wrap and align text before drawing it
+* | Info        :
+*   Lines are filled greedily a word at a time. Spaces between words
+*   become glyphs (an opaque background covers them too); spaces at a
+*   break are dropped. The width of each glyph comes from the font: all
+*   of an sFONT's are Font->Width, a cFONT's ASCII characters are
+*   ASCII_Width and the others Width, as Paint_DrawString_CN() draws them.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+*
+******************************************************************************/
+#include "GUI_Text.h"
+#include <string.h>
+
+#define GUI_TEXT_ELLIPSIS   "..."
+
+typedef struct {
+    UBYTE Bytes;                // of pString, 0 at the end
+    UBYTE Space;                // ' ' or '\t'
+    UBYTE Newline;
+    UBYTE Alone;                // a word by itself: CJK, lines break around it
+    GUI_TEXT_GLYPH Glyph;       // but for X
+} GUI_TEXT_CHAR;
+
+// The character at p. sFONT layouts show what the font cannot draw as
+// '?', one per UTF-8 character.
+static void GUI_Text_Next(sFONT *Font, cFONT *FontCN, const char *p, GUI_TEXT_CHAR *c)
+{
+    UBYTE b = *p & 0xFF;
+
+    memset(c, 0, sizeof(*c));
+    if (b == 0)
+        return;
+    c->Bytes = 1;
+    c->Newline = (b == '\n');
+    c->Space = (b == ' ' || b == '\t');
+    if (c->Newline)
+        return;
+
+    if (Font != NULL) {
+        if (b >= 0x80)
+            while ((p[c->Bytes] & 0xC0) == 0x80)
+                c->Bytes++;
+        c->Glyph.Code = c->Space? ' ' : (b >= ' ' && b <= '~')? b : '?';
+        c->Glyph.Advance = Font->Width;
+        return;
+    }
+
+    if (b >= 0x80) {
+        if (p[1] == 0 || p[2] == 0) {
+            c->Bytes = 0;       // cut off, taken as the end
+            return;
+        }
+        c->Bytes = 3;
+        c->Alone = 1;
+        c->Glyph.Advance = FontCN->Width;
+    } else {
+        c->Glyph.Code = c->Space? ' ' : b;
+        c->Glyph.Advance = FontCN->ASCII_Width;
+    }
+    c->Glyph.CN = Paint_FindCN(FontCN, c->Space? " " : p);
+}
+
+static void GUI_Text_NextOf(const GUI_TEXT *Text, const char *p, GUI_TEXT_CHAR *c)
+{
+    GUI_Text_Next(Text->Font, Text->FontCN, p, c);
+}
+
+static UWORD GUI_Text_Measure_(sFONT *Font, cFONT *FontCN, const char *pString)
+{
+    GUI_TEXT_CHAR c;
+    UWORD Width = 0, Widest = 0;
+
+    for (GUI_Text_Next(Font, FontCN, pString, &c); c.Bytes;
+         pString += c.Bytes, GUI_Text_Next(Font, FontCN, pString, &c)) {
+        if (c.Newline) {
+            Width = 0;
+            continue;
+        }
+        Width += c.Glyph.Advance;
+        if (Width > Widest)
+            Widest = Width;
+    }
+    return Widest;
+}
+
+/******************************************************************************
+function:   Width of a string drawn on one line
+parameter:
+    Font    : Font the string is drawn in
+    pString : Text, lines separated by '\n'
+return  :   Pixels of the widest line
+******************************************************************************/
+UWORD GUI_Text_Measure(sFONT *Font, const char *pString)
+{
+    return GUI_Text_Measure_(Font, NULL, pString);
+}
+
+UWORD GUI_Text_MeasureCN(cFONT *Font, const char *pString)
+{
+    return GUI_Text_Measure_(NULL, Font, pString);
+}
+
+// Right edge of the current line's glyphs
+static UWORD GUI_Text_LineEnd(const GUI_TEXT *Text)
+{
+    const GUI_TEXT_LINE *Line = &Text->Line[Text->Lines];
+    if (Line->Count == 0)
+        return 0;
+    const GUI_TEXT_GLYPH *Last = &Text->Glyph[Line->First + Line->Count - 1];
+    return Last->X + Last->Advance;
+}
+
+// Add a glyph at X of the current line
+static void GUI_Text_Put(GUI_TEXT *Text, const GUI_TEXT_CHAR *c, UWORD X)
+{
+    GUI_TEXT_GLYPH *G = &Text->Glyph[Text->Glyphs++];
+    *G = c->Glyph;
+    G->X = X;
+    Text->Line[Text->Lines].Count++;
+}
+
+// Drop the last glyph of the current line
+static void GUI_Text_Unput(GUI_TEXT *Text)
+{
+    Text->Line[Text->Lines].Count--;
+    Text->Glyphs--;
+}
+
+// Close the current line: drop its trailing spaces and align it
+static void GUI_Text_EndLine(GUI_TEXT *Text, TEXT_ALIGN Align)
+{
+    GUI_TEXT_LINE *Line = &Text->Line[Text->Lines];
+    UWORD Offset = 0;
+
+    while (Line->Count > 0 && Text->Glyph[Text->Glyphs - 1].Code == ' ')
+        GUI_Text_Unput(Text);
+    Line->Width = GUI_Text_LineEnd(Text);
+    if (Align == TEXT_ALIGN_CENTER && Line->Width < Text->Width)
+        Offset = (Text->Width - Line->Width) / 2;
+    else if (Align == TEXT_ALIGN_RIGHT && Line->Width < Text->Width)
+        Offset = Text->Width - Line->Width;
+    for (UWORD i = 0; i < Line->Count; i++)
+        Text->Glyph[Line->First + i].X += Offset;
+
+    if (Line->Width > Text->TextWidth)
+        Text->TextWidth = Line->Width;
+    Text->Lines++;
+    Text->Height = Text->Lines * Text->LineHeight;
+    if (Text->Lines < GUI_TEXT_LINES) {
+        Text->Line[Text->Lines].First = Text->Glyphs;
+        Text->Line[Text->Lines].Count = 0;
+    }
+}
+
+// End the text on the current line: cut it until "..." fits after it
+static void GUI_Text_Ellipsis(GUI_TEXT *Text, TEXT_ALIGN Align)
+{
+    GUI_TEXT_CHAR Dot;
+
+    GUI_Text_NextOf(Text, GUI_TEXT_ELLIPSIS, &Dot);
+    while (Text->Line[Text->Lines].Count > 0 &&
+           (Text->Glyph[Text->Glyphs - 1].Code == ' ' ||
+            GUI_Text_LineEnd(Text) + 3 * Dot.Glyph.Advance > Text->Width))
+        GUI_Text_Unput(Text);
+    for (UBYTE i = 0; i < 3; i++)
+        GUI_Text_Put(Text, &Dot, GUI_Text_LineEnd(Text));
+    Text->Truncated = 1;
+    GUI_Text_EndLine(Text, Align);
+}
+
+// Nothing but spaces and newlines from p on
+static UBYTE GUI_Text_Blank(const char *p)
+{
+    while (*p == ' ' || *p == '\t' || *p == '\n')
+        p++;
+    return *p == 0;
+}
+
+static UBYTE GUI_Text_Layout_(GUI_TEXT *Text, const char *pString, UWORD Width, UWORD MaxLines, TEXT_ALIGN Align)
+{
+    GUI_TEXT_CHAR c;
+    UBYTE Wrapped = 0;          // the current line started at a wrap
+    UBYTE InWord = 0;           // c continues a word already placed
+
+    Text->Width = Width;
+    Text->TextWidth = 0;
+    Text->Truncated = 0;
+    Text->Lines = 0;
+    Text->Glyphs = 0;
+    Text->Height = 0;
+    Text->Line[0].First = 0;
+    Text->Line[0].Count = 0;
+    if (MaxLines == 0 || MaxLines > GUI_TEXT_LINES)
+        MaxLines = GUI_TEXT_LINES;
+
+    for (GUI_Text_NextOf(Text, pString, &c); c.Bytes; ) {
+        UWORD X = GUI_Text_LineEnd(Text);
+        UBYTE Break = c.Newline;
+
+        if (c.Space && X == 0 && Wrapped) {
+            pString += c.Bytes;
+            GUI_Text_NextOf(Text, pString, &c);
+            continue;
+        }
+        if (!c.Newline && !c.Space && X > 0 && InWord) {
+            Break = (X + c.Glyph.Advance > Width);
+        } else if (!c.Newline && !c.Space && X > 0) {
+            // Wrap before a word that does not fit; one wider than the box
+            // is then split where it reaches the right edge
+            GUI_TEXT_CHAR w = c;
+            const char *p = pString;
+            UWORD WordWidth = 0;
+            do {
+                WordWidth += w.Glyph.Advance;
+                p += w.Bytes;
+                if (w.Alone)
+                    break;
+                GUI_Text_NextOf(Text, p, &w);
+            } while (w.Bytes && !w.Space && !w.Newline && !w.Alone);
+            Break = (X + WordWidth > Width);
+        }
+
+        if (Break) {
+            if (c.Newline)
+                pString += c.Bytes;
+            if (Text->Lines + 1 >= MaxLines) {
+                if (GUI_Text_Blank(pString))
+                    break;
+                GUI_Text_Ellipsis(Text, Align);
+                return 1;
+            }
+            GUI_Text_EndLine(Text, Align);
+            Wrapped = !c.Newline;
+            InWord = 0;
+            GUI_Text_NextOf(Text, pString, &c);
+            continue;
+        }
+
+        if (Text->Glyphs + 3 >= GUI_TEXT_GLYPHS) {
+            GUI_Text_Ellipsis(Text, Align);
+            return 1;
+        }
+        GUI_Text_Put(Text, &c, X);
+        InWord = !c.Space && !c.Alone;
+        pString += c.Bytes;
+        GUI_Text_NextOf(Text, pString, &c);
+    }
+
+    if (Text->Line[Text->Lines].Count > 0 || Text->Lines == 0)
+        GUI_Text_EndLine(Text, Align);
+    return 0;
+}
+
+/******************************************************************************
+function:   Lay a string out in a box
+parameter:
+    Text     : Layout to fill, usually static (about 4 KB)
+    Font     : Font to draw with; it must stay valid while Text is drawn
+    pString  : Text, '\n' starts a new line
+    Width    : Box width in pixels
+    MaxLines : Lines at most, 0 for GUI_TEXT_LINES
+    Align    : Where each line sits in the box
+return  :   0 if all the text fits, 1 if it was cut off and ends in "..."
+info    :   Text->TextWidth and Text->Height give the size actually used.
+            pString need not stay valid.
+******************************************************************************/
+UBYTE GUI_Text_Layout(GUI_TEXT *Text, sFONT *Font, const char *pString, UWORD Width, UWORD MaxLines, TEXT_ALIGN Align)
+{
+    Text->Font = Font;
+    Text->FontCN = NULL;
+    Text->LineHeight = Font->Height;
+    return GUI_Text_Layout_(Text, pString, Width, MaxLines, Align);
+}
+
+UBYTE GUI_Text_LayoutCN(GUI_TEXT *Text, cFONT *Font, const char *pString, UWORD Width, UWORD MaxLines, TEXT_ALIGN Align)
+{
+    Text->Font = NULL;
+    Text->FontCN = Font;
+    Text->LineHeight = Font->Height;
+    return GUI_Text_Layout_(Text, pString, Width, MaxLines, Align);
+}
+
+/******************************************************************************
+function:   Draw a layout
+parameter:
+    Text             : Laid out by GUI_Text_Layout() or GUI_Text_LayoutCN()
+    Xstart, Ystart   : Top left corner of the box
+    Color_Foreground : Color of the characters
+    Color_Background : Color behind them, FONT_BACKGROUND leaves it
+info    :   Only the lines and glyphs that meet the current Paint band are
+            drawn, so drawing the same layout for every band costs little
+            more than drawing it once.
+******************************************************************************/
+void GUI_Text_Draw(const GUI_TEXT *Text, UWORD Xstart, UWORD Ystart, UWORD Color_Foreground, UWORD Color_Background)
+{
+    UWORD Xband, Yband, Xend, Yend;
+    UWORD Height = (Text->Font != NULL)? Text->Font->Height : Text->FontCN->Height;
+    UWORD Widest = (Text->Font != NULL)? Text->Font->Width : Text->FontCN->Width;
+
+    Paint_GetBandWindow(&Xband, &Yband, &Xend, &Yend);
+    for (UWORD i = 0; i < Text->Lines; i++) {
+        const GUI_TEXT_LINE *Line = &Text->Line[i];
+        UDOUBLE Y = Ystart + (UDOUBLE)i * Text->LineHeight;
+        if (Y >= Yend || Y + Height <= Yband)
+            continue;
+        for (UWORD k = 0; k < Line->Count; k++) {
+            const GUI_TEXT_GLYPH *G = &Text->Glyph[Line->First + k];
+            UDOUBLE X = Xstart + (UDOUBLE)G->X;
+            if (X >= Xend || X + Widest <= Xband)
+                continue;
+            if (Text->Font != NULL)
+                Paint_DrawChar(X, Y, G->Code, Text->Font, Color_Foreground, Color_Background);
+            else if (G->CN != NULL)
+                Paint_DrawGlyph(X, Y, G->CN->matrix, Text->FontCN->Width, Text->FontCN->Height,
+                                Color_Foreground, Color_Background);
+        }
+    }
+}
@@ -0,0 +1,67 @@
+/*****************************************************************************
+* | File      	:   GUI_Text.h
+* | Author      :   lernerc606
+* | Function    :   Measure, wrap and align text before drawing it
+* | Info        :
+*   Paint_DrawString_EN() breaks a string wherever the image edge falls,
+*   and starts over at the top when it runs off the bottom. GUI_Text lays
+*   a string out once into a box of a given width: lines break between
+*   words (and around CJK characters), a word wider than the box is split,
+*   each line is aligned, and text beyond the last line ends in "...".
+*
+*   The result is a list of positioned glyphs, CN font entries already
+*   looked up, so drawing it again for every band of GUI_Band_Show() only
+*   draws the glyphs that meet the band and searches nothing.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+*
+******************************************************************************/
+#ifndef _GUI_TEXT_H_
+#define _GUI_TEXT_H_
+
+#include "GUI_Paint.h"
+
+#define GUI_TEXT_GLYPHS     512     // glyphs in a layout, spaces included
+#define GUI_TEXT_LINES      32
+
+typedef enum {
+    TEXT_ALIGN_LEFT = 0,
+    TEXT_ALIGN_CENTER,
+    TEXT_ALIGN_RIGHT,
+} TEXT_ALIGN;
+
+typedef struct {
+    UWORD X;                    // from the left of the box
+    UBYTE Code;                 // ASCII character, 0 for others
+    UBYTE Advance;              // pixels to the next glyph
+    const CH_CN *CN;            // cFONT: table entry, NULL if the font lacks it
+} GUI_TEXT_GLYPH;
+
+typedef struct {
+    UWORD First;                // first glyph
+    UWORD Count;
+    UWORD Width;                // pixels, trailing spaces left out
+} GUI_TEXT_LINE;
+
+typedef struct {
+    sFONT *Font;                // one of Font and FontCN
+    cFONT *FontCN;
+    UWORD Width;                // box width
+    UWORD LineHeight;
+    UWORD TextWidth;            // widest line
+    UWORD Height;               // Lines * LineHeight
+    UBYTE Truncated;            // text was cut and ends in "..."
+    UWORD Lines;
+    UWORD Glyphs;
+    GUI_TEXT_LINE Line[GUI_TEXT_LINES];
+    GUI_TEXT_GLYPH Glyph[GUI_TEXT_GLYPHS];
+} GUI_TEXT;
+
+UWORD GUI_Text_Measure(sFONT *Font, const char *pString);
+UWORD GUI_Text_MeasureCN(cFONT *Font, const char *pString);
+UBYTE GUI_Text_Layout(GUI_TEXT *Text, sFONT *Font, const char *pString, UWORD Width, UWORD MaxLines, TEXT_ALIGN Align);
+UBYTE GUI_Text_LayoutCN(GUI_TEXT *Text, cFONT *Font, const char *pString, UWORD Width, UWORD MaxLines, TEXT_ALIGN Align);
+void GUI_Text_Draw(const GUI_TEXT *Text, UWORD Xstart, UWORD Ystart, UWORD Color_Foreground, UWORD Color_Background);
+
+#endif
@@ -0,0 +1,97 @@
+/*****************************************************************************
+* | File      	:   Scheduler.cpp
+* | Author      :   lernerc606
+* | Function    :   Battery aware refresh interval
+* | Info        :
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+*
+******************************************************************************/
+#include "Scheduler.h"
+#include "Wake_Gate.h"
+#include "Debug.h"
+
+RTC_DATA_ATTR static UBYTE Sched_Failures = 0;
+RTC_DATA_ATTR static UBYTE Sched_LowBatteryShown = 0;
+static UWORD Sched_mV = 0;
+
+/******************************************************************************
+function :	Measure the battery, call once per wake before the display and
+            SD card are powered so the reading is not pulled down by them
+******************************************************************************/
+void Sched_Begin(void)
+{
+    Sched_mV = DEV_Battery_mV();
+    LOG_I("Battery: %u mV, %u SD failure(s) in a row\r\n", (unsigned)Sched_mV, (unsigned)Sched_Failures);
+}
+
+UWORD Sched_Battery_mV(void)
+{
+    return Sched_mV;
+}
+
+/******************************************************************************
+function :	Whether the low battery frame should be shown instead of a picture
+info     :  Only true once; after the frame is up the device stops waking.
+            A reading of 0 means no battery sense and is ignored.
+******************************************************************************/
+UBYTE Sched_LowBattery(void)
+{
+    return Sched_mV != 0 && Sched_mV < SCHED_RESERVE_MV && !Sched_LowBatteryShown;
+}
+
+/******************************************************************************
+function :	Time until the next refresh
+parameter:
+    Reason     : SLEEP_REASON_x of the wake that is ending
+    Battery_mV : Battery voltage measured on this wake, 0 if unknown
+    Failures   : SD failures in a row, including this wake
+return   :  Interval in microseconds, 0 for "do not wake again"
+******************************************************************************/
+uint64_t Sched_Interval(UBYTE Reason, UWORD Battery_mV, UBYTE Failures)
+{
+    uint64_t Interval = SLEEP_TIME;
+
+    if (Reason == SLEEP_REASON_LOW_BAT)
+        return 0;
+
+    if (Battery_mV != 0 && Battery_mV < SCHED_STRETCH2_MV)
+        Interval = SLEEP_TIME * 4;
+    else if (Battery_mV != 0 && Battery_mV < SCHED_STRETCH1_MV)
+        Interval = SLEEP_TIME * 2;
+
+    if (Reason == SLEEP_REASON_ERROR && Failures > 0) {
+        uint64_t Retry = SCHED_RETRY_US;
+        for (UBYTE i = 1; i < Failures && Retry < Interval; i++)
+            Retry <<= 1;
+        if (Retry < Interval)
+            Interval = Retry;
+    }
+    return Interval;
+}
+
+/******************************************************************************
+function :	Update the failure count and arm the wake source for deep sleep
+parameter:
+    Reason : SLEEP_REASON_x of the wake that is ending
+******************************************************************************/
+void Sched_Arm(UBYTE Reason)
+{
+    if (Reason == SLEEP_REASON_ERROR) {
+        if (Sched_Failures < SCHED_MAX_FAILURES)
+            Sched_Failures++;
+    } else {
+        Sched_Failures = 0;
+    }
+
+    uint64_t Interval = Sched_Interval(Reason, Sched_mV, Sched_Failures);
+    if (Interval == 0) {
+        Sched_LowBatteryShown = 1;
+        LOG_W("Battery at %u mV, no further wakes until power cycled\r\n", (unsigned)Sched_mV);
+        Wake_Gate_Disarm();
+        return;
+    }
+    LOG_I("Next refresh in %u min\r\n", (unsigned)(Interval / 60000000ULL));
+    Wake_Gate_Arm(Interval, Sched_mV);
+}
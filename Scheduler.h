@@ -0,0 +1,49 @@
+/*****************************************************************************
+* | File      	:   Scheduler.h
+* | Author      :   lernerc606
+* | Function    :   Battery aware refresh interval
+* | Info        :
+*   Picks the time until the next refresh from the battery voltage measured
+*   at the start of the wake and from the number of SD failures in a row:
+*   - the interval is stretched in steps as the battery runs down,
+*   - after an SD failure the frame retries after SCHED_RETRY_US, doubling
+*     on every further failure up to the normal interval,
+*   - below SCHED_RESERVE_MV the frame shows a "low battery" picture once
+*     and stops waking, so there is always enough charge left for it.
+*   tools/battery_model.py reads these values to project battery life.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+*
+******************************************************************************/
+#ifndef _SCHEDULER_H_
+#define _SCHEDULER_H_
+
+#include "DEV_Config.h"
+
+/**
+ * Schedule config
+**/
+//#define SLEEP_TIME 30000000UL         // Time between refreshes in microseconds
+#define SLEEP_TIME 86400000000UL        // (timer tick length is WAKE_TICK_MINUTES in Wake_Gate.h)
+
+#define SCHED_STRETCH1_MV   3750        // below: refresh every 2 x SLEEP_TIME
+#define SCHED_STRETCH2_MV   3650        // below: refresh every 4 x SLEEP_TIME
+#define SCHED_RESERVE_MV    3500        // below: show the low battery frame and stop
+#define SCHED_RETRY_US      900000000ULL // first retry 15 min after an SD failure
+#define SCHED_MAX_FAILURES  16
+
+/**
+ * hilbernate() reasons
+**/
+#define SLEEP_REASON_OK         0
+#define SLEEP_REASON_ERROR      1   // SD card or image file problem
+#define SLEEP_REASON_LOW_BAT    2   // low battery frame shown, do not wake again
+
+void Sched_Begin(void);
+UWORD Sched_Battery_mV(void);
+UBYTE Sched_LowBattery(void);
+uint64_t Sched_Interval(UBYTE Reason, UWORD Battery_mV, UBYTE Failures);
+void Sched_Arm(UBYTE Reason);
+
+#endif
@@ -0,0 +1,123 @@
+/*****************************************************************************
+* | File      	:   Wake_Gate.cpp
+* | Author      :   lernerc606
+* | Function    :   HP core side of the timer wake gate
+* | Info        :
+*   Wake_Gate_Early() must be the first call in setup(). On a timer wake
+*   it runs the gate before anything else is initialised and goes straight
+*   back to sleep if no refresh is due. Wake_Gate_Arm() stores the next
+*   refresh interval and programs the tick timer, either for the HP core
+*   or, with WAKE_GATE_LP_CORE, for the LP core program. Wake_Gate_Disarm()
+*   stops the ticks for good.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+*
+******************************************************************************/
+#include "Wake_Gate.h"
+#include "Debug.h"
+#include <Arduino.h>
+#include <string.h>
+#include "esp_sleep.h"
+
+#if WAKE_GATE_LP_CORE
+#include "ulp_lp_core.h"
+#include "lp_core_main.h"   // generated by ulp_embed_binary(), declares ulp_Gate
+extern const uint8_t lp_core_main_bin_start[] asm("_binary_lp_core_main_bin_start");
+extern const uint8_t lp_core_main_bin_end[]   asm("_binary_lp_core_main_bin_end");
+#define GATE ((volatile WAKE_GATE *)&ulp_Gate)
+#else
+RTC_DATA_ATTR static WAKE_GATE Gate_State;
+#define GATE ((volatile WAKE_GATE *)&Gate_State)
+#endif
+
+/******************************************************************************
+function :	Gate a timer wake before the board is brought up
+parameter:
+info     :  Returns normally when the frame should refresh. Skipped ticks
+            never return: they re-arm the timer and sleep again.
+******************************************************************************/
+void Wake_Gate_Early(void)
+{
+    volatile WAKE_GATE *Gate = GATE;
+
+    if (Gate->Magic != WAKE_GATE_MAGIC) {
+        // Power on: start counting ticks from here
+        memset((void *)Gate, 0, sizeof(WAKE_GATE));
+        Gate->Magic = WAKE_GATE_MAGIC;
+        return;
+    }
+
+    // Only a bare timer wake is gated here. With the LP core the gate has
+    // already run and the wake cause is ULP; resets always refresh.
+    if (esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_TIMER && !Wake_Gate_Tick(Gate)) {
+        Gate->TickMinutes = WAKE_TICK_MINUTES;
+        esp_sleep_enable_timer_wakeup(WAKE_TICK_US);
+        esp_deep_sleep_start();
+    }
+
+    LOG_I("Wake gate: tick %u, %u tick(s) skipped since last refresh\r\n",
+          (unsigned)Gate->Tick, (unsigned)Gate->Skipped);
+}
+
+/******************************************************************************
+function :	Arm the gate for the next deep sleep
+parameter:
+    Interval_us : Time until the next refresh, rounded down to whole ticks
+    Battery_mV  : Battery voltage measured on this wake, 0 if unknown
+info     :  Only programs the wake source; the caller enters deep sleep.
+            An interval shorter than a tick (SD retries) becomes a single
+            short tick.
+******************************************************************************/
+void Wake_Gate_Arm(uint64_t Interval_us, uint16_t Battery_mV)
+{
+    WAKE_GATE State;
+    uint64_t Period = WAKE_TICK_US;
+
+    if (Interval_us < Period)
+        Period = Interval_us;
+
+    memcpy(&State, (const void *)GATE, sizeof(WAKE_GATE));
+    State.Magic = WAKE_GATE_MAGIC;
+    State.RefreshInterval = (uint32_t)(Interval_us / WAKE_TICK_US);
+    if (State.RefreshInterval == 0)
+        State.RefreshInterval = 1;
+    State.RefreshDue = State.RefreshInterval;
+    State.Skipped = 0;
+    State.Battery_mV = Battery_mV;
+    State.TickMinutes = (uint32_t)(Period / 60000000ULL);
+
+    LOG_I("Wake gate: next refresh in %u tick(s) of %u min, battery %u mV\r\n",
+          (unsigned)State.RefreshInterval, (unsigned)State.TickMinutes, (unsigned)Battery_mV);
+
+#if WAKE_GATE_LP_CORE
+    // Loading the binary resets the LP program's variables, so the state
+    // is written back afterwards.
+    ulp_lp_core_load_binary(lp_core_main_bin_start, lp_core_main_bin_end - lp_core_main_bin_start);
+    memcpy((void *)GATE, &State, sizeof(WAKE_GATE));
+
+    ulp_lp_core_cfg_t Cfg = {};
+    Cfg.wakeup_source = ULP_LP_CORE_WAKEUP_SOURCE_LP_TIMER;
+    Cfg.lp_timer_sleep_duration_us = Period;
+    ulp_lp_core_run(&Cfg);
+    esp_sleep_enable_ulp_wakeup();
+#else
+    memcpy((void *)GATE, &State, sizeof(WAKE_GATE));
+    esp_sleep_enable_timer_wakeup(Period);
+#endif
+}
+
+/******************************************************************************
+function :	Stop the ticks, the frame is not to wake again
+parameter:
+info     :  With WAKE_GATE_LP_CORE the program loaded on an earlier wake
+            keeps running on the LP timer through deep sleep, so it is
+            stopped. On the HP core nothing is armed until Wake_Gate_Arm().
+******************************************************************************/
+void Wake_Gate_Disarm(void)
+{
+#if WAKE_GATE_LP_CORE
+    ulp_lp_core_stop();
+#endif
+    LOG_I("Wake gate: disarmed, no further ticks\r\n");
+}
@@ -0,0 +1,98 @@
+/*****************************************************************************
+* | File      	:   Wake_Gate.h
+* | Author      :   lernerc606
+* | Function    :   Decide on each timer tick whether the frame should refresh
+* | Info        :
+*   The frame wakes every WAKE_TICK_MINUTES, but only refreshes when the
+*   refresh-due counter has run out, the current day is enabled in
+*   WAKE_REFRESH_DAYS and the battery is above WAKE_GATE_CUTOFF_MV.
+*
+*   The decision is plain C with no Arduino dependencies so the same code
+*   runs on the HP core (early in setup(), before Serial and GPIO are set
+*   up) and on the ESP32-C6 LP core (lp_core/wake_gate_lp.c), which lets
+*   skipped ticks end without starting the HP core at all.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+*
+******************************************************************************/
+#ifndef _WAKE_GATE_H_
+#define _WAKE_GATE_H_
+
+#include <stdint.h>
+
+/**
+ * Schedule config
+ * The default of one tick per day with every day enabled matches the old
+ * fixed 24 hour sleep. The frame has no clock, so it counts days from
+ * power on: set WAKE_START_WEEKDAY to the day it is switched on. For
+ * "tick hourly, refresh at most once a day on weekends only" use 60
+ * minutes, SLEEP_TIME of 24h and a mask of 0x41 (Sunday and Saturday).
+**/
+#define WAKE_TICK_MINUTES       1440
+#define WAKE_TICK_US            ((uint64_t)WAKE_TICK_MINUTES * 60ULL * 1000000ULL)
+#define WAKE_START_WEEKDAY      0       // weekday of power on, 0 = Sunday
+#define WAKE_REFRESH_DAYS       0x7F    // bit n = weekday n, 0 = Sunday
+#define WAKE_GATE_CUTOFF_MV     3300    // stop refreshing below this (LiPo protection)
+
+/**
+ * Run the gate on the LP core. Only possible in an ESP-IDF build with
+ * lp_core/ added as the LP core app; the Arduino IDE cannot build it, so
+ * Arduino builds gate on the HP core instead.
+**/
+#ifndef WAKE_GATE_LP_CORE
+#define WAKE_GATE_LP_CORE       0
+#endif
+
+#define WAKE_GATE_MAGIC         0x53364754  // "S6GT"
+
+/**
+ * Gate state, kept in RTC memory across deep sleep
+**/
+typedef struct {
+    uint32_t Magic;
+    uint32_t Tick;              // timer ticks since power on
+    uint32_t Minutes;           // minutes since power on, for the day mask
+    uint32_t TickMinutes;       // length of the current tick
+    uint32_t RefreshDue;        // ticks left until a refresh is due
+    uint32_t RefreshInterval;   // ticks between refreshes, set by the HP core
+    uint32_t Skipped;           // ticks skipped since the last HP wake
+    uint16_t Battery_mV;        // last battery reading taken by the HP core
+    uint16_t Reserved;
+} WAKE_GATE;
+
+/******************************************************************************
+function :	Advance the gate by one timer tick
+parameter:
+    Gate : State in RTC memory
+return   :  1 if the HP core has to wake up and refresh the frame
+info     :  The LP core cannot reach the SAR ADC, so the battery check uses
+            the voltage the HP core measured on its last wake. Once below
+            the cutoff the frame stays asleep until it is power cycled.
+******************************************************************************/
+static inline uint8_t Wake_Gate_Tick(volatile WAKE_GATE *Gate)
+{
+    uint32_t Day;
+
+    Gate->Tick++;
+    Gate->Minutes += Gate->TickMinutes;
+    if (Gate->RefreshDue > 0)
+        Gate->RefreshDue--;
+
+    Day = (Gate->Minutes / 1440 + WAKE_START_WEEKDAY) % 7;
+    if (Gate->RefreshDue > 0 ||
+        !(WAKE_REFRESH_DAYS & (1 << Day)) ||
+        (Gate->Battery_mV != 0 && Gate->Battery_mV < WAKE_GATE_CUTOFF_MV)) {
+        Gate->Skipped++;
+        return 0;
+    }
+    return 1;
+}
+
+#ifdef __cplusplus
+void Wake_Gate_Early(void);
+void Wake_Gate_Arm(uint64_t Interval_us, uint16_t Battery_mV);
+void Wake_Gate_Disarm(void);
+#endif
+
+#endif
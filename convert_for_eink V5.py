@@ -1,5 +1,6 @@
 import sys
 import os
+import struct
 import numpy as np
 import tkinter as tk
 from tkinter import filedialog
@@ -42,6 +43,12 @@ DEFAULT_EINK_PALETTE = [
 ]
 RAW_MAP = {0:0x0,1:0x1,2:0x2,3:0x3,4:0x5,5:0x6}
 
+# Landscape pictures are also saved as .s6t tiles, which the frame rotates
+# while streaming (list the .s6t name in order.txt to use it)
+SAVE_TILED = True
+TILE = 40
+TILE_ROTATE = 90    # same turn as np.rot90(k=1) below
+
 # Will hold Entry widgets for palette values
 dith_palette_entries  = [[None]*3 for _ in range(6)]
 eink_palette_entries = [[None]*3 for _ in range(6)]
@@ -548,6 +555,10 @@ def save_eink():
     )
 
     # 2) if landscape, rotate both image & index array
+    if is_landscape and SAVE_TILED:
+        tiled_path = base + ".s6t"
+        save_tiled(tiled_path, idx)
+        print(f"Saved TILED ⇒ {tiled_path}")
     if is_landscape:
         bmp_img = eink_img.rotate(90, expand=True)
         idx = np.rot90(idx, k=1)
@@ -570,6 +581,22 @@ def save_eink():
     
     print(f"Saved RAW  ⇒ {raw_path}")
 
+def save_tiled(path, idx):
+    """Write a 1600x1200 index array as 40x40 4bpp tiles.
+
+    16 byte header ("S6T1", width, height, tile size, rotation, reserved),
+    then the tiles ordered by tile column and tile row, each row major.
+    """
+    h, w = idx.shape
+    lut = np.array([RAW_MAP.get(i, 0) for i in range(256)], dtype=np.uint8)
+    codes = lut[idx]
+    with open(path, "wb") as f:
+        f.write(b"S6T1" + struct.pack("<HHHHI", w, h, TILE, TILE_ROTATE, 0))
+        for tc in range(w // TILE):
+            for tr in range(h // TILE):
+                t = codes[tr*TILE:(tr+1)*TILE, tc*TILE:(tc+1)*TILE]
+                f.write(((t[:, 0::2] << 4) | t[:, 1::2]).tobytes())
+
 def save_all_settings():
     fn = filedialog.asksaveasfilename(defaultextension=".txt")
     if not fn: return
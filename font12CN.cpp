@@ -46,7 +46,7 @@
  extern "C" {
 #endif
 
-const CH_CN Font12CN_Table[] = 
+constexpr CH_CN Font12CN_Table[] = 
 {
 /*--  文字:  你  --*/
 /*--  微软雅黑12;  此字体下对应的点阵为：宽x高=16x21   --*/
@@ -116,12 +116,15 @@ const CH_CN Font12CN_Table[] =
 }
 #endif
 
+static constexpr auto Font12CN_Index = CH_CN_MakeIndex(Font12CN_Table);
+
 cFONT Font12CN = {
   Font12CN_Table,
   sizeof(Font12CN_Table)/sizeof(CH_CN),  /*size of table*/
   11, /* ASCII Width */
   16, /* Width */
   21, /* Height */
+  Font12CN_Index.keys, /* sorted index */
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
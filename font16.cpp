@@ -38,6 +38,8 @@
 /* Includes ------------------------------------------------------------------*/
 #include "fonts.h"
 
+#if !FONT_PACKED    // else font_packed.cpp
+
 // 
 //  Font data for Courier New 12pt
 // 
@@ -1761,4 +1763,6 @@ sFONT Font16 = {
   16, /* Height */
 };
 
+#endif
+
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
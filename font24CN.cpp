@@ -42,7 +42,7 @@
 //  Font data for Courier New 12pt
 // 
 
-const CH_CN Font24CN_Table[]  = 
+constexpr CH_CN Font24CN_Table[] = 
 {
 /*--  文字:  你  --*/
 /*--  微软雅黑24;  此字体下对应的点阵为：宽x高=32x41   --*/
@@ -451,12 +451,15 @@ const CH_CN Font24CN_Table[]  =
 0x00,0x00,0x00,0x00},
 };
 
+static constexpr auto Font24CN_Index = CH_CN_MakeIndex(Font24CN_Table);
+
 cFONT Font24CN = {
   Font24CN_Table,
   sizeof(Font24CN_Table)/sizeof(CH_CN),  /*size of table*/
   24, /* ASCII Width */
   32, /* Width */
   41, /* Height */
+  Font24CN_Index.keys, /* sorted index */
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
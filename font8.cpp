@@ -38,6 +38,8 @@
 /* Includes ------------------------------------------------------------------*/
 #include "fonts.h"
 
+#if !FONT_PACKED    // else font_packed.cpp
+
 // 
 //  Font data for Courier New 12pt
 // 
@@ -1001,4 +1003,6 @@ sFONT Font8 = {
   8, /* Height */
 };
 
+#endif
+
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
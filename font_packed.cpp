@@ -0,0 +1,516 @@
+/*****************************************************************************
+* | File      	:   font_packed.cpp
+* | Author      :   lernerc606
+* | Function    :   Font8 to Font24 with trimmed glyph boxes, for FONT_PACKED
+* | Info        :
+*   Generated by tools/pack_fonts.py from font8.cpp to font24.cpp; edit
+*   those and run it again instead of editing this file.
+*
+*   Font        raw bytes   packed bytes
+*   Font8             760            753
+*   Font12           1140            940
+*   Font16           3040           1298
+*   Font20           3800           1705
+*   Font24           6840           2248
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+*
+******************************************************************************/
+#include "fonts.h"
+
+#if FONT_PACKED
+
+// 95 glyphs from ' ', 5 x 8
+static const uint8_t Font8_Packed[] = {
+  0x00, 0x00, 0x00, 0x00, 0x60, 0x81, 0xF4, 0x00, 0x20, 0x43, 0xB4, 0x00, 0x70, 0x05, 0x2A, 0xBE,
+  0xAF, 0xAA, 0x80, 0x00, 0x70, 0x43, 0x4F, 0x33, 0x90, 0x00, 0x60, 0x44, 0x44, 0x3C, 0x22, 0x04,
+  0x50, 0x44, 0x74, 0xCA, 0xF0, 0x00, 0x30, 0x81, 0xE0, 0x00, 0x70, 0x82, 0x6A, 0xA4, 0x00, 0x70,
+  0x42, 0x95, 0x58, 0x00, 0x40, 0x43, 0x5D, 0x50, 0x04, 0x50, 0x05, 0x21, 0x3E, 0x42, 0x00, 0x10,
+  0x30, 0x82, 0x68, 0x0C, 0x10, 0x43, 0xE0, 0x14, 0x10, 0x81, 0x80, 0x00, 0x70, 0x04, 0x12, 0x22,
+  0x44, 0x80, 0x00, 0x60, 0x43, 0x56, 0xDA, 0x80, 0x00, 0x60, 0x05, 0x61, 0x08, 0x42, 0x7C, 0x00,
+  0x60, 0x43, 0x55, 0x29, 0xC0, 0x00, 0x60, 0x43, 0x54, 0xA3, 0x80, 0x00, 0x60, 0x44, 0x26, 0xAF,
+  0x27, 0x00, 0x60, 0x43, 0xF3, 0x1A, 0x80, 0x00, 0x60, 0x43, 0x73, 0x5B, 0x80, 0x00, 0x60, 0x43,
+  0xF4, 0xA4, 0x80, 0x00, 0x60, 0x43, 0x55, 0x5A, 0x80, 0x00, 0x60, 0x43, 0x76, 0xB3, 0x80, 0x08,
+  0x40, 0x81, 0x90, 0x08, 0x40, 0x82, 0x46, 0x04, 0x50, 0x04, 0x12, 0xC2, 0x10, 0x04, 0x30, 0x43,
+  0xE3, 0x80, 0x04, 0x50, 0x44, 0x84, 0x34, 0x80, 0x00, 0x60, 0x43, 0x54, 0xA0, 0x80, 0x00, 0x70,
+  0x44, 0x69, 0x9B, 0x98, 0x70, 0x00, 0x60, 0x05, 0x61, 0x14, 0xE8, 0xEC, 0x00, 0x60, 0x05, 0xF2,
+  0x5C, 0x94, 0xF8, 0x00, 0x60, 0x43, 0xF6, 0x48, 0xC0, 0x00, 0x60, 0x05, 0xF2, 0x52, 0x94, 0xF8,
+  0x00, 0x60, 0x05, 0xFA, 0x58, 0x84, 0xFC, 0x00, 0x60, 0x05, 0xFA, 0x58, 0x84, 0x70, 0x00, 0x60,
+  0x44, 0xE8, 0x8B, 0xA6, 0x00, 0x60, 0x05, 0xEA, 0x5E, 0x94, 0xF4, 0x00, 0x60, 0x43, 0xE9, 0x25,
+  0xC0, 0x00, 0x60, 0x44, 0x72, 0x2A, 0xA4, 0x00, 0x60, 0x05, 0xDA, 0x98, 0xE5, 0x6C, 0x00, 0x60,
+  0x05, 0xE2, 0x10, 0x84, 0xFC, 0x00, 0x60, 0x05, 0xDE, 0xF7, 0x58, 0xEC, 0x00, 0x60, 0x05, 0xDB,
+  0x5A, 0xB5, 0xF4, 0x00, 0x60, 0x44, 0x69, 0x99, 0x96, 0x00, 0x60, 0x05, 0xF2, 0x52, 0xE4, 0x70,
+  0x00, 0x70, 0x44, 0x69, 0x99, 0x96, 0x30, 0x00, 0x60, 0x05, 0xF2, 0x52, 0xE4, 0xF4, 0x00, 0x60,
+  0x43, 0xF5, 0x1B, 0xC0, 0x00, 0x60, 0x05, 0xFD, 0x48, 0x42, 0x38, 0x00, 0x60, 0x05, 0xDA, 0x52,
+  0x94, 0x98, 0x00, 0x60, 0x05, 0xDC, 0x52, 0xA5, 0x18, 0x00, 0x60, 0x05, 0xDC, 0x6B, 0x5A, 0xA8,
+  0x00, 0x60, 0x05, 0xDA, 0x88, 0x45, 0x6C, 0x00, 0x60, 0x05, 0xDC, 0x54, 0x42, 0x38, 0x00, 0x60,
+  0x44, 0xF9, 0x24, 0x9F, 0x00, 0x70, 0x82, 0xEA, 0xAC, 0x00, 0x70, 0x04, 0x84, 0x42, 0x22, 0x10,
+  0x00, 0x70, 0x42, 0xD5, 0x5C, 0x00, 0x30, 0x43, 0x4A, 0x80, 0x1C, 0x10, 0x05, 0xF8, 0x00, 0x20,
+  0x82, 0x90, 0x08, 0x40, 0x44, 0x62, 0xEF, 0x00, 0x60, 0x05, 0xC2, 0x1C, 0x94, 0xF8, 0x08, 0x40,
+  0x43, 0xF2, 0x70, 0x00, 0x60, 0x44, 0x31, 0x79, 0x97, 0x08, 0x40, 0x43, 0xFE, 0x30, 0x00, 0x60,
+  0x43, 0x2B, 0xA5, 0xC0, 0x08, 0x60, 0x44, 0x79, 0x97, 0x16, 0x00, 0x60, 0x05, 0xC2, 0x1C, 0x94,
+  0xF4, 0x00, 0x60, 0x43, 0x43, 0x25, 0xC0, 0x00, 0x80, 0x43, 0x43, 0x92, 0x4F, 0x00, 0x60, 0x05,
+  0xC2, 0x16, 0xE5, 0x6C, 0x00, 0x60, 0x43, 0xC9, 0x25, 0xC0, 0x08, 0x40, 0x05, 0xD5, 0x6B, 0x50,
+  0x08, 0x40, 0x05, 0xF2, 0x53, 0x90, 0x08, 0x40, 0x44, 0x69, 0x96, 0x08, 0x60, 0x05, 0xF2, 0x52,
+  0xE4, 0x70, 0x08, 0x60, 0x44, 0x79, 0x97, 0x13, 0x08, 0x40, 0x44, 0xF4, 0x4E, 0x08, 0x40, 0x43,
+  0x68, 0xE0, 0x04, 0x50, 0x05, 0x47, 0x90, 0x93, 0x00, 0x08, 0x40, 0x05, 0xDA, 0x52, 0x70, 0x08,
+  0x40, 0x05, 0xCA, 0x4C, 0x60, 0x08, 0x40, 0x05, 0xDD, 0x6A, 0xA0, 0x08, 0x40, 0x44, 0x96, 0x69,
+  0x08, 0x60, 0x05, 0xDA, 0x94, 0x42, 0x30, 0x08, 0x40, 0x44, 0xFA, 0x5F, 0x00, 0x70, 0x43, 0x29,
+  0x64, 0x88, 0x00, 0x70, 0x81, 0xFE, 0x00, 0x70, 0x43, 0x89, 0x34, 0xA0, 0x0C, 0x20, 0x44, 0x5A,
+  0x00, 0x00, 0x00,
+};
+
+static const uint16_t Font8_Offsets[] = {
+     0,    3,    7,   11,   19,   25,   31,   37,   41,   46,   51,   56,
+    63,   67,   71,   75,   82,   88,   95,  101,  107,  113,  119,  125,
+   131,  137,  143,  147,  151,  157,  162,  168,  174,  181,  188,  195,
+   201,  208,  215,  222,  228,  235,  241,  247,  254,  261,  268,  275,
+   281,  288,  295,  302,  308,  315,  322,  329,  336,  343,  350,  356,
+   361,  368,  373,  378,  382,  386,  391,  398,  403,  409,  414,  420,
+   426,  433,  439,  445,  452,  458,  464,  470,  475,  482,  488,  493,
+   498,  505,  511,  517,  523,  528,  535,  540,  546,  550,  556,
+};
+
+sFONT Font8 = {
+  NULL,
+  5, /* Width */
+  8, /* Height */
+  Font8_Packed,
+  Font8_Offsets,
+};
+
+// 95 glyphs from ' ', 7 x 12
+static const uint8_t Font12_Packed[] = {
+  0x00, 0x00, 0x00, 0x04, 0x80, 0xC1, 0xF9, 0x04, 0x30, 0x45, 0xDC, 0xA4, 0x04, 0x90, 0x45, 0x29,
+  0x55, 0xF5, 0x7D, 0x54, 0xA0, 0x04, 0x90, 0x44, 0x27, 0x88, 0x79, 0xE2, 0x20, 0x04, 0x80, 0x45,
+  0x45, 0x10, 0x3E, 0x08, 0xA2, 0x0C, 0x60, 0x45, 0x32, 0x11, 0x59, 0x34, 0x04, 0x40, 0xC1, 0xF0,
+  0x04, 0xA0, 0xC2, 0x5A, 0xAA, 0x50, 0x04, 0xA0, 0x82, 0xA5, 0x55, 0xA0, 0x04, 0x50, 0x45, 0x27,
+  0xC8, 0xA5, 0x00, 0x08, 0x70, 0x07, 0x10, 0x20, 0x47, 0xF1, 0x02, 0x04, 0x00, 0x1C, 0x40, 0x83,
+  0x6B, 0x40, 0x14, 0x10, 0x45, 0xF8, 0x1C, 0x20, 0x82, 0xF0, 0x04, 0x90, 0x45, 0x08, 0x44, 0x22,
+  0x11, 0x08, 0x80, 0x04, 0x80, 0x45, 0x74, 0x63, 0x18, 0xC6, 0x2E, 0x04, 0x80, 0x45, 0x61, 0x08,
+  0x42, 0x10, 0x9F, 0x04, 0x80, 0x45, 0x74, 0x42, 0x22, 0x22, 0x3F, 0x04, 0x80, 0x45, 0x74, 0x42,
+  0x60, 0x86, 0x2E, 0x04, 0x80, 0x46, 0x18, 0xA2, 0x92, 0x8B, 0xF0, 0x87, 0x04, 0x80, 0x45, 0x7A,
+  0x10, 0xE0, 0x86, 0x2E, 0x04, 0x80, 0x45, 0x3A, 0x21, 0xE8, 0xC6, 0x2E, 0x04, 0x80, 0x45, 0xFC,
+  0x42, 0x21, 0x08, 0x84, 0x04, 0x80, 0x45, 0x74, 0x62, 0xE8, 0xC6, 0x2E, 0x04, 0x80, 0x45, 0x74,
+  0x63, 0x17, 0x84, 0x5C, 0x0C, 0x60, 0x82, 0xF0, 0xF0, 0x0C, 0x70, 0x83, 0x6C, 0x07, 0xA0, 0x08,
+  0x70, 0x06, 0x0C, 0x46, 0x20, 0x60, 0x40, 0xC0, 0x10, 0x30, 0x45, 0xF8, 0x3E, 0x08, 0x70, 0x06,
+  0xC0, 0x81, 0x81, 0x18, 0x8C, 0x00, 0x08, 0x70, 0x84, 0x69, 0x12, 0x40, 0xC0, 0x00, 0xA0, 0x45,
+  0x74, 0x63, 0x3A, 0xD6, 0x70, 0x8B, 0x80, 0x04, 0x80, 0x07, 0x30, 0x20, 0xA1, 0x42, 0x8F, 0x91,
+  0x77, 0x04, 0x80, 0x06, 0xF9, 0x14, 0x5E, 0x45, 0x14, 0x7E, 0x04, 0x80, 0x45, 0x7C, 0x61, 0x08,
+  0x42, 0x2E, 0x04, 0x80, 0x06, 0xF1, 0x24, 0x51, 0x45, 0x14, 0xBC, 0x04, 0x80, 0x06, 0xFD, 0x15,
+  0x1C, 0x51, 0x04, 0x7F, 0x04, 0x80, 0x46, 0xFD, 0x15, 0x1C, 0x51, 0x04, 0x38, 0x04, 0x80, 0x46,
+  0x7A, 0x28, 0x20, 0x9E, 0x28, 0x9C, 0x04, 0x80, 0x07, 0xEE, 0x89, 0x13, 0xE4, 0x48, 0x91, 0x77,
+  0x04, 0x80, 0x45, 0xF9, 0x08, 0x42, 0x10, 0x9F, 0x04, 0x80, 0x45, 0x78, 0x84, 0x29, 0x4A, 0x4C,
+  0x04, 0x80, 0x07, 0xEE, 0x89, 0x22, 0x87, 0x09, 0x11, 0x73, 0x04, 0x80, 0x45, 0xE2, 0x10, 0x84,
+  0x25, 0x3F, 0x04, 0x80, 0x07, 0xEE, 0xD9, 0xB2, 0xA5, 0x48, 0x91, 0x77, 0x04, 0x80, 0x07, 0xEE,
+  0xC9, 0x92, 0xA5, 0x4A, 0x93, 0x76, 0x04, 0x80, 0x45, 0x74, 0x63, 0x18, 0xC6, 0x2E, 0x04, 0x80,
+  0x45, 0xF2, 0x52, 0x97, 0x21, 0x1C, 0x04, 0x90, 0x45, 0x74, 0x63, 0x18, 0xC6, 0x2E, 0x38, 0x04,
+  0x80, 0x07, 0xF8, 0x89, 0x12, 0x27, 0x89, 0x11, 0x71, 0x04, 0x80, 0x45, 0x6C, 0xE0, 0xE0, 0x87,
+  0x36, 0x04, 0x80, 0x07, 0xFF, 0x24, 0x40, 0x81, 0x02, 0x04, 0x1C, 0x04, 0x80, 0x07, 0xEE, 0x89,
+  0x12, 0x24, 0x48, 0x91, 0x1C, 0x04, 0x80, 0x07, 0xEE, 0x89, 0x11, 0x42, 0x85, 0x04, 0x08, 0x04,
+  0x80, 0x07, 0xEE, 0x89, 0x12, 0xA5, 0x4A, 0x95, 0x14, 0x04, 0x80, 0x07, 0xC6, 0x88, 0xA0, 0x81,
+  0x05, 0x11, 0x63, 0x04, 0x80, 0x07, 0xEE, 0x88, 0xA1, 0x41, 0x02, 0x04, 0x1C, 0x04, 0x80, 0x45,
+  0xFC, 0x44, 0x42, 0x22, 0x3F, 0x04, 0xA0, 0x83, 0xF2, 0x49, 0x24, 0x9C, 0x04, 0x90, 0x44, 0x84,
+  0x44, 0x22, 0x11, 0x10, 0x04, 0xA0, 0x83, 0xE4, 0x92, 0x49, 0x3C, 0x04, 0x40, 0x45, 0x21, 0x15,
+  0x10, 0x2C, 0x10, 0x07, 0xFE, 0x04, 0x20, 0xC2, 0x90, 0x0C, 0x60, 0x46, 0x72, 0x27, 0xA2, 0x89,
+  0xF0, 0x04, 0x80, 0x06, 0xC1, 0x05, 0x99, 0x45, 0x14, 0x7E, 0x0C, 0x60, 0x45, 0x7C, 0x61, 0x08,
+  0xB8, 0x04, 0x80, 0x46, 0x18, 0x26, 0xA6, 0x8A, 0x28, 0x9F, 0x0C, 0x60, 0x45, 0x74, 0x7F, 0x08,
+  0x3C, 0x04, 0x80, 0x45, 0x3A, 0x3E, 0x84, 0x21, 0x1F, 0x0C, 0x80, 0x46, 0x6E, 0x68, 0xA2, 0x89,
+  0xE0, 0x9C, 0x04, 0x80, 0x07, 0xC0, 0x81, 0x63, 0x24, 0x48, 0x91, 0x77, 0x04, 0x80, 0x45, 0x20,
+  0x38, 0x42, 0x10, 0x9F, 0x04, 0xA0, 0x44, 0x20, 0xF1, 0x11, 0x11, 0x1E, 0x04, 0x80, 0x06, 0xC1,
+  0x05, 0xD2, 0x71, 0x44, 0xB7, 0x04, 0x80, 0x45, 0x61, 0x08, 0x42, 0x10, 0x9F, 0x0C, 0x60, 0x07,
+  0xE8, 0xA9, 0x52, 0xA5, 0x5F, 0xC0, 0x0C, 0x60, 0x07, 0xD8, 0xC9, 0x12, 0x24, 0x5D, 0xC0, 0x0C,
+  0x60, 0x45, 0x74, 0x63, 0x18, 0xB8, 0x0C, 0x80, 0x06, 0xD9, 0x94, 0x51, 0x45, 0xE4, 0x38, 0x0C,
+  0x80, 0x46, 0x6E, 0x68, 0xA2, 0x89, 0xE0, 0x87, 0x0C, 0x60, 0x45, 0xDB, 0x10, 0x84, 0x7C, 0x0C,
+  0x60, 0x45, 0x7C, 0x5C, 0x18, 0xF8, 0x08, 0x70, 0x46, 0x43, 0xE4, 0x10, 0x41, 0x13, 0x80, 0x0C,
+  0x60, 0x07, 0xCC, 0x89, 0x12, 0x24, 0xC6, 0xC0, 0x0C, 0x60, 0x07, 0xEE, 0x89, 0x11, 0x42, 0x82,
+  0x00, 0x0C, 0x60, 0x07, 0xEE, 0x89, 0x52, 0xA5, 0x45, 0x00, 0x0C, 0x60, 0x06, 0xCD, 0x23, 0x0C,
+  0x4B, 0x30, 0x0C, 0x80, 0x07, 0xEE, 0x88, 0x91, 0x41, 0x82, 0x04, 0x3C, 0x0C, 0x60, 0x45, 0xFC,
+  0x88, 0x88, 0xFC, 0x04, 0xA0, 0x83, 0x29, 0x25, 0x12, 0x44, 0x04, 0x90, 0xC1, 0xFF, 0x80, 0x04,
+  0xA0, 0x83, 0x89, 0x24, 0x52, 0x50, 0x14, 0x20, 0x45, 0x4D, 0x80, 0x00, 0x00, 0x00,
+};
+
+static const uint16_t Font12_Offsets[] = {
+     0,    3,    7,   12,   21,   29,   37,   44,   48,   54,   60,   67,
+    77,   82,   86,   90,   99,  107,  115,  123,  131,  140,  148,  156,
+   164,  172,  180,  185,  191,  200,  205,  214,  221,  231,  241,  250,
+   258,  267,  276,  285,  294,  304,  312,  320,  330,  338,  348,  358,
+   366,  374,  383,  393,  401,  411,  421,  431,  441,  451,  461,  469,
+   476,  484,  491,  497,  501,  505,  513,  522,  529,  538,  545,  553,
+   562,  572,  580,  588,  597,  605,  614,  623,  630,  639,  648,  655,
+   662,  671,  680,  689,  698,  706,  716,  723,  730,  735,  742,
+};
+
+sFONT Font12 = {
+  NULL,
+  7, /* Width */
+  12, /* Height */
+  Font12_Packed,
+  Font12_Offsets,
+};
+
+// 95 glyphs from ' ', 11 x 16
+static const uint8_t Font16_Packed[] = {
+  0x00, 0x00, 0x00, 0x04, 0xA1, 0x02, 0xFF, 0xFF, 0x30, 0x08, 0x50, 0xC7, 0xEF, 0xDD, 0x12, 0x24,
+  0x40, 0x04, 0xB0, 0x88, 0x36, 0x36, 0x36, 0x36, 0xFF, 0x6C, 0xFF, 0x6C, 0x6C, 0x6C, 0x6C, 0x00,
+  0xD0, 0x87, 0x10, 0xFF, 0x1E, 0x3E, 0x0F, 0x0F, 0x07, 0xC7, 0x8F, 0xF0, 0x81, 0x00, 0x04, 0xA0,
+  0x88, 0x60, 0x90, 0x90, 0x63, 0x1E, 0x78, 0xC6, 0x09, 0x09, 0x06, 0x08, 0x90, 0x87, 0x3C, 0xC1,
+  0x83, 0x03, 0x0E, 0xF7, 0x66, 0x76, 0x08, 0x51, 0x43, 0xFD, 0x24, 0x04, 0xC1, 0x04, 0x33, 0x6E,
+  0xCC, 0xCC, 0xE6, 0x33, 0x04, 0xC0, 0xC4, 0xCC, 0x63, 0x33, 0x33, 0x36, 0xEC, 0x04, 0x70, 0x88,
+  0x18, 0x18, 0xFF, 0xFF, 0x3C, 0x7E, 0x66, 0x0C, 0x70, 0x87, 0x10, 0x20, 0x47, 0xF1, 0x02, 0x04,
+  0x00, 0x24, 0x51, 0x03, 0x6B, 0x48, 0x18, 0x10, 0x87, 0xFE, 0x24, 0x21, 0x02, 0xF0, 0x00, 0xD0,
+  0x88, 0x03, 0x03, 0x06, 0x06, 0x0C, 0x0C, 0x18, 0x30, 0x30, 0x60, 0x60, 0xC0, 0xC0, 0x04, 0xA0,
+  0x87, 0x38, 0xDB, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0x6C, 0x70, 0x04, 0xA0, 0x88, 0x18, 0xF8, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0x04, 0xA0, 0x87, 0x3C, 0xCF, 0x1E, 0x30, 0xC3, 0x0C,
+  0x30, 0xC1, 0xFC, 0x04, 0xA0, 0x48, 0x7E, 0xC3, 0x03, 0x06, 0x3E, 0x07, 0x03, 0x03, 0xC3, 0x7E,
+  0x04, 0xA0, 0x87, 0x1C, 0x38, 0xF1, 0x66, 0xC9, 0xB3, 0x7F, 0x0C, 0x7C, 0x04, 0xA0, 0x87, 0x7E,
+  0xC1, 0x83, 0x07, 0xC8, 0xC1, 0x83, 0x86, 0xF8, 0x04, 0xA0, 0x87, 0x1E, 0xE1, 0x86, 0x0D, 0xDC,
+  0xF1, 0xE3, 0x66, 0x78, 0x04, 0xA0, 0x47, 0xFF, 0x0C, 0x18, 0x60, 0xC1, 0x83, 0x0C, 0x18, 0x30,
+  0x04, 0xA0, 0x87, 0x7D, 0x8F, 0x1E, 0x37, 0xD8, 0xF1, 0xE3, 0xC6, 0xF8, 0x04, 0xA0, 0x87, 0x79,
+  0x9B, 0x1E, 0x3C, 0xEE, 0xC1, 0x86, 0x1D, 0xE0, 0x10, 0x71, 0x02, 0xF0, 0x3C, 0x10, 0x91, 0x04,
+  0x33, 0x00, 0x06, 0x48, 0x80, 0x08, 0x90, 0x49, 0x01, 0x83, 0x02, 0x06, 0x0C, 0x01, 0x80, 0x20,
+  0x0C, 0x01, 0x80, 0x14, 0x30, 0x49, 0xFF, 0x80, 0x3F, 0xE0, 0x08, 0x90, 0x49, 0xC0, 0x18, 0x02,
+  0x00, 0xC0, 0x18, 0x30, 0x20, 0x60, 0xC0, 0x00, 0x08, 0x90, 0x87, 0x7D, 0x8F, 0x18, 0x31, 0xC6,
+  0x0C, 0x00, 0x30, 0x04, 0xB0, 0x86, 0x39, 0x18, 0x61, 0x9E, 0x9A, 0x67, 0x81, 0x13, 0x80, 0x08,
+  0x90, 0x4A, 0x7E, 0x07, 0x81, 0x20, 0xCC, 0x33, 0x0F, 0xC6, 0x19, 0x86, 0xF3, 0xC0, 0x08, 0x90,
+  0x48, 0xFE, 0x63, 0x63, 0x63, 0x7E, 0x63, 0x63, 0x63, 0xFE, 0x08, 0x90, 0x49, 0x3E, 0xB0, 0xF0,
+  0x38, 0x0C, 0x06, 0x03, 0x02, 0xC2, 0x3E, 0x00, 0x08, 0x90, 0x49, 0xFE, 0x31, 0x98, 0x6C, 0x36,
+  0x1B, 0x0D, 0x86, 0xC6, 0xFE, 0x00, 0x08, 0x90, 0x48, 0xFF, 0x61, 0x61, 0x64, 0x7C, 0x64, 0x61,
+  0x61, 0xFF, 0x08, 0x90, 0x49, 0xFF, 0xB0, 0x58, 0x2C, 0x87, 0xC3, 0x21, 0x80, 0xC0, 0xF8, 0x00,
+  0x08, 0x90, 0x49, 0x3D, 0x31, 0xB0, 0x58, 0x0C, 0x06, 0x7F, 0x0C, 0xC6, 0x3E, 0x00, 0x08, 0x90,
+  0x49, 0xF7, 0xB1, 0x98, 0xCC, 0x67, 0xF3, 0x19, 0x8C, 0xC6, 0xF7, 0x80, 0x08, 0x90, 0x88, 0xFF,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0x08, 0x90, 0x49, 0x3F, 0x83, 0x01, 0x80, 0xC0,
+  0x66, 0x33, 0x19, 0x8C, 0x7C, 0x00, 0x08, 0x90, 0x49, 0xF7, 0xB1, 0x99, 0x8D, 0x87, 0x83, 0xE1,
+  0x98, 0xC6, 0xF3, 0x80, 0x08, 0x90, 0x49, 0xFC, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x84, 0xC2, 0x61,
+  0xFF, 0x80, 0x08, 0x90, 0x0B, 0xE0, 0xEC, 0x19, 0xC7, 0x3D, 0xE6, 0xAC, 0xDD, 0x99, 0x33, 0x06,
+  0xFB, 0xE0, 0x08, 0x90, 0x49, 0xE7, 0xB1, 0x9C, 0xCF, 0x66, 0xB3, 0x79, 0x9C, 0xC6, 0xF3, 0x00,
+  0x08, 0x90, 0x49, 0x3E, 0x31, 0xB0, 0x78, 0x3C, 0x1E, 0x0F, 0x06, 0xC6, 0x3E, 0x00, 0x08, 0x90,
+  0x48, 0xFE, 0x63, 0x63, 0x63, 0x63, 0x7E, 0x60, 0x60, 0xFC, 0x08, 0xB0, 0x49, 0x3E, 0x31, 0xB0,
+  0x78, 0x3C, 0x1E, 0x0F, 0x06, 0xC6, 0x3E, 0x0C, 0xCF, 0xC0, 0x08, 0x90, 0x4A, 0xFE, 0x18, 0xC6,
+  0x31, 0x8C, 0x7C, 0x19, 0x86, 0x31, 0x8C, 0xF9, 0xC0, 0x08, 0x90, 0x87, 0x7F, 0x8F, 0x1F, 0x07,
+  0xC1, 0xF1, 0xE3, 0xFC, 0x08, 0x90, 0x48, 0xFF, 0x99, 0x99, 0x99, 0x18, 0x18, 0x18, 0x18, 0x7E,
+  0x08, 0x90, 0x49, 0xF7, 0xB1, 0x98, 0xCC, 0x66, 0x33, 0x19, 0x8C, 0xC6, 0x3E, 0x00, 0x08, 0x90,
+  0x49, 0xF7, 0xB1, 0x98, 0xC6, 0xC3, 0x61, 0xB0, 0x50, 0x38, 0x1C, 0x00, 0x08, 0x90, 0x0B, 0xFB,
+  0xEC, 0x19, 0x93, 0x37, 0x66, 0xEC, 0x55, 0x0E, 0xE1, 0xDC, 0x31, 0x80, 0x08, 0x90, 0x49, 0xF7,
+  0xB1, 0x8D, 0x83, 0x81, 0xC0, 0xE0, 0xD8, 0xC6, 0xF7, 0x80, 0x08, 0x90, 0x4A, 0xF3, 0xD8, 0x63,
+  0x30, 0x78, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x3F, 0x00, 0x08, 0x90, 0x87, 0xFF, 0x0E, 0x30, 0xC1,
+  0x06, 0x18, 0xE1, 0xFE, 0x04, 0xC1, 0x44, 0xFC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCF, 0x00, 0xD0, 0x88,
+  0xC0, 0xC0, 0x60, 0x60, 0x30, 0x30, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x03, 0x03, 0x04, 0xC0, 0xC4,
+  0xF3, 0x33, 0x33, 0x33, 0x33, 0x3F, 0x00, 0x60, 0x87, 0x10, 0x50, 0xA2, 0x28, 0x30, 0x40, 0x3C,
+  0x10, 0x0B, 0xFF, 0xE0, 0x00, 0x31, 0x03, 0x88, 0x80, 0x10, 0x70, 0x88, 0x7C, 0x06, 0x06, 0x7E,
+  0xC6, 0xCE, 0x77, 0x04, 0xA0, 0x49, 0xE0, 0x30, 0x18, 0x0D, 0xC7, 0x33, 0x0D, 0x86, 0xC3, 0x73,
+  0x77, 0x00, 0x10, 0x70, 0x48, 0x3D, 0x63, 0xC1, 0xC0, 0xC1, 0x63, 0x3E, 0x04, 0xA0, 0x49, 0x07,
+  0x01, 0x80, 0xC7, 0x66, 0x76, 0x1B, 0x0D, 0x86, 0x67, 0x1D, 0xC0, 0x10, 0x70, 0x49, 0x3E, 0x31,
+  0xB0, 0x7F, 0xFC, 0x03, 0x0C, 0xFC, 0x04, 0xA0, 0x89, 0x1F, 0x98, 0x0C, 0x1F, 0xC3, 0x01, 0x80,
+  0xC0, 0x60, 0x30, 0x7F, 0x00, 0x10, 0xA0, 0x49, 0x3B, 0xB3, 0xB0, 0xD8, 0x6C, 0x33, 0x38, 0xEC,
+  0x06, 0x03, 0x1F, 0x00, 0x04, 0xA0, 0x49, 0xE0, 0x30, 0x18, 0x0D, 0xC7, 0x33, 0x19, 0x8C, 0xC6,
+  0x63, 0x7B, 0xC0, 0x04, 0xA0, 0x88, 0x18, 0x18, 0x00, 0x78, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF,
+  0x04, 0xD0, 0x86, 0x18, 0x60, 0x3F, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0xF8, 0x04, 0xA0, 0x49,
+  0xE0, 0x30, 0x18, 0x0D, 0xE6, 0xC3, 0xC1, 0xE0, 0xD8, 0x66, 0x77, 0xC0, 0x04, 0xA0, 0x88, 0x78,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0x10, 0x70, 0x4A, 0xFF, 0x1B, 0x66, 0xD9,
+  0xB6, 0x6D, 0x9B, 0x6E, 0xDC, 0x10, 0x70, 0x49, 0xEE, 0x39, 0x98, 0xCC, 0x66, 0x33, 0x1B, 0xDE,
+  0x10, 0x70, 0x49, 0x3E, 0x31, 0xB0, 0x78, 0x3C, 0x1B, 0x18, 0xF8, 0x10, 0xA0, 0x49, 0xEE, 0x39,
+  0x98, 0x6C, 0x36, 0x1B, 0x99, 0xB8, 0xC0, 0x60, 0x7C, 0x00, 0x10, 0xA0, 0x49, 0x3B, 0xB3, 0xB0,
+  0xD8, 0x6C, 0x33, 0x38, 0xEC, 0x06, 0x03, 0x07, 0xC0, 0x10, 0x70, 0x49, 0xF7, 0x1C, 0xCC, 0x06,
+  0x03, 0x01, 0x83, 0xF8, 0x10, 0x70, 0x87, 0x7F, 0x8F, 0xC3, 0xE0, 0xF8, 0xFF, 0x00, 0x04, 0xA0,
+  0x48, 0x30, 0x30, 0x30, 0xFE, 0x30, 0x30, 0x30, 0x30, 0x31, 0x1E, 0x10, 0x70, 0x49, 0xE7, 0x31,
+  0x98, 0xCC, 0x66, 0x33, 0x38, 0xEE, 0x10, 0x70, 0x49, 0xF7, 0xB1, 0x98, 0xC6, 0xC3, 0x60, 0xE0,
+  0x70, 0x10, 0x70, 0x0B, 0xF1, 0xEC, 0x19, 0x93, 0x37, 0x63, 0xB8, 0x77, 0x0C, 0x60, 0x10, 0x70,
+  0x49, 0xF7, 0x9B, 0x07, 0x03, 0x81, 0xC1, 0xB3, 0xDE, 0x10, 0xA0, 0x4A, 0xF3, 0xD8, 0x63, 0x30,
+  0xCC, 0x16, 0x07, 0x80, 0xC0, 0x30, 0x18, 0x1F, 0x00, 0x10, 0x70, 0x87, 0xFF, 0x0C, 0x31, 0xC6,
+  0x18, 0x7F, 0x80, 0x04, 0xC0, 0xC4, 0x36, 0x66, 0x66, 0xC6, 0x66, 0x63, 0x04, 0xC1, 0x42, 0xFF,
+  0xFF, 0xFF, 0x04, 0xC1, 0x04, 0xC6, 0x66, 0x66, 0x36, 0x66, 0x6C, 0x14, 0x30, 0x87, 0x61, 0x24,
+  0x30, 0x00, 0x00, 0x00,
+};
+
+static const uint16_t Font16_Offsets[] = {
+     0,    3,    9,   17,   31,   46,   59,   70,   75,   84,   93,  103,
+   113,  118,  122,  126,  142,  154,  167,  179,  192,  204,  216,  228,
+   240,  252,  264,  269,  277,  291,  298,  312,  323,  335,  350,  362,
+   376,  390,  402,  416,  430,  444,  456,  470,  484,  498,  514,  528,
+   542,  554,  570,  585,  596,  608,  622,  636,  652,  666,  681,  692,
+   701,  717,  726,  735,  740,  745,  755,  770,  780,  795,  806,  821,
+   836,  851,  864,  877,  892,  905,  917,  928,  939,  954,  969,  980,
+   990, 1003, 1014, 1025, 1038, 1049, 1065, 1075, 1084, 1090, 1099,
+};
+
+sFONT Font16 = {
+  NULL,
+  11, /* Width */
+  16, /* Height */
+  Font16_Packed,
+  Font16_Offsets,
+};
+
+// 95 glyphs from ' ', 14 x 20
+static const uint8_t Font20_Packed[] = {
+  0x00, 0x00, 0x00, 0x04, 0xD1, 0x43, 0xFF, 0xFF, 0xFA, 0x40, 0x7E, 0x08, 0x60, 0xC8, 0xE7, 0xE7,
+  0xE7, 0x42, 0x42, 0x42, 0x01, 0x00, 0x8A, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x3F, 0xFF, 0xFC,
+  0xCC, 0x33, 0x3F, 0xFF, 0xFC, 0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x01, 0x00, 0xC8, 0x18, 0x18,
+  0x3F, 0x7F, 0xC3, 0xC0, 0xF8, 0x7E, 0x07, 0xC3, 0xC3, 0xFE, 0xFC, 0x18, 0x18, 0x18, 0x04, 0xD0,
+  0x89, 0x70, 0x44, 0x22, 0x11, 0x07, 0x18, 0x3C, 0xF9, 0xE0, 0xC7, 0x04, 0x42, 0x21, 0x10, 0x70,
+  0x0C, 0xB0, 0xC9, 0x1F, 0x3F, 0x98, 0x0C, 0x03, 0x03, 0xCF, 0xFF, 0x9E, 0xC6, 0x7F, 0xCF, 0x60,
+  0x08, 0x61, 0x83, 0xFF, 0xA4, 0x80, 0x05, 0x01, 0x84, 0x33, 0x66, 0x6C, 0xCC, 0xCC, 0xC6, 0x66,
+  0x33, 0x05, 0x01, 0x04, 0xCC, 0x66, 0x63, 0x33, 0x33, 0x36, 0x66, 0xCC, 0x04, 0x90, 0xC8, 0x18,
+  0x18, 0x18, 0xDB, 0xFF, 0x3C, 0x3C, 0x7E, 0x66, 0x0C, 0xA0, 0x8A, 0x0C, 0x03, 0x00, 0xC0, 0x30,
+  0xFF, 0xFF, 0xF0, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0x2C, 0x61, 0x44, 0x76, 0x6C, 0xC8, 0x1C, 0x20,
+  0x89, 0xFF, 0xFF, 0xC0, 0x2C, 0x31, 0x83, 0xFF, 0x80, 0x01, 0x00, 0xC8, 0x03, 0x03, 0x06, 0x06,
+  0x06, 0x0C, 0x0C, 0x18, 0x18, 0x30, 0x30, 0x60, 0x60, 0x60, 0xC0, 0xC0, 0x04, 0xD0, 0x89, 0x3E,
+  0x3F, 0x98, 0xD8, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xD8, 0xCF, 0xE3, 0xE0, 0x04, 0xD0,
+  0xC8, 0x18, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0x04, 0xD0,
+  0x89, 0x3E, 0x3F, 0xB8, 0xF8, 0x30, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1F, 0xFF, 0xF8,
+  0x04, 0xD0, 0x4A, 0x1F, 0x1F, 0xE6, 0x1C, 0x03, 0x01, 0xC3, 0xE0, 0xF8, 0x07, 0x00, 0xC0, 0x3C,
+  0x1F, 0xFE, 0x7F, 0x00, 0x04, 0xD0, 0x89, 0x07, 0x07, 0x83, 0xC3, 0x63, 0x31, 0x99, 0x8D, 0x86,
+  0xFF, 0xFF, 0xC0, 0xC1, 0xF0, 0xF8, 0x04, 0xD0, 0x89, 0x7F, 0x3F, 0x98, 0x0C, 0x07, 0xE3, 0xF9,
+  0x8E, 0x03, 0x01, 0x80, 0xF0, 0xFF, 0xE7, 0xE0, 0x04, 0xD0, 0x89, 0x0F, 0x9F, 0xDE, 0x0C, 0x0E,
+  0x06, 0xF3, 0xFD, 0xC7, 0xC1, 0xE0, 0xD8, 0xEF, 0xE1, 0xE0, 0x04, 0xD0, 0x89, 0xFF, 0xFF, 0xF0,
+  0x60, 0x30, 0x30, 0x18, 0x0C, 0x0C, 0x06, 0x03, 0x03, 0x01, 0x80, 0xC0, 0x04, 0xD0, 0x89, 0x3E,
+  0x3F, 0xB8, 0xF8, 0x3E, 0x3B, 0xF9, 0xFD, 0xC7, 0xC1, 0xE0, 0xF8, 0xEF, 0xE3, 0xE0, 0x04, 0xD0,
+  0x89, 0x3C, 0x3F, 0xB8, 0xD8, 0x3C, 0x1F, 0x1D, 0xFE, 0x7B, 0x03, 0x81, 0x83, 0xDF, 0xCF, 0x80,
+  0x14, 0x91, 0x83, 0xFF, 0x80, 0x3F, 0xE0, 0x14, 0xB1, 0x45, 0x39, 0xCE, 0x00, 0x01, 0xCC, 0xC6,
+  0x20, 0x0C, 0xB0, 0x4B, 0x00, 0x60, 0x3C, 0x1E, 0x07, 0x03, 0x81, 0xE0, 0x0E, 0x00, 0x70, 0x07,
+  0x80, 0x3C, 0x01, 0x80, 0x14, 0x60, 0x4B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0,
+  0x0C, 0xB0, 0x8B, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x00, 0x38, 0x03, 0xC0, 0xE0, 0x70, 0x3C, 0x1E,
+  0x03, 0x00, 0x00, 0x08, 0xC0, 0xC8, 0x7C, 0xFE, 0xC3, 0xC3, 0x03, 0x0E, 0x1C, 0x18, 0x00, 0x00,
+  0x38, 0x38, 0x04, 0xE0, 0xC7, 0x1C, 0xC9, 0x0C, 0x18, 0x31, 0xE4, 0xC9, 0x93, 0x1E, 0x02, 0x04,
+  0x27, 0x80, 0x08, 0xC0, 0x4C, 0x3F, 0x03, 0xF0, 0x07, 0x00, 0xD8, 0x0D, 0x81, 0x98, 0x18, 0xC3,
+  0xFC, 0x3F, 0xC6, 0x06, 0xF0, 0xFF, 0x0F, 0x08, 0xC0, 0x8A, 0xFE, 0x3F, 0xC6, 0x19, 0x86, 0x63,
+  0x9F, 0xC7, 0xF9, 0x87, 0x60, 0xD8, 0x3F, 0xFF, 0xFE, 0x08, 0xC0, 0x8A, 0x1E, 0xCF, 0xF7, 0x1F,
+  0x83, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xE0, 0xDC, 0x73, 0xF8, 0x7C, 0x08, 0xC0, 0x4B, 0xFF, 0x1F,
+  0xF1, 0x87, 0x30, 0x76, 0x06, 0xC0, 0xD8, 0x1B, 0x03, 0x60, 0xEC, 0x3B, 0xFE, 0x7F, 0x80, 0x08,
+  0xC0, 0x8A, 0xFF, 0xFF, 0xF6, 0x0D, 0x83, 0x66, 0x1F, 0x87, 0xE1, 0x98, 0x60, 0xD8, 0x3F, 0xFF,
+  0xFF, 0x08, 0xC0, 0x8A, 0xFF, 0xFF, 0xF6, 0x0D, 0x83, 0x66, 0x1F, 0x87, 0xE1, 0x98, 0x60, 0x18,
+  0x0F, 0xC3, 0xF0, 0x08, 0xC0, 0x8B, 0x1E, 0xCF, 0xF9, 0x87, 0x60, 0x6C, 0x01, 0x80, 0x31, 0xFE,
+  0x3F, 0xC0, 0xCC, 0x19, 0xFF, 0x0F, 0x80, 0x08, 0xC0, 0x8A, 0xF3, 0xFC, 0xF6, 0x19, 0x86, 0x61,
+  0x9F, 0xE7, 0xF9, 0x86, 0x61, 0x98, 0x6F, 0x3F, 0xCF, 0x08, 0xC0, 0xC8, 0xFF, 0xFF, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0x08, 0xC0, 0x8B, 0x0F, 0xE1, 0xFC, 0x06, 0x00,
+  0xC0, 0x18, 0x03, 0x30, 0x66, 0x0C, 0xC1, 0x98, 0x73, 0xFC, 0x1F, 0x00, 0x08, 0xC0, 0x8B, 0xFB,
+  0xFF, 0x7D, 0x8E, 0x33, 0x06, 0xC0, 0xF8, 0x1D, 0x83, 0x18, 0x63, 0x0C, 0x33, 0xE7, 0xFC, 0x70,
+  0x08, 0xC0, 0x8A, 0xFC, 0x3F, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC3, 0x30, 0xCC, 0x3F,
+  0xFF, 0xFF, 0x08, 0xC0, 0x4C, 0xF0, 0xFF, 0x0F, 0x70, 0xE7, 0x9E, 0x69, 0x66, 0xF6, 0x6F, 0x66,
+  0x66, 0x66, 0x66, 0x06, 0xF9, 0xFF, 0x9F, 0x08, 0xC0, 0x8A, 0xE7, 0xFD, 0xF7, 0x19, 0xE6, 0x79,
+  0x9B, 0x66, 0xD9, 0x9E, 0x67, 0x98, 0xEF, 0xBB, 0xE6, 0x08, 0xC0, 0x8A, 0x1E, 0x0F, 0xC7, 0x3B,
+  0x87, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xE1, 0xDC, 0xE3, 0xF0, 0x78, 0x08, 0xC0, 0x8A, 0xFF, 0x3F,
+  0xE6, 0x1D, 0x83, 0x60, 0xD8, 0x77, 0xF9, 0xFC, 0x60, 0x18, 0x0F, 0xC3, 0xF0, 0x08, 0xF0, 0x8A,
+  0x1E, 0x0F, 0xC7, 0x3B, 0x87, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xE1, 0xDC, 0xE3, 0xF0, 0x78, 0x1E,
+  0xCF, 0xF3, 0x38, 0x08, 0xC0, 0x8B, 0xFF, 0x1F, 0xF1, 0x87, 0x30, 0x66, 0x1C, 0xFF, 0x1F, 0xC3,
+  0x1C, 0x61, 0x8C, 0x3B, 0xE3, 0xFC, 0x30, 0x08, 0xC0, 0x8A, 0x3E, 0xDF, 0xFE, 0x1F, 0x03, 0xE0,
+  0x1F, 0x81, 0xF8, 0x07, 0xC0, 0xF8, 0x7F, 0xFB, 0x7C, 0x08, 0xC0, 0x8A, 0xFF, 0xFF, 0xFC, 0xCF,
+  0x33, 0xCC, 0xC3, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x03, 0xF0, 0xFC, 0x08, 0xC0, 0x8A, 0xF3, 0xFC,
+  0xF6, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x9C, 0xE3, 0xF0, 0x78, 0x08, 0xC0, 0x4B,
+  0xF1, 0xFE, 0x3D, 0x83, 0x30, 0x63, 0x18, 0x63, 0x06, 0xC0, 0xD8, 0x1B, 0x01, 0xC0, 0x38, 0x07,
+  0x00, 0x08, 0xC0, 0x4D, 0xF8, 0xFF, 0xC7, 0xD8, 0x0C, 0xCE, 0x66, 0x73, 0x33, 0x99, 0xB6, 0xC5,
+  0xB4, 0x38, 0xE1, 0xC7, 0x0E, 0x38, 0x60, 0xC0, 0x08, 0xC0, 0x4B, 0xF1, 0xFE, 0x3D, 0x83, 0x18,
+  0xC1, 0xB0, 0x1C, 0x03, 0x80, 0xD8, 0x31, 0x8C, 0x1B, 0xC7, 0xF8, 0xF0, 0x08, 0xC0, 0x8A, 0xF3,
+  0xFC, 0xF6, 0x18, 0xCC, 0x1E, 0x07, 0x80, 0xC0, 0x30, 0x0C, 0x03, 0x03, 0xF0, 0xFC, 0x08, 0xC0,
+  0xC8, 0xFF, 0xFF, 0xC3, 0xC6, 0x0C, 0x18, 0x18, 0x30, 0x63, 0xC3, 0xFF, 0xFF, 0x05, 0x01, 0x84,
+  0xFF, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xFF, 0x01, 0x00, 0xC8, 0xC0, 0xC0, 0x60, 0x60, 0x60,
+  0x30, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x06, 0x03, 0x03, 0x05, 0x01, 0x04, 0xFF, 0x33,
+  0x33, 0x33, 0x33, 0x33, 0x33, 0xFF, 0x04, 0x60, 0x89, 0x08, 0x0E, 0x0D, 0x8C, 0x6C, 0x1C, 0x04,
+  0x48, 0x20, 0x0E, 0xFF, 0xFF, 0xFF, 0xF0, 0x04, 0x31, 0x44, 0x86, 0x10, 0x14, 0x90, 0x8A, 0x3F,
+  0x1F, 0xE0, 0x18, 0xFE, 0x7F, 0xB8, 0x6C, 0x3B, 0xFF, 0x7D, 0xC0, 0x04, 0xD0, 0x4B, 0xE0, 0x1C,
+  0x01, 0x80, 0x30, 0x06, 0xF0, 0xFF, 0x9C, 0x33, 0x03, 0x60, 0x6C, 0x0D, 0xC3, 0x7F, 0xEE, 0xF0,
+  0x14, 0x90, 0x8A, 0x1E, 0xDF, 0xF6, 0x0F, 0x03, 0xC0, 0x30, 0x0E, 0x0D, 0xFF, 0x3F, 0x00, 0x04,
+  0xD0, 0x8B, 0x01, 0xC0, 0x38, 0x03, 0x00, 0x61, 0xEC, 0xFF, 0x98, 0x76, 0x06, 0xC0, 0xD8, 0x1B,
+  0x87, 0x3F, 0xF1, 0xEE, 0x14, 0x90, 0x8A, 0x1E, 0x1F, 0xE6, 0x1B, 0xFF, 0xFF, 0xF0, 0x06, 0x0D,
+  0xFF, 0x1F, 0x00, 0x04, 0xD0, 0xC9, 0x1F, 0x9F, 0xCC, 0x06, 0x0F, 0xF7, 0xF8, 0xC0, 0x60, 0x30,
+  0x18, 0x0C, 0x1F, 0xEF, 0xF0, 0x14, 0xD0, 0x8B, 0x1E, 0xEF, 0xFD, 0x87, 0x60, 0x6C, 0x0D, 0x81,
+  0x98, 0x73, 0xFE, 0x1E, 0xC0, 0x18, 0x07, 0x1F, 0xC3, 0xF0, 0x04, 0xD0, 0x8A, 0xE0, 0x38, 0x06,
+  0x01, 0x80, 0x6F, 0x1F, 0xE7, 0x19, 0x86, 0x61, 0x98, 0x66, 0x1B, 0xCF, 0xF3, 0xC0, 0x04, 0xD0,
+  0xC8, 0x18, 0x18, 0x00, 0x00, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0x05, 0x10,
+  0x88, 0x0C, 0x0C, 0x00, 0x00, 0x7F, 0x7F, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07,
+  0xFE, 0xFC, 0x04, 0xD0, 0x8A, 0xE0, 0x38, 0x06, 0x01, 0x80, 0x6F, 0x9B, 0xE6, 0xC1, 0xE0, 0x78,
+  0x1B, 0x06, 0x63, 0x9F, 0xE7, 0xC0, 0x04, 0xD0, 0xC8, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0x14, 0x90, 0x4C, 0xFD, 0xCF, 0xFE, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x6F, 0x77, 0xF7, 0x70, 0x14, 0x90, 0x8A, 0xEF, 0x3F, 0xE7, 0x19, 0x86, 0x61,
+  0x98, 0x66, 0x1B, 0xCF, 0xF3, 0xC0, 0x14, 0x90, 0x8A, 0x1E, 0x1F, 0xE6, 0x1B, 0x03, 0xC0, 0xF0,
+  0x36, 0x19, 0xFE, 0x1E, 0x00, 0x14, 0xD0, 0x4B, 0xEF, 0x1F, 0xF9, 0xC3, 0x30, 0x36, 0x06, 0xC0,
+  0xDC, 0x33, 0xFE, 0x6F, 0x0C, 0x01, 0x80, 0x7C, 0x0F, 0x80, 0x14, 0xD0, 0x8B, 0x1E, 0xEF, 0xFD,
+  0x87, 0x60, 0x6C, 0x0D, 0x81, 0x98, 0x73, 0xFE, 0x1E, 0xC0, 0x18, 0x03, 0x01, 0xF0, 0x3E, 0x14,
+  0x90, 0x8A, 0xF3, 0xBD, 0xF3, 0xCC, 0xE0, 0x30, 0x0C, 0x03, 0x03, 0xFC, 0xFF, 0x00, 0x14, 0x90,
+  0xC8, 0x3F, 0xFF, 0xC3, 0xF0, 0x7E, 0x0F, 0xC3, 0xFF, 0xFC, 0x08, 0xC0, 0x8A, 0x30, 0x0C, 0x03,
+  0x03, 0xFE, 0xFF, 0x8C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x33, 0xFC, 0x7C, 0x14, 0x90, 0x8A, 0xE3,
+  0xB8, 0xE6, 0x19, 0x86, 0x61, 0x98, 0x66, 0x39, 0xFF, 0x3D, 0xC0, 0x14, 0x90, 0x4B, 0xF1, 0xFE,
+  0x3D, 0x83, 0x18, 0xC3, 0x18, 0x36, 0x06, 0xC0, 0x70, 0x0E, 0x00, 0x14, 0x90, 0x4B, 0xF1, 0xFE,
+  0x3D, 0x93, 0x32, 0x66, 0xFC, 0x77, 0x0E, 0xE1, 0x8C, 0x31, 0x80, 0x14, 0x90, 0x8A, 0xF3, 0xFC,
+  0xF3, 0x30, 0x78, 0x0C, 0x07, 0x83, 0x33, 0xCF, 0xF3, 0xC0, 0x14, 0xD0, 0x4B, 0xF1, 0xFE, 0x3D,
+  0x83, 0x18, 0xC3, 0x18, 0x36, 0x07, 0xC0, 0x70, 0x0C, 0x01, 0x80, 0x60, 0x7F, 0x0F, 0xE0, 0x14,
+  0x90, 0xC8, 0xFF, 0xFF, 0xC6, 0x0C, 0x18, 0x30, 0x63, 0xFF, 0xFF, 0x05, 0x01, 0x06, 0x1C, 0xF3,
+  0x0C, 0x30, 0xC3, 0x1C, 0xE1, 0xC3, 0x0C, 0x30, 0xC3, 0xC7, 0x05, 0x01, 0x82, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x05, 0x00, 0xC6, 0xE3, 0xC3, 0x0C, 0x30, 0xC3, 0x0E, 0x1C, 0xE3, 0x0C, 0x30, 0xCF, 0x38,
+  0x18, 0x40, 0x8A, 0x38, 0x3F, 0x3C, 0xFC, 0x1E, 0x00, 0x00, 0x00,
+};
+
+static const uint16_t Font20_Offsets[] = {
+     0,    3,   11,   20,   43,   62,   80,   96,  102,  113,  124,  136,
+   152,  158,  164,  169,  188,  206,  222,  240,  260,  278,  296,  314,
+   332,  350,  368,  375,  385,  404,  416,  435,  450,  466,  487,  505,
+   523,  543,  561,  579,  599,  617,  632,  652,  672,  690,  711,  729,
+   747,  765,  787,  807,  825,  843,  861,  881,  904,  924,  942,  957,
+   968,  987,  998, 1008, 1015, 1020, 1035, 1056, 1071, 1092, 1107, 1125,
+  1146, 1166, 1182, 1202, 1222, 1238, 1255, 1270, 1285, 1306, 1327, 1342,
+  1354, 1372, 1387, 1403, 1419, 1434, 1455, 1467, 1482, 1489, 1504,
+};
+
+sFONT Font20 = {
+  NULL,
+  14, /* Width */
+  20, /* Height */
+  Font20_Packed,
+  Font20_Offsets,
+};
+
+// 95 glyphs from ' ', 17 x 24
+static const uint8_t Font24_Packed[] = {
+  0x00, 0x00, 0x00, 0x08, 0xF1, 0x83, 0xFF, 0xFF, 0xFF, 0xE9, 0x01, 0xF8, 0x0C, 0x71, 0x08, 0xE7,
+  0xE7, 0xE7, 0x42, 0x42, 0x42, 0x42, 0x09, 0x00, 0x8B, 0x19, 0x83, 0x30, 0x66, 0x0C, 0xC1, 0x99,
+  0xFF, 0xFF, 0xF8, 0xCC, 0x33, 0x1F, 0xFF, 0xFF, 0x99, 0x83, 0x30, 0x66, 0x0C, 0xC1, 0x98, 0x05,
+  0x30, 0xC9, 0x0C, 0x06, 0x0F, 0x6F, 0xFC, 0x3E, 0x1F, 0x80, 0xF8, 0x3F, 0x03, 0xF0, 0x7C, 0x3E,
+  0x3F, 0xFB, 0x78, 0x18, 0x0C, 0x06, 0x03, 0x00, 0x08, 0xF0, 0xCA, 0x3C, 0x1F, 0x8E, 0x73, 0x0C,
+  0xC3, 0x39, 0xC7, 0xFC, 0xFC, 0xFF, 0x8E, 0x73, 0x0C, 0xC3, 0x39, 0xC7, 0xE0, 0xF0, 0x10, 0xD0,
+  0xCB, 0x1F, 0x87, 0xF1, 0x8C, 0x30, 0x06, 0x00, 0x60, 0x0E, 0x03, 0xE7, 0xEF, 0xF8, 0xF3, 0x0E,
+  0x3F, 0xF3, 0xEE, 0x0C, 0x71, 0x83, 0xFF, 0xA4, 0x90, 0x09, 0x21, 0xC6, 0x0C, 0x73, 0x9E, 0x71,
+  0xCE, 0x38, 0xE3, 0x8E, 0x38, 0x71, 0xC3, 0x8E, 0x1C, 0x30, 0x09, 0x20, 0xC6, 0xC3, 0x87, 0x1C,
+  0x38, 0xE1, 0xC7, 0x1C, 0x71, 0xC7, 0x38, 0xE7, 0x9C, 0xE3, 0x00, 0x08, 0xA0, 0xCA, 0x0C, 0x03,
+  0x00, 0xC3, 0xB7, 0xFF, 0xCF, 0xC1, 0xE0, 0x78, 0x33, 0x0C, 0xC0, 0x10, 0xC0, 0x8C, 0x06, 0x00,
+  0x60, 0x06, 0x00, 0x60, 0x06, 0x0F, 0xFF, 0xFF, 0xF0, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60,
+  0x38, 0x71, 0x85, 0x39, 0x9C, 0xC6, 0x63, 0x00, 0x24, 0x20, 0xCA, 0xFF, 0xFF, 0xF0, 0x38, 0x31,
+  0x84, 0xFF, 0xF0, 0x01, 0x40, 0xCA, 0x00, 0xC0, 0x30, 0x1C, 0x06, 0x03, 0x80, 0xC0, 0x30, 0x18,
+  0x06, 0x03, 0x00, 0xC0, 0x60, 0x18, 0x0C, 0x03, 0x01, 0xC0, 0x60, 0x38, 0x0C, 0x03, 0x00, 0x08,
+  0xF0, 0xCA, 0x1E, 0x0F, 0xC6, 0x19, 0x86, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0D,
+  0x86, 0x61, 0x8F, 0xC1, 0xE0, 0x08, 0xF0, 0xCA, 0x04, 0x0F, 0x0F, 0xC3, 0xB0, 0x0C, 0x03, 0x00,
+  0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x3F, 0xFF, 0xFC, 0x08, 0xF0, 0x8B, 0x1F, 0x0F,
+  0xFB, 0x83, 0x60, 0x3C, 0x06, 0x00, 0xC0, 0x30, 0x0C, 0x07, 0x01, 0xC0, 0x60, 0x18, 0x06, 0x01,
+  0xFF, 0xFF, 0xF8, 0x08, 0xF0, 0xCA, 0x1E, 0x1F, 0xC6, 0x38, 0x06, 0x01, 0x80, 0xC1, 0xE0, 0x7C,
+  0x03, 0x80, 0x30, 0x0C, 0x03, 0xC1, 0xFF, 0xE7, 0xE0, 0x08, 0xF0, 0x8B, 0x03, 0x80, 0xF0, 0x1E,
+  0x06, 0xC1, 0x98, 0x33, 0x0C, 0x61, 0x8C, 0x61, 0x98, 0x33, 0xFF, 0xFF, 0xF0, 0x18, 0x1F, 0xC3,
+  0xF8, 0x08, 0xF0, 0x8B, 0x7F, 0xCF, 0xF9, 0x80, 0x30, 0x06, 0x00, 0xDE, 0x1F, 0xF3, 0x86, 0x00,
+  0x60, 0x0C, 0x01, 0x80, 0x3C, 0x0D, 0xFF, 0x8F, 0xC0, 0x08, 0xF0, 0xCA, 0x07, 0xC7, 0xF3, 0x81,
+  0xC0, 0x60, 0x30, 0x0D, 0xE3, 0xFE, 0xE1, 0xB0, 0x3C, 0x0F, 0x03, 0x61, 0xDF, 0xE1, 0xF0, 0x08,
+  0xF0, 0xCA, 0xFF, 0xFF, 0xFC, 0x0F, 0x07, 0x01, 0x80, 0x60, 0x38, 0x0C, 0x03, 0x01, 0xC0, 0x60,
+  0x18, 0x0E, 0x03, 0x00, 0xC0, 0x08, 0xF0, 0xCA, 0x3F, 0x1F, 0xEE, 0x1F, 0x03, 0xC0, 0xD8, 0x63,
+  0xF0, 0xFC, 0x61, 0xB0, 0x3C, 0x0F, 0x03, 0xE1, 0xDF, 0xE3, 0xF0, 0x08, 0xF0, 0xCA, 0x3E, 0x1F,
+  0xEE, 0x1B, 0x03, 0xC0, 0xF0, 0x36, 0x1D, 0xFF, 0x1E, 0xC0, 0x30, 0x18, 0x0E, 0x07, 0x3F, 0x8F,
+  0x80, 0x18, 0xB1, 0x84, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF0, 0x18, 0xD1, 0x86, 0x3C, 0xF3, 0xC0,
+  0x00, 0x00, 0x0E, 0x71, 0x86, 0x30, 0x80, 0x10, 0xD0, 0x0E, 0x00, 0x1C, 0x00, 0xF0, 0x0F, 0x00,
+  0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00,
+  0x1C, 0x1C, 0x60, 0x4D, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x10, 0xD0,
+  0x4E, 0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x3C, 0x03,
+  0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x00, 0xE0, 0x00, 0x0C, 0xE0, 0xC9, 0x3E, 0x3F, 0xB0, 0xF8, 0x3C,
+  0x18, 0x1C, 0x1C, 0x3C, 0x1C, 0x0C, 0x00, 0x00, 0x03, 0x81, 0xC0, 0x09, 0x10, 0xCA, 0x1F, 0x0F,
+  0xE7, 0x1D, 0x83, 0xC3, 0xF1, 0xFC, 0xEF, 0x33, 0xCC, 0xF3, 0x3C, 0x7F, 0x0F, 0xC0, 0x18, 0x07,
+  0x0C, 0xFF, 0x1F, 0x00, 0x0C, 0xE0, 0x10, 0x1F, 0x80, 0x1F, 0xC0, 0x01, 0xC0, 0x03, 0x60, 0x03,
+  0x60, 0x06, 0x30, 0x06, 0x30, 0x0C, 0x30, 0x0F, 0xF8, 0x1F, 0xF8, 0x18, 0x0C, 0x30, 0x0C, 0xFC,
+  0x7F, 0xFC, 0x7F, 0x0C, 0xE0, 0x4D, 0xFF, 0xC7, 0xFF, 0x0C, 0x1C, 0x60, 0x63, 0x03, 0x18, 0x38,
+  0xFF, 0x87, 0xFE, 0x30, 0x39, 0x80, 0xCC, 0x06, 0x60, 0x3F, 0xFF, 0x7F, 0xF0, 0x0C, 0xE0, 0x8C,
+  0x0F, 0xB3, 0xFF, 0x70, 0x76, 0x03, 0xC0, 0x3C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0x60,
+  0x37, 0x07, 0x3F, 0xE0, 0xFC, 0x0C, 0xE0, 0x4D, 0xFF, 0x87, 0xFF, 0x0C, 0x1C, 0x60, 0x63, 0x01,
+  0x98, 0x0C, 0xC0, 0x66, 0x03, 0x30, 0x19, 0x80, 0xCC, 0x0C, 0x60, 0xEF, 0xFE, 0x7F, 0xE0, 0x0C,
+  0xE0, 0x4C, 0xFF, 0xFF, 0xFF, 0x30, 0x33, 0x03, 0x33, 0x33, 0x30, 0x3F, 0x03, 0xF0, 0x33, 0x03,
+  0x33, 0x30, 0x33, 0x03, 0xFF, 0xFF, 0xFF, 0x0C, 0xE0, 0x8C, 0xFF, 0xFF, 0xFF, 0x30, 0x33, 0x03,
+  0x33, 0x33, 0x30, 0x3F, 0x03, 0xF0, 0x33, 0x03, 0x30, 0x30, 0x03, 0x00, 0xFF, 0x0F, 0xF0, 0x0C,
+  0xE0, 0x8D, 0x0F, 0xB1, 0xFF, 0x9C, 0x1C, 0xC0, 0x6C, 0x03, 0x60, 0x03, 0x00, 0x18, 0x7F, 0xC3,
+  0xFE, 0x01, 0xB8, 0x0C, 0xE0, 0xE3, 0xFF, 0x07, 0xE0, 0x0C, 0xE0, 0x4E, 0xFC, 0xFF, 0xF3, 0xF3,
+  0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0xFF, 0x0F, 0xFC, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C,
+  0x0C, 0xFC, 0xFF, 0xF3, 0xF0, 0x0C, 0xE0, 0xCA, 0xFF, 0xFF, 0xF0, 0xC0, 0x30, 0x0C, 0x03, 0x00,
+  0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0xFF, 0xFF, 0xF0, 0x0C, 0xE0, 0x8D, 0x1F, 0xF8, 0xFF,
+  0xC0, 0x30, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x18, 0x18, 0xC0, 0xC6, 0x06, 0x30, 0x31, 0x83,
+  0x0F, 0xF8, 0x1F, 0x00, 0x0C, 0xE0, 0x4F, 0xFE, 0x7D, 0xFC, 0xF8, 0xC1, 0x81, 0x86, 0x03, 0x18,
+  0x06, 0x60, 0x0D, 0xC0, 0x1F, 0xC0, 0x39, 0xC0, 0x61, 0xC0, 0xC1, 0x81, 0x83, 0x8F, 0xE3, 0xFF,
+  0xC7, 0xC0, 0x0C, 0xE0, 0x4D, 0xFF, 0x07, 0xF8, 0x06, 0x00, 0x30, 0x01, 0x80, 0x0C, 0x00, 0x60,
+  0x03, 0x00, 0x18, 0x18, 0xC0, 0xC6, 0x06, 0x30, 0x3F, 0xFF, 0xFF, 0xFC, 0x0C, 0xE0, 0x10, 0xF0,
+  0x0F, 0xF8, 0x1F, 0x38, 0x1C, 0x3C, 0x3C, 0x3C, 0x3C, 0x36, 0x6C, 0x36, 0x6C, 0x33, 0xCC, 0x33,
+  0xCC, 0x31, 0x8C, 0x30, 0x0C, 0x30, 0x0C, 0xFE, 0x7F, 0xFE, 0x7F, 0x0C, 0xE0, 0x4E, 0xF1, 0xFF,
+  0xC7, 0xF3, 0x83, 0x0F, 0x0C, 0x3E, 0x30, 0xD8, 0xC3, 0x73, 0x0C, 0xEC, 0x31, 0xB0, 0xC7, 0xC3,
+  0x0F, 0x0C, 0x1C, 0xFE, 0x33, 0xF8, 0xC0, 0x0C, 0xE0, 0x8C, 0x0F, 0x03, 0xFC, 0x70, 0xE6, 0x06,
+  0xE0, 0x7C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x07, 0x60, 0x67, 0x0E, 0x3F, 0xC0, 0xF0, 0x0C,
+  0xE0, 0x8C, 0xFF, 0xCF, 0xFE, 0x30, 0x73, 0x03, 0x30, 0x33, 0x03, 0x30, 0x63, 0xFE, 0x3F, 0x83,
+  0x00, 0x30, 0x03, 0x00, 0xFF, 0x0F, 0xF0, 0x0D, 0x10, 0x8C, 0x0F, 0x03, 0xFC, 0x70, 0xE6, 0x06,
+  0xE0, 0x7C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x07, 0x60, 0x67, 0x0E, 0x3F, 0xC1, 0xF0, 0x1F,
+  0x33, 0xFF, 0x30, 0xE0, 0x0C, 0xE0, 0x4E, 0xFF, 0xC3, 0xFF, 0x83, 0x07, 0x0C, 0x0C, 0x30, 0x30,
+  0xC1, 0xC3, 0xFE, 0x0F, 0xE0, 0x31, 0xC0, 0xC3, 0x83, 0x06, 0x0C, 0x1C, 0xFE, 0x3F, 0xF8, 0x70,
+  0x0C, 0xE0, 0xCA, 0x3E, 0xDF, 0xFE, 0x1F, 0x03, 0xC0, 0xFC, 0x07, 0xE0, 0x7E, 0x03, 0xF0, 0x3C,
+  0x0F, 0x87, 0xFF, 0xB7, 0xC0, 0x0C, 0xE0, 0x8C, 0xFF, 0xFF, 0xFF, 0xC6, 0x3C, 0x63, 0xC6, 0x3C,
+  0x63, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x3F, 0xC3, 0xFC, 0x0C, 0xE0, 0x4E,
+  0xFC, 0xFF, 0xF3, 0xF3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x30,
+  0xC0, 0xC3, 0x03, 0x06, 0x18, 0x1F, 0xE0, 0x1E, 0x00, 0x0C, 0xE0, 0x4F, 0xFE, 0xFF, 0xFD, 0xFC,
+  0xC0, 0x60, 0xC1, 0x81, 0x83, 0x03, 0x06, 0x03, 0x18, 0x06, 0x30, 0x06, 0xC0, 0x0D, 0x80, 0x1B,
+  0x00, 0x1C, 0x00, 0x38, 0x00, 0x20, 0x00, 0x0C, 0xE0, 0x11, 0xFE, 0x3F, 0xFF, 0x1F, 0xCC, 0x01,
+  0x86, 0x00, 0xC3, 0x08, 0x60, 0xCE, 0x60, 0x67, 0x30, 0x36, 0xD8, 0x1B, 0x6C, 0x0F, 0x3E, 0x03,
+  0x8E, 0x01, 0xC7, 0x00, 0xC1, 0x80, 0x60, 0xC0, 0x0C, 0xE0, 0x4E, 0xFC, 0xFF, 0xF3, 0xF3, 0x03,
+  0x06, 0x18, 0x0C, 0xC0, 0x1E, 0x00, 0x30, 0x00, 0xC0, 0x07, 0x80, 0x33, 0x01, 0x86, 0x0C, 0x0C,
+  0xFC, 0xFF, 0xF3, 0xF0, 0x0C, 0xE0, 0x4E, 0xF8, 0xFF, 0xE3, 0xF3, 0x03, 0x06, 0x18, 0x0C, 0xC0,
+  0x33, 0x00, 0x78, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x1F, 0xE0, 0x7F, 0x80,
+  0x0C, 0xE0, 0x8B, 0x7F, 0xEF, 0xFD, 0x81, 0xB0, 0x66, 0x18, 0xC6, 0x01, 0x80, 0x60, 0x18, 0x66,
+  0x0D, 0x81, 0xE0, 0x3F, 0xFF, 0xFF, 0xC0, 0x09, 0x21, 0xC5, 0xFF, 0xF1, 0x8C, 0x63, 0x18, 0xC6,
+  0x31, 0x8C, 0x63, 0x18, 0xFF, 0xC0, 0x01, 0x40, 0xCA, 0xC0, 0x30, 0x0E, 0x01, 0x80, 0x70, 0x0C,
+  0x03, 0x00, 0x60, 0x18, 0x03, 0x00, 0xC0, 0x18, 0x06, 0x00, 0xC0, 0x30, 0x0E, 0x01, 0x80, 0x70,
+  0x0C, 0x03, 0x09, 0x21, 0x05, 0xFF, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0xFF,
+  0xC0, 0x04, 0x80, 0xCB, 0x04, 0x01, 0xC0, 0x7C, 0x1D, 0xC3, 0x18, 0xC1, 0xB0, 0x1C, 0x01, 0x58,
+  0x20, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x41, 0x85, 0xC7, 0x0E, 0x30, 0x18, 0xB0, 0x8C, 0x3F,
+  0x07, 0xF8, 0x00, 0xC0, 0x0C, 0x1F, 0xC7, 0xFC, 0xE0, 0xCC, 0x0C, 0xC1, 0xC7, 0xFF, 0x3E, 0xF0,
+  0x08, 0xF0, 0x4D, 0xF0, 0x07, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x7C, 0x1F, 0xF8, 0xE0, 0xC6, 0x03,
+  0x30, 0x19, 0x80, 0xCC, 0x06, 0x60, 0x33, 0x83, 0x7F, 0xFB, 0xDF, 0x00, 0x18, 0xB0, 0x8C, 0x0F,
+  0xB3, 0xFF, 0x70, 0x7E, 0x03, 0xC0, 0x3C, 0x00, 0xC0, 0x0E, 0x03, 0x70, 0x73, 0xFE, 0x0F, 0xC0,
+  0x08, 0xF0, 0x8D, 0x01, 0xE0, 0x0F, 0x00, 0x18, 0x00, 0xC1, 0xF6, 0x3F, 0xF1, 0x83, 0x98, 0x0C,
+  0xC0, 0x66, 0x03, 0x30, 0x19, 0x80, 0xC6, 0x0E, 0x3F, 0xFC, 0x7D, 0xE0, 0x18, 0xB0, 0x8C, 0x1F,
+  0x87, 0xFE, 0x60, 0x6C, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x0C, 0x00, 0x60, 0x37, 0xFF, 0x1F, 0xC0,
+  0x08, 0xF0, 0x8C, 0x07, 0xF0, 0xFF, 0x18, 0x01, 0x80, 0xFF, 0xEF, 0xFE, 0x18, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x0F, 0xFC, 0xFF, 0xC0, 0x19, 0x00, 0x8D, 0x1F, 0x7B, 0xFF,
+  0xD8, 0x39, 0x80, 0xCC, 0x06, 0x60, 0x33, 0x01, 0x98, 0x0C, 0x60, 0xE3, 0xFF, 0x07, 0xD8, 0x00,
+  0xC0, 0x06, 0x00, 0x70, 0xFF, 0x07, 0xE0, 0x08, 0xF0, 0x4E, 0xF0, 0x03, 0xC0, 0x03, 0x00, 0x0C,
+  0x00, 0x37, 0xC0, 0xFF, 0x83, 0x87, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x30,
+  0x33, 0xF3, 0xFF, 0xCF, 0xC0, 0x08, 0xF0, 0x8C, 0x06, 0x00, 0x60, 0x00, 0x00, 0x00, 0x7E, 0x07,
+  0xE0, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x0F, 0xFF, 0xFF, 0xF0, 0x09,
+  0x40, 0xC9, 0x06, 0x03, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30,
+  0x18, 0x0C, 0x06, 0x03, 0x01, 0x81, 0xFF, 0xDF, 0x80, 0x08, 0xF0, 0x8C, 0xF0, 0x0F, 0x00, 0x30,
+  0x03, 0x00, 0x33, 0xE3, 0x3E, 0x33, 0x03, 0x60, 0x3E, 0x03, 0xC0, 0x3E, 0x03, 0x70, 0x33, 0x8F,
+  0x1F, 0xF1, 0xF0, 0x08, 0xF0, 0x8C, 0x7E, 0x07, 0xE0, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06,
+  0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x0F, 0xFF, 0xFF, 0xF0, 0x18, 0xB0, 0x10,
+  0xF7, 0x78, 0xFF, 0xFC, 0x39, 0xCC, 0x31, 0x8C, 0x31, 0x8C, 0x31, 0x8C, 0x31, 0x8C, 0x31, 0x8C,
+  0x31, 0x8C, 0xFD, 0xEF, 0xFD, 0xEF, 0x18, 0xB0, 0x4E, 0xF7, 0xC3, 0xFF, 0x83, 0x87, 0x0C, 0x0C,
+  0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x33, 0xF3, 0xFF, 0xCF, 0xC0, 0x18, 0xB0, 0x8C,
+  0x0F, 0x03, 0xFC, 0x70, 0xEE, 0x07, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x07, 0x70, 0xE3, 0xFC, 0x0F,
+  0x00, 0x19, 0x00, 0x4D, 0xF7, 0xC7, 0xFF, 0x8E, 0x0C, 0x60, 0x33, 0x01, 0x98, 0x0C, 0xC0, 0x66,
+  0x03, 0x38, 0x31, 0xFF, 0x8D, 0xF0, 0x60, 0x03, 0x00, 0x18, 0x03, 0xF8, 0x1F, 0xC0, 0x19, 0x00,
+  0x8D, 0x1F, 0x7B, 0xFF, 0xD8, 0x39, 0x80, 0xCC, 0x06, 0x60, 0x33, 0x01, 0x98, 0x0C, 0x60, 0xE3,
+  0xFF, 0x07, 0xD8, 0x00, 0xC0, 0x06, 0x00, 0x30, 0x0F, 0xE0, 0x7F, 0x18, 0xB0, 0x8C, 0xF9, 0xEF,
+  0xBF, 0x1F, 0x31, 0xC0, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x0F, 0xFC, 0xFF, 0xC0, 0x18,
+  0xB0, 0xCA, 0x3F, 0xDF, 0xFC, 0x0F, 0x03, 0xFC, 0x1F, 0xE0, 0x7F, 0x03, 0xC1, 0xFF, 0xEF, 0xF0,
+  0x08, 0xF0, 0x8C, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0xFF, 0xCF, 0xFC, 0x30, 0x03, 0x00, 0x30,
+  0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x71, 0xFF, 0x0F, 0xC0, 0x18, 0xB0, 0x4E, 0xF0, 0xF3, 0xC3,
+  0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x70, 0x7F, 0xF0, 0xFB,
+  0xC0, 0x18, 0xB0, 0x4E, 0xF8, 0x7F, 0xE1, 0xF3, 0x03, 0x0C, 0x0C, 0x18, 0x60, 0x61, 0x80, 0xCC,
+  0x03, 0x30, 0x0F, 0xC0, 0x1E, 0x00, 0x78, 0x00, 0x18, 0xB0, 0x4D, 0xF0, 0x7F, 0x83, 0xD8, 0x8C,
+  0xCE, 0x66, 0x73, 0x1A, 0xB0, 0xF7, 0x87, 0xBC, 0x38, 0xC0, 0xC6, 0x06, 0x30, 0x18, 0xB0, 0x8C,
+  0xF9, 0xFF, 0x9F, 0x30, 0xC1, 0x98, 0x0F, 0x00, 0x60, 0x0F, 0x01, 0x98, 0x30, 0xCF, 0x9F, 0xF9,
+  0xF0, 0x19, 0x00, 0x4F, 0xFC, 0x3F, 0xF8, 0x7C, 0xC0, 0x60, 0xC1, 0x81, 0x83, 0x01, 0x8C, 0x03,
+  0x18, 0x03, 0x60, 0x07, 0xC0, 0x07, 0x00, 0x06, 0x00, 0x18, 0x00, 0x30, 0x00, 0xC0, 0x1F, 0xE0,
+  0x3F, 0xC0, 0x18, 0xB0, 0xCA, 0xFF, 0xFF, 0xFC, 0x1B, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC3, 0x60,
+  0xFF, 0xFF, 0xFC, 0x09, 0x21, 0x46, 0x1C, 0xF3, 0x0C, 0x30, 0xC3, 0x0C, 0x73, 0x87, 0x0C, 0x30,
+  0xC3, 0x0C, 0x3C, 0x70, 0x09, 0x21, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x09, 0x21, 0x46, 0xE3,
+  0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x38, 0x73, 0x8C, 0x30, 0xC3, 0x0C, 0xF3, 0x80, 0x20, 0x50, 0x8B,
+  0x38, 0x0F, 0x8F, 0xBB, 0xE3, 0xE0, 0x38, 0x00, 0x00, 0x00,
+};
+
+static const uint16_t Font24_Offsets[] = {
+     0,    3,   12,   22,   47,   72,   94,  115,  121,  138,  155,  171,
+   192,  200,  206,  211,  239,  261,  283,  307,  329,  353,  377,  399,
+   421,  443,  465,  474,  487,  513,  526,  552,  571,  596,  627,  653,
+   677,  703,  727,  751,  777,  805,  826,  852,  882,  908,  939,  967,
+   991, 1015, 1044, 1072, 1093, 1117, 1145, 1175, 1208, 1236, 1264, 1287,
+  1302, 1330, 1345, 1359, 1366, 1372, 1392, 1420, 1440, 1468, 1488, 1514,
+  1543, 1573, 1599, 1625, 1651, 1677, 1702, 1725, 1745, 1774, 1803, 1823,
+  1840, 1866, 1889, 1912, 1933, 1953, 1986, 2003, 2020, 2028, 2045,
+};
+
+sFONT Font24 = {
+  NULL,
+  17, /* Width */
+  24, /* Height */
+  Font24_Packed,
+  Font24_Offsets,
+};
+
+#endif
@@ -0,0 +1,28 @@
+/*****************************************************************************
+* | File      	:   wake_gate_lp.c
+* | Author      :   lernerc606
+* | Function    :   LP core program for the timer wake gate
+* | Info        :
+*   Runs on the ESP32-C6 LP core every WAKE_TICK_US while the HP core is in
+*   deep sleep and only wakes the HP core when Wake_Gate_Tick() says a
+*   refresh is due. Needs an ESP-IDF build, see README.md.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+*
+******************************************************************************/
+#include <stdint.h>
+#include "ulp_lp_core_utils.h"
+#include "../Wake_Gate.h"
+
+// Visible to the HP core as ulp_Gate
+volatile WAKE_GATE Gate;
+
+int main(void)
+{
+    if (Gate.Magic == WAKE_GATE_MAGIC && Wake_Gate_Tick(&Gate))
+        ulp_lp_core_wakeup_main_processor();
+
+    // Returning halts the LP core until the next LP timer wake
+    return 0;
+}
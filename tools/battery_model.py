@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+"""Project battery life of the frame from the schedule in Scheduler.h.
+
+Reads SLEEP_TIME, the SCHED_* voltage thresholds and WAKE_TICK_MINUTES from
+the firmware headers, then steps a LiPo discharge curve refresh by refresh
+until the voltage reaches SCHED_RESERVE_MV (where the frame shows the low
+battery picture and stops waking).
+
+The charge figures are defaults measured on one frame; measure your own with
+a USB power meter and pass them in.
+
+Usage:
+    python tools/battery_model.py --capacity 2000
+    python tools/battery_model.py --capacity 2000 --refresh-mas 1800 --sleep-ua 60 --lp
+"""
+import argparse
+import os
+import re
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+# Resting LiPo voltage by state of charge (percent, mV), single cell
+LIPO_CURVE = [
+    (100, 4200), (90, 4060), (80, 3980), (70, 3920), (60, 3870),
+    (50, 3820), (40, 3790), (30, 3770), (20, 3740), (10, 3680),
+    (5, 3600), (0, 3300),
+]
+
+
+def read_defines(*names):
+    """Collect plain integer #defines from the given headers."""
+    defines = {}
+    for name in names:
+        with open(os.path.join(ROOT, name)) as f:
+            for line in f:
+                m = re.match(r'\s*#define\s+(\w+)\s+(0x[0-9A-Fa-f]+|\d+)[uUlL]*\b', line)
+                if m:
+                    defines[m.group(1)] = int(m.group(2), 0)
+    return defines
+
+
+def lipo_mv(soc):
+    """Interpolate the resting voltage for a state of charge in percent."""
+    for (s_hi, v_hi), (s_lo, v_lo) in zip(LIPO_CURVE, LIPO_CURVE[1:]):
+        if soc >= s_lo:
+            return v_lo + (v_hi - v_lo) * (soc - s_lo) / (s_hi - s_lo)
+    return LIPO_CURVE[-1][1]
+
+
+def interval_us(d, mv):
+    """Same stretch rule as Sched_Interval() for a successful wake."""
+    if mv < d['SCHED_STRETCH2_MV']:
+        return d['SLEEP_TIME'] * 4
+    if mv < d['SCHED_STRETCH1_MV']:
+        return d['SLEEP_TIME'] * 2
+    return d['SLEEP_TIME']
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Project battery life from the firmware schedule")
+    parser.add_argument('--capacity', type=float, required=True, help="battery capacity in mAh")
+    parser.add_argument('--refresh-mas', type=float, default=2400,
+                        help="charge per refresh wake in mA*s (default: 2400, ~30 s at 80 mA)")
+    parser.add_argument('--tick-mas', type=float, default=6,
+                        help="charge per skipped HP tick in mA*s (default: 6)")
+    parser.add_argument('--lp-tick-mas', type=float, default=0.05,
+                        help="charge per skipped LP core tick in mA*s (default: 0.05)")
+    parser.add_argument('--sleep-ua', type=float, default=40,
+                        help="deep sleep current in uA, including regulator and SD switch (default: 40)")
+    parser.add_argument('--lp', action='store_true', help="gate ticks on the LP core (WAKE_GATE_LP_CORE=1)")
+    parser.add_argument('--usable', type=float, default=0.9,
+                        help="fraction of the rated capacity actually available (default: 0.9)")
+    args = parser.parse_args()
+
+    d = read_defines('Scheduler.h', 'Wake_Gate.h')
+    tick_us = d['WAKE_TICK_MINUTES'] * 60 * 1000000
+    tick_mas = args.lp_tick_mas if args.lp else args.tick_mas
+
+    full_mas = args.capacity * 3600 * args.usable
+    charge = full_mas
+    elapsed_us = 0
+    refreshes = 0
+    bands = {}
+
+    while True:
+        mv = lipo_mv(100.0 * charge / full_mas)
+        if mv < d['SCHED_RESERVE_MV']:
+            break
+        period = interval_us(d, mv)
+        ticks = max(1, period // tick_us)
+        cost = args.refresh_mas + (ticks - 1) * tick_mas + args.sleep_ua / 1000.0 * period / 1e6
+        if cost > charge:
+            break
+        charge -= cost
+        elapsed_us += period
+        refreshes += 1
+        band = bands.setdefault(period, [0, 0])
+        band[0] += 1
+        band[1] += period
+
+    reserve_mas = charge
+    days = elapsed_us / 86400e6
+    print("Schedule: SLEEP_TIME %.1f h, tick %d min, reserve %d mV%s" % (
+        d['SLEEP_TIME'] / 3600e6, d['WAKE_TICK_MINUTES'], d['SCHED_RESERVE_MV'],
+        ", LP core gate" if args.lp else ""))
+    for period in sorted(bands):
+        count, total = bands[period]
+        print("  every %6.1f h: %5d refreshes over %6.1f days" % (period / 3600e6, count, total / 86400e6))
+    print("Lifetime: %.1f days (%.1f months), %d refreshes" % (days, days / 30.4, refreshes))
+    print("Charge left at the low battery frame: %.0f mAh (one refresh needs %.1f mAh)" % (
+        reserve_mas / 3600, args.refresh_mas / 3600))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,234 @@
+#!/usr/bin/env python3
+"""Check that eink_convert writes the same files as "convert_for_eink V5.py".
+
+The script's own functions are loaded from its source without Tk: the
+CONFIG constants and every top-level function, with the Entry and Scale
+widgets replaced by plain values. save_eink() and load_all_settings()
+then run unchanged, so the .raw and .s6t files come from the same code as
+the "Save" and "Load All" buttons. eink_convert converts the same pictures
+with every dithering path the CPU has, and each file must be byte for byte
+the script's.
+
+Without pictures a few are made: JPEG and PNG, color, grayscale, RGBA and
+palette, PPM, sizes that need scaling in both directions and one that fits
+exactly. The runs are portrait and landscape with the defaults, with other
+slider values, and with a settings file that changes the dither palette.
+
+Usage:
+    python tools/eink_convert/compare.py [--converter ./eink_convert] [PICTURE|FOLDER...]
+"""
+import argparse
+import ast
+import contextlib
+import io
+import os
+import subprocess
+import sys
+import tempfile
+import types
+
+import numpy as np
+from PIL import Image
+
+ROOT = os.path.dirname(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+SCRIPT = os.path.join(ROOT, "convert_for_eink V5.py")
+PATHS = ("scalar", "sse4.1", "avx2")
+SLIDERS = ("inv_gamma", "brightness", "contrast", "r", "g", "b")
+OPTIONS = ("--inv-gamma", "--brightness", "--contrast", "--r", "--g", "--b")
+DEFAULTS = (1.0, 0, 100, 100, 100, 100)
+
+# Runs: name, landscape, slider values or None for the settings file
+RUNS = [
+    ("portrait, defaults", False, DEFAULTS),
+    ("landscape, defaults", True, DEFAULTS),
+    ("portrait, adjusted", False, (1.4, -12, 120, 95, 104, 100)),
+    ("landscape, adjusted", True, (0.8, 7, 88, 100, 97, 110)),
+    ("portrait, settings file", False, None),
+    ("landscape, settings file", True, None),
+]
+
+# "Save All" file: sliders, dither palette, e-ink palette
+SETTINGS = """0.9
+-5
+110
+100
+97
+103
+20 20 20
+200 250 250
+250 250 10
+250 60 60
+40 60 250
+90.7 150 70
+0 0 0
+140 140 110
+140 120 0
+100 15 15
+40 40 100
+40 63 41"""
+
+
+class Widget:
+    """Stands in for a tk.Entry or tk.Scale: holds the text it shows."""
+
+    def __init__(self, value=""):
+        self.value = str(value)
+
+    def get(self):
+        return self.value
+
+    def set(self, value):
+        self.value = str(value)
+
+    def delete(self, first, last=None):
+        self.value = ""
+
+    def insert(self, index, text):
+        self.value = str(text)
+
+
+def load_script():
+    """Namespace with the script's constants and functions, and no window."""
+    with open(SCRIPT, encoding="utf-8") as f:
+        tree = ast.parse(f.read(), SCRIPT)
+    window = next(node.lineno for node in tree.body if isinstance(node, ast.Assign)
+                  and ast.unparse(node.value) == "tk.Tk()")
+    body = []
+    for node in tree.body:
+        if isinstance(node, ast.FunctionDef):
+            body.append(node)
+        elif isinstance(node, ast.Assign) and node.lineno < window:
+            body.append(node)
+    ns = {"os": os, "struct": __import__("struct"), "np": np, "Image": Image,
+          "tk": types.SimpleNamespace(END="end")}
+    exec(compile(ast.Module(body=body, type_ignores=[]), SCRIPT, "exec"), ns)
+    for name in SLIDERS:
+        ns[name + "_slider"] = Widget()
+        ns[name + "_field"] = Widget()
+    ns["apply_palette"] = lambda: None
+    return ns
+
+
+def script_convert(ns, pictures, landscape, values, settings, out):
+    """Save every picture the way the "Save" button does, into out."""
+    for name, value in zip(SLIDERS, DEFAULTS):
+        ns[name + "_slider"].set(value)
+        ns[name + "_field"].set(value)
+    for i in range(6):
+        for j in range(3):
+            ns["dith_palette_entries"][i][j] = Widget(ns["DEFAULT_DITHER_PALETTE"][i][j])
+            ns["eink_palette_entries"][i][j] = Widget(ns["DEFAULT_EINK_PALETTE"][i][j])
+    if values is None:
+        ns["filedialog"] = types.SimpleNamespace(askopenfilename=lambda: settings)
+        with contextlib.redirect_stdout(io.StringIO()):
+            ns["load_all_settings"]()
+    else:
+        for name, value in zip(SLIDERS, values):
+            ns[name + "_field"].set(value)
+    ns["is_landscape"] = landscape
+    for picture in pictures:
+        ns["original_img"] = Image.open(picture).convert("RGB")
+        ns["image_path"] = os.path.join(out, os.path.basename(picture))
+        with contextlib.redirect_stdout(io.StringIO()):
+            ns["save_eink"]()
+
+
+def native_convert(converter, path, pictures, landscape, values, settings, out):
+    """Run eink_convert; False if this CPU lacks the dithering path."""
+    cmd = [converter, "--dither", path, "--out", out, "--threads", "1"]
+    if landscape:
+        cmd.append("--landscape")
+    if values is None:
+        cmd += ["--settings", settings]
+    else:
+        for option, value in zip(OPTIONS, values):
+            cmd += [option, str(value)]
+    run = subprocess.run(cmd + pictures, capture_output=True, text=True)
+    if "not supported" in run.stderr:
+        return False
+    if run.returncode != 0:
+        sys.exit("%s failed:\n%s" % (" ".join(cmd), run.stderr))
+    return True
+
+
+def read(path):
+    """Bytes of a file, None if it is missing."""
+    if not os.path.exists(path):
+        return None
+    with open(path, "rb") as f:
+        return f.read()
+
+
+def make_pictures(folder):
+    """A few small pictures covering the formats and shapes the tools read."""
+    rng = np.random.default_rng(1)
+
+    def gradient(w, h):
+        y, x = np.mgrid[0:h, 0:w]
+        return np.stack([x * 255 // max(w - 1, 1), y * 255 // max(h - 1, 1),
+                         (x + y) * 7 % 256], -1).astype(np.uint8)
+
+    pictures = {
+        "gradient.jpg": Image.fromarray(gradient(640, 480)),
+        "odd.png": Image.fromarray(gradient(1201, 1599)),
+        "noise.png": Image.fromarray(rng.integers(0, 256, (333, 777, 3), dtype=np.uint8)),
+        "gray.jpg": Image.fromarray(gradient(2000, 1500)[..., 0]),
+        "exact.ppm": Image.fromarray(gradient(1200, 1600)),
+        "alpha.png": Image.fromarray(np.dstack([gradient(500, 900), np.full((900, 500, 1), 128, np.uint8)])),
+        "palette.png": Image.fromarray(gradient(1700, 1100)).quantize(64),
+    }
+    paths = []
+    for name, img in pictures.items():
+        path = os.path.join(folder, name)
+        if name.endswith(".jpg"):
+            img.save(path, quality=90)
+        else:
+            img.save(path)
+        paths.append(path)
+    return paths
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare eink_convert with convert_for_eink V5.py")
+    parser.add_argument("--converter", default="./eink_convert", help="eink_convert binary")
+    parser.add_argument("pictures", nargs="*", help="pictures or folders; made up if none")
+    args = parser.parse_args()
+
+    ns = load_script()
+    with tempfile.TemporaryDirectory() as tmp:
+        pictures = []
+        for arg in args.pictures:
+            if os.path.isdir(arg):
+                pictures += sorted(os.path.join(arg, n) for n in os.listdir(arg)
+                                   if n.lower().endswith((".jpg", ".jpeg", ".png", ".ppm")))
+            else:
+                pictures.append(arg)
+        if not pictures:
+            os.mkdir(os.path.join(tmp, "in"))
+            pictures = make_pictures(os.path.join(tmp, "in"))
+        settings = os.path.join(tmp, "settings.txt")
+        with open(settings, "w") as f:
+            f.write(SETTINGS)
+
+        failed = 0
+        for name, landscape, values in RUNS:
+            ref = os.path.join(tmp, "script")
+            os.makedirs(ref, exist_ok=True)
+            for n in os.listdir(ref):
+                os.remove(os.path.join(ref, n))
+            script_convert(ns, pictures, landscape, values, settings, ref)
+            files = sorted(os.listdir(ref))
+            for path in PATHS:
+                out = os.path.join(tmp, path)
+                os.makedirs(out, exist_ok=True)
+                if not native_convert(args.converter, path, pictures, landscape, values, settings, out):
+                    continue
+                differ = [n for n in files if read(os.path.join(ref, n)) != read(os.path.join(out, n))]
+                print("%-26s %-7s %2d files  %s" % (name, path, len(files),
+                                                   "identical" if not differ else "DIFFER: " + " ".join(differ)))
+                failed |= bool(differ)
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
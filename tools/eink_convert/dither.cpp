@@ -0,0 +1,494 @@
+/*****************************************************************************
+* | File      	:   dither.cpp
+* | Author      :   lernerc606
+* | Function    :   Floyd-Steinberg dithering to the six panel colors
+* | Info        :
+*   Pillow dithers in integers: each channel gets the error carried from
+*   the left (7/16) and from the row above (3/16, 5/16, 1/16) added up
+*   before one division by 16, is clipped to 0..255, and the nearest
+*   palette entry is the one closest to it with the low two bits cleared,
+*   the first one on a tie. At the end of each row Pillow stores the blue
+*   sums in the last slot of all three channels; that is kept.
+*
+*   A pixel needs the one to its left and the row above up to one pixel
+*   to its right, so DITHER_ROWS rows are dithered together, each two
+*   pixels behind the one above. Their chains do not wait for each other
+*   and the CPU works on all of them at once. Each row reads the error
+*   line of the row above and writes its own, from a ring of
+*   DITHER_ROWS + 1 lines.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+*
+******************************************************************************/
+#include "dither.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+#include <filesystem>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define DITHER_X86 1
+#include <immintrin.h>
+#else
+#define DITHER_X86 0
+#endif
+
+#define DITHER_ROWS     4       // rows in flight
+#define DITHER_LAG      2       // pixels each row stays behind the one above
+
+/******************************************************************************
+function :  Build the palette from the six dither colors and their codes
+parameter:
+    Colors : R, G, B of palette entries 0 to 5
+    Codes  : panel code of each entry
+******************************************************************************/
+void Dither_MakePalette(DITHER_PALETTE *Pal, const int Colors[6][3], const uint8_t Codes[6])
+{
+    memset(Pal->Color, 0, sizeof(Pal->Color));
+    memset(Pal->Code, 0, sizeof(Pal->Code));
+    for (int i = 0; i < 7; i++) {
+        for (int c = 0; c < 3; c++)
+            Pal->Color[i][c] = (i < 6)? Colors[i][c] : 0;
+        if (i < 6)
+            Pal->Code[i] = Codes[i];
+    }
+
+    Pal->Nearest.resize(64 * 64 * 64);
+    for (int b = 0; b < 64; b++)
+        for (int g = 0; g < 64; g++)
+            for (int r = 0; r < 64; r++) {
+                unsigned Best = ~0u;
+                for (int i = 0; i < 7; i++) {
+                    int dr = r * 4 - Pal->Color[i][0], dg = g * 4 - Pal->Color[i][1], db = b * 4 - Pal->Color[i][2];
+                    unsigned d = dr * dr + dg * dg + db * db;
+                    if (d < Best) {
+                        Best = d;
+                        Pal->Nearest[(b * 64 + g) * 64 + r] = i;
+                    }
+                }
+            }
+}
+
+/******************************************************************************
+function :  Linear light of an sRGB value
+parameter:
+    v : 0 to 255, fractions allowed
+return   :  0 to 1
+******************************************************************************/
+double Dither_Linear(double v)
+{
+    v /= 255;
+    return (v <= 0.04045)? v / 12.92 : pow((v + 0.055) / 1.055, 2.4);
+}
+
+static const double Dither_Lms[3][3] = {
+    { 0.4122214708, 0.5363325363, 0.0514459929 },
+    { 0.2119034982, 0.6806995451, 0.1073969566 },
+    { 0.0883024619, 0.2817188376, 0.6299787005 },
+};
+
+static void Dither_LmsToOklab(const double Lms[3], double Lab[3])
+{
+    double l = cbrt(Lms[0]), m = cbrt(Lms[1]), s = cbrt(Lms[2]);
+    Lab[0] = 0.2104542553 * l + 0.7936177850 * m - 0.0040720468 * s;
+    Lab[1] = 1.9779984951 * l - 2.4285922050 * m + 0.4505937099 * s;
+    Lab[2] = 0.0259040371 * l + 0.7827717662 * m - 0.8086757660 * s;
+}
+
+/******************************************************************************
+function :  OKLab of a linear RGB color
+parameter:
+    Linear : R, G, B, 0 to 1
+    Lab    : L (0 to 1), a, b
+******************************************************************************/
+void Dither_Oklab(const double Linear[3], double Lab[3])
+{
+    double Lms[3];
+    for (int i = 0; i < 3; i++)
+        Lms[i] = Dither_Lms[i][0] * Linear[0] + Dither_Lms[i][1] * Linear[1] + Dither_Lms[i][2] * Linear[2];
+    Dither_LmsToOklab(Lms, Lab);
+}
+
+/******************************************************************************
+function :  Match colors by OKLab distance
+parameter:
+    CacheDir : Folder for the table file, NULL or "" to build it every time
+    File     : Set to the table file's path
+return   :  Where the table came from
+info     :  Each cell of the table holds the one of the six colors nearest
+            to the middle of the cell, (R, G, B >> 2) * 4 + 1.5. Pillow's
+            black padding entry is left out. The file name spells out
+            the six colors, so a new palette gets its own table; the file
+            holds them again and is rebuilt if they do not match.
+******************************************************************************/
+#define DITHER_LUT_SIZE     (64 * 64 * 64)
+
+DITHER_LUT Dither_UseOklab(DITHER_PALETTE *Pal, const char *CacheDir, std::string *File)
+{
+    uint8_t Header[4 + 18];
+    char Name[64];
+
+    memcpy(Header, "S6L1", 4);
+    for (int i = 0; i < 6; i++)
+        for (int c = 0; c < 3; c++)
+            Header[4 + i * 3 + c] = Pal->Color[i][c];
+    snprintf(Name, sizeof(Name), "oklab-%02x%02x%02x-%02x%02x%02x-%02x%02x%02x-%02x%02x%02x-%02x%02x%02x-%02x%02x%02x.lut",
+             Header[4], Header[5], Header[6], Header[7], Header[8], Header[9], Header[10], Header[11], Header[12],
+             Header[13], Header[14], Header[15], Header[16], Header[17], Header[18], Header[19], Header[20], Header[21]);
+    File->clear();
+    if (CacheDir != NULL && CacheDir[0] != 0)
+        *File = (std::filesystem::path(CacheDir) / Name).string();
+
+    Pal->Nearest.resize(DITHER_LUT_SIZE);
+    if (!File->empty()) {
+        FILE *f = fopen(File->c_str(), "rb");
+        if (f != NULL) {
+            uint8_t Check[sizeof(Header)];
+            int Good = fread(Check, 1, sizeof(Check), f) == sizeof(Check) && !memcmp(Check, Header, sizeof(Check)) &&
+                       fread(Pal->Nearest.data(), 1, DITHER_LUT_SIZE, f) == DITHER_LUT_SIZE && fgetc(f) == EOF;
+            fclose(f);
+            if (Good)
+                return DITHER_LUT_LOADED;
+        }
+    }
+
+    double Cell[3][64][3], Lab[6][3];
+    for (int i = 0; i < 6; i++) {
+        double Linear[3] = { Dither_Linear(Pal->Color[i][0]), Dither_Linear(Pal->Color[i][1]),
+                             Dither_Linear(Pal->Color[i][2]) };
+        Dither_Oklab(Linear, Lab[i]);
+    }
+    // The step to LMS is linear: each axis' share is worked out once
+    for (int v = 0; v < 64; v++) {
+        double c = Dither_Linear(v * 4 + 1.5);
+        for (int Axis = 0; Axis < 3; Axis++)
+            for (int k = 0; k < 3; k++)
+                Cell[Axis][v][k] = Dither_Lms[k][Axis] * c;
+    }
+    for (int b = 0; b < 64; b++)
+        for (int g = 0; g < 64; g++)
+            for (int r = 0; r < 64; r++) {
+                double Lms[3], Ok[3], Best = 1e9;
+                for (int k = 0; k < 3; k++)
+                    Lms[k] = Cell[0][r][k] + Cell[1][g][k] + Cell[2][b][k];
+                Dither_LmsToOklab(Lms, Ok);
+                for (int i = 0; i < 6; i++) {
+                    double d = (Ok[0] - Lab[i][0]) * (Ok[0] - Lab[i][0]) + (Ok[1] - Lab[i][1]) * (Ok[1] - Lab[i][1]) +
+                               (Ok[2] - Lab[i][2]) * (Ok[2] - Lab[i][2]);
+                    if (d < Best) {
+                        Best = d;
+                        Pal->Nearest[(b * 64 + g) * 64 + r] = i;
+                    }
+                }
+            }
+    if (File->empty())
+        return DITHER_LUT_UNSAVED;
+
+    // Written whole under another name, so a reader never sees half a table
+    std::error_code Err;
+    std::filesystem::create_directories(CacheDir, Err);
+    std::string Temp = *File + "." + std::to_string(getpid());
+    FILE *f = fopen(Temp.c_str(), "wb");
+    if (f == NULL)
+        return DITHER_LUT_UNSAVED;
+    int Failed = fwrite(Header, 1, sizeof(Header), f) != sizeof(Header) ||
+                 fwrite(Pal->Nearest.data(), 1, DITHER_LUT_SIZE, f) != DITHER_LUT_SIZE;
+    Failed |= fclose(f) != 0;
+    if (Failed || rename(Temp.c_str(), File->c_str()) != 0) {
+        remove(Temp.c_str());
+        return DITHER_LUT_UNSAVED;
+    }
+    return DITHER_LUT_BUILT;
+}
+
+/******************************************************************************
+Running the rows
+    DITHER_WAVE(ROW, Stride, Pixel, End) dithers a frame with row state
+    ROW, zeroed at the start of each row, error lines of Stride ints a
+    pixel, Pixel(Pal, Row, x) for each pixel and End(Row, Width) after the
+    last one. A macro, so the SIMD paths get it compiled for their target.
+******************************************************************************/
+#define DITHER_WAVE(ROW, Stride, Pixel, End)                                                  \
+    std::vector<int> Line[DITHER_ROWS + 1];                                                   \
+    std::vector<uint8_t> Index[DITHER_ROWS];                                                  \
+    for (int k = 0; k <= DITHER_ROWS; k++)                                                    \
+        Line[k].assign(((size_t)Width + 1) * Stride, 0);                                      \
+    for (int k = 0; k < DITHER_ROWS; k++)                                                     \
+        Index[k].resize(Width);                                                               \
+    for (int y0 = 0; y0 < Height; y0 += DITHER_ROWS) {                                        \
+        int Rows = (Height - y0 < DITHER_ROWS)? Height - y0 : DITHER_ROWS;                    \
+        ROW Row[DITHER_ROWS];                                                                 \
+        for (int k = 0; k < Rows; k++) {                                                      \
+            memset(&Row[k], 0, sizeof(ROW));                                                  \
+            Row[k].p = Rgb + (size_t)(y0 + k) * Width * 3;                                    \
+            Row[k].In = Line[(y0 + k) % (DITHER_ROWS + 1)].data();                            \
+            Row[k].Out = Line[(y0 + k + 1) % (DITHER_ROWS + 1)].data();                       \
+            Row[k].Index = Index[k].data();                                                   \
+        }                                                                                     \
+        int Steps = Width + DITHER_LAG * (Rows - 1);                                          \
+        int Full = (Rows == DITHER_ROWS)? Width - 1 : 0;                                      \
+        for (int t = 0; t < Steps; t++) {                                                     \
+            if (t >= DITHER_LAG * (DITHER_ROWS - 1) && t < Full) {                            \
+                /* all rows inside the frame */                                               \
+                for (int k = 0; k < DITHER_ROWS; k++)                                         \
+                    Pixel(Pal, &Row[k], t - DITHER_LAG * k);                                  \
+                continue;                                                                     \
+            }                                                                                 \
+            for (int k = 0; k < Rows; k++) {                                                  \
+                int x = t - DITHER_LAG * k;                                                   \
+                if (x >= 0 && x < Width)                                                      \
+                    Pixel(Pal, &Row[k], x);                                                   \
+                if (x == Width - 1)                                                           \
+                    End(&Row[k], Width);                                                      \
+            }                                                                                 \
+        }                                                                                     \
+        for (int k = 0; k < Rows; k++)                                                        \
+            Pack(Pal, Index[k].data(), Width, Packed + (size_t)(y0 + k) * (Width / 2));       \
+    }
+
+/******************************************************************************
+Scalar path
+    Pillow's loop as it is, with the nearest entry from the table.
+******************************************************************************/
+typedef struct {
+    const uint8_t *p;
+    const int *In;              // error line of the row above
+    int *Out;                   // error line of this row
+    uint8_t *Index;
+    int r, r0, r1;
+    int g, g0, g1;
+    int b, b0, b1, b2;
+} DITHER_ROW;
+
+static inline int Dither_Clip(int v)
+{
+    return (v <= 0)? 0 : (v < 256)? v : 255;
+}
+
+static inline void Dither_PixelScalar(const DITHER_PALETTE *Pal, DITHER_ROW *Row, int x)
+{
+    const uint8_t *p = Row->p + x * 3;
+    const int *e = Row->In + x * 3;
+    int *o = Row->Out + x * 3;
+    int r, g, b, r2, g2, d2;
+
+    r = Dither_Clip(p[0] + (Row->r + e[3]) / 16);
+    g = Dither_Clip(p[1] + (Row->g + e[4]) / 16);
+    b = Dither_Clip(p[2] + (Row->b + e[5]) / 16);
+
+    int i = Pal->Nearest[((b >> 2) * 64 + (g >> 2)) * 64 + (r >> 2)];
+    Row->Index[x] = i;
+    r -= Pal->Color[i][0];
+    g -= Pal->Color[i][1];
+    b -= Pal->Color[i][2];
+
+    r2 = r; d2 = r + r; r += d2; o[0] = r + Row->r0; r += d2; Row->r0 = r + Row->r1; Row->r1 = r2; r += d2;
+    g2 = g; d2 = g + g; g += d2; o[1] = g + Row->g0; g += d2; Row->g0 = g + Row->g1; Row->g1 = g2; g += d2;
+    Row->b2 = b; d2 = b + b; b += d2; o[2] = b + Row->b0; b += d2; Row->b0 = b + Row->b1; Row->b1 = Row->b2; b += d2;
+    Row->r = r;
+    Row->g = g;
+    Row->b = b;
+}
+
+static inline void Dither_EndScalar(DITHER_ROW *Row, int Width)
+{
+    Row->Out[Width * 3] = Row->b0;
+    Row->Out[Width * 3 + 1] = Row->b1;
+    Row->Out[Width * 3 + 2] = Row->b2;
+}
+
+static void Dither_PackScalar(const DITHER_PALETTE *Pal, const uint8_t *Index, int Width, uint8_t *Packed)
+{
+    for (int x = 0; x < Width; x += 2)
+        *Packed++ = (Pal->Code[Index[x]] << 4) | Pal->Code[Index[x + 1]];
+}
+
+static void Dither_FrameScalar(const DITHER_PALETTE *Pal, const uint8_t *Rgb, int Width, int Height,
+                               uint8_t *Packed)
+{
+#define Pack Dither_PackScalar
+    DITHER_WAVE(DITHER_ROW, 3, Dither_PixelScalar, Dither_EndScalar)
+#undef Pack
+}
+
+/******************************************************************************
+SSE4.1 and AVX2 paths
+    The error lines hold four ints a pixel (R, G, B, unused) so one
+    register carries a pixel. The nearest entry comes from the same table
+    as on the scalar path; that was faster than measuring the distance
+    to every entry in registers.
+******************************************************************************/
+#if DITHER_X86
+typedef struct {
+    const uint8_t *p;
+    const int *In;
+    int *Out;
+    uint8_t *Index;
+    __m128i Carry;              // 7/16 of the last error, times 16
+    __m128i e1, e2;             // error of the last pixel and the one before
+} DITHER_ROW4;
+
+__attribute__((target("sse4.1")))
+static inline __m128i Dither_Div16(__m128i s)
+{
+    // C division: towards zero
+    return _mm_srai_epi32(_mm_add_epi32(s, _mm_and_si128(_mm_srai_epi32(s, 31), _mm_set1_epi32(15))), 4);
+}
+
+__attribute__((target("sse4.1")))
+static inline __m128i Dither_Load(const uint8_t *p)
+{
+    uint16_t rg;
+    memcpy(&rg, p, 2);
+    return _mm_cvtepu8_epi32(_mm_cvtsi32_si128(rg | p[2] << 16));
+}
+
+// Index of the table cell: (B >> 2) * 4096 + (G >> 2) * 64 + (R >> 2)
+__attribute__((target("sse4.1")))
+static inline int Dither_Cell(__m128i v)
+{
+    __m128i q = _mm_srli_epi32(v, 2);
+    __m128i w = _mm_madd_epi16(_mm_packs_epi32(q, q), _mm_setr_epi16(1, 64, 4096, 0, 0, 0, 0, 0));
+    return _mm_cvtsi128_si32(_mm_add_epi32(w, _mm_srli_si128(w, 4)));
+}
+
+__attribute__((target("sse4.1")))
+static inline void Dither_PixelSimd(const DITHER_PALETTE *Pal, DITHER_ROW4 *Row, int x)
+{
+    __m128i s = Dither_Div16(_mm_add_epi32(Row->Carry, _mm_loadu_si128((const __m128i *)&Row->In[(x + 1) * 4])));
+    __m128i v = _mm_min_epi32(_mm_max_epi32(_mm_add_epi32(Dither_Load(Row->p + x * 3), s), _mm_setzero_si128()),
+                              _mm_set1_epi32(255));
+    int i = Pal->Nearest[Dither_Cell(v)];
+    Row->Index[x] = i;
+    __m128i Err = _mm_sub_epi32(v, _mm_loadu_si128((const __m128i *)Pal->Color[i]));
+    Row->Carry = _mm_sub_epi32(_mm_slli_epi32(Err, 3), Err);
+
+    // 3/16 of this pixel, 5/16 of the last and 1/16 of the one before
+    __m128i Below = _mm_add_epi32(_mm_add_epi32(_mm_add_epi32(Err, _mm_add_epi32(Err, Err)), Row->e2),
+                                  _mm_add_epi32(_mm_slli_epi32(Row->e1, 2), Row->e1));
+    _mm_storeu_si128((__m128i *)&Row->Out[x * 4], Below);
+    Row->e2 = Row->e1;
+    Row->e1 = Err;
+}
+
+// Pillow's last slot: 5/16 + 1/16 of blue, then blue twice
+__attribute__((target("sse4.1")))
+static inline void Dither_EndSimd(DITHER_ROW4 *Row, int Width)
+{
+    __m128i Blue5 = _mm_add_epi32(_mm_add_epi32(_mm_slli_epi32(Row->e1, 2), Row->e1), Row->e2);
+    Row->Out[Width * 4] = _mm_extract_epi32(Blue5, 2);
+    Row->Out[Width * 4 + 1] = Row->Out[Width * 4 + 2] = _mm_extract_epi32(Row->e1, 2);
+}
+
+// Codes looked up 16 at a time, then pairs joined as High * 16 + Low
+__attribute__((target("sse4.1")))
+static void Dither_PackSse(const DITHER_PALETTE *Pal, const uint8_t *Index, int Width, uint8_t *Packed)
+{
+    __m128i Codes = _mm_loadu_si128((const __m128i *)Pal->Code);
+    __m128i Join = _mm_set1_epi16(0x0110);
+    int x = 0;
+
+    for (; x + 32 <= Width; x += 32, Packed += 16) {
+        __m128i a = _mm_shuffle_epi8(Codes, _mm_loadu_si128((const __m128i *)&Index[x]));
+        __m128i b = _mm_shuffle_epi8(Codes, _mm_loadu_si128((const __m128i *)&Index[x + 16]));
+        a = _mm_maddubs_epi16(a, Join);
+        b = _mm_maddubs_epi16(b, Join);
+        _mm_storeu_si128((__m128i *)Packed, _mm_packus_epi16(a, b));
+    }
+    Dither_PackScalar(Pal, Index + x, Width - x, Packed);
+}
+
+__attribute__((target("avx2")))
+static void Dither_PackAvx2(const DITHER_PALETTE *Pal, const uint8_t *Index, int Width, uint8_t *Packed)
+{
+    __m256i Codes = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)Pal->Code));
+    __m256i Join = _mm256_set1_epi16(0x0110);
+    int x = 0;
+
+    for (; x + 64 <= Width; x += 64, Packed += 32) {
+        __m256i a = _mm256_shuffle_epi8(Codes, _mm256_loadu_si256((const __m256i *)&Index[x]));
+        __m256i b = _mm256_shuffle_epi8(Codes, _mm256_loadu_si256((const __m256i *)&Index[x + 32]));
+        a = _mm256_maddubs_epi16(a, Join);
+        b = _mm256_maddubs_epi16(b, Join);
+        // packus works per 128 bit half
+        _mm256_storeu_si256((__m256i *)Packed, _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xD8));
+    }
+    Dither_PackSse(Pal, Index + x, Width - x, Packed);
+}
+
+__attribute__((target("sse4.1")))
+static void Dither_FrameSse(const DITHER_PALETTE *Pal, const uint8_t *Rgb, int Width, int Height,
+                            uint8_t *Packed)
+{
+#define Pack Dither_PackSse
+    DITHER_WAVE(DITHER_ROW4, 4, Dither_PixelSimd, Dither_EndSimd)
+#undef Pack
+}
+
+__attribute__((target("avx2")))
+static void Dither_FrameAvx2(const DITHER_PALETTE *Pal, const uint8_t *Rgb, int Width, int Height,
+                             uint8_t *Packed)
+{
+#define Pack Dither_PackAvx2
+    DITHER_WAVE(DITHER_ROW4, 4, Dither_PixelSimd, Dither_EndSimd)
+#undef Pack
+}
+#endif
+
+int Dither_Supported(DITHER_PATH Path)
+{
+    switch (Path) {
+    case DITHER_SCALAR:
+        return 1;
+#if DITHER_X86
+    case DITHER_SSE41:
+        return __builtin_cpu_supports("sse4.1");
+    case DITHER_AVX2:
+        return __builtin_cpu_supports("avx2");
+#endif
+    default:
+        return 0;
+    }
+}
+
+DITHER_PATH Dither_Best(void)
+{
+    for (int p = DITHER_PATHS - 1; p > DITHER_SCALAR; p--)
+        if (Dither_Supported((DITHER_PATH)p))
+            return (DITHER_PATH)p;
+    return DITHER_SCALAR;
+}
+
+const char *Dither_Name(DITHER_PATH Path)
+{
+    static const char *Name[DITHER_PATHS] = { "scalar", "sse4.1", "avx2" };
+    return (Path < DITHER_PATHS)? Name[Path] : "?";
+}
+
+/******************************************************************************
+function :  Dither a frame
+parameter:
+    Path   : A supported path
+    Rgb    : Width x Height pixels of 3 bytes
+    Width  : Even
+    Packed : Width / 2 x Height bytes of panel codes
+******************************************************************************/
+void Dither_Frame(DITHER_PATH Path, const DITHER_PALETTE *Pal, const uint8_t *Rgb, int Width, int Height,
+                  uint8_t *Packed)
+{
+    switch (Path) {
+#if DITHER_X86
+    case DITHER_SSE41:
+        Dither_FrameSse(Pal, Rgb, Width, Height, Packed);
+        break;
+    case DITHER_AVX2:
+        Dither_FrameAvx2(Pal, Rgb, Width, Height, Packed);
+        break;
+#endif
+    default:
+        Dither_FrameScalar(Pal, Rgb, Width, Height, Packed);
+        break;
+    }
+}
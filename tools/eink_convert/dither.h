@@ -0,0 +1,62 @@
+/*****************************************************************************
+* | File      	:   dither.h
+* | Author      :   lernerc606
+* | Function    :   Floyd-Steinberg dithering to the six panel colors
+* | Info        :
+*   Dithers a frame the way Pillow's quantize(dither=True) does for the
+*   palette of "convert_for_eink V5.py" and writes the panel codes at once
+*   as packed 4bpp, left pixel in the high nibble.
+*
+*   The error carried along a row makes every pixel wait for the one
+*   before it, so the paths differ in how fast they get through that
+*   chain: the scalar path works on R, G and B one by one, the SSE4.1
+*   and AVX2 paths hold them in one register. Packing the codes works on
+*   16 or 32 pixels at a time. All paths give the same bytes.
+*
+*   Every path looks the nearest color up in a table of 64 x 64 x 64
+*   cells. Dither_MakePalette() fills it as Pillow matches, by RGB
+*   distance; Dither_UseOklab() fills it by distance in OKLab, where equal
+*   steps look about equally different. That search is slower, so its
+*   table is kept in a file named after the palette.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+*
+******************************************************************************/
+#ifndef _DITHER_H_
+#define _DITHER_H_
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+typedef enum {
+    DITHER_SCALAR = 0,
+    DITHER_SSE41,
+    DITHER_AVX2,
+    DITHER_PATHS,
+} DITHER_PATH;
+
+typedef struct {
+    int Color[8][4];                // R, G, B, 0; entry 6 is Pillow's black padding
+    uint8_t Code[16];               // panel code of each entry
+    std::vector<uint8_t> Nearest;   // 64 x 64 x 64, by B, G, R >> 2
+} DITHER_PALETTE;
+
+typedef enum {
+    DITHER_LUT_BUILT = 0,           // and saved
+    DITHER_LUT_LOADED,
+    DITHER_LUT_UNSAVED,             // built, the cache could not be written
+} DITHER_LUT;
+
+void Dither_MakePalette(DITHER_PALETTE *Pal, const int Colors[6][3], const uint8_t Codes[6]);
+DITHER_LUT Dither_UseOklab(DITHER_PALETTE *Pal, const char *CacheDir, std::string *File);
+double Dither_Linear(double v);
+void Dither_Oklab(const double Linear[3], double Lab[3]);
+int Dither_Supported(DITHER_PATH Path);
+DITHER_PATH Dither_Best(void);
+const char *Dither_Name(DITHER_PATH Path);
+void Dither_Frame(DITHER_PATH Path, const DITHER_PALETTE *Pal, const uint8_t *Rgb, int Width, int Height,
+                  uint8_t *Packed);
+
+#endif
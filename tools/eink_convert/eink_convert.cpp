@@ -0,0 +1,916 @@
+/*****************************************************************************
+* | File      	:   eink_convert.cpp
+* | Author      :   lernerc606
+* | Function    :   Convert a folder of pictures to .raw files on all cores
+* | Info        :
+*   A command line version of the pipeline in "convert_for_eink V5.py":
+*   inverse gamma, brightness and contrast, R/G/B percentages, Lanczos
+*   scaling into a 1200 x 1600 (or 1600 x 1200) letterbox, Floyd-Steinberg
+*   dithering to DEFAULT_DITHER_PALETTE and RAW_MAP, and in landscape a
+*   .s6t tile file besides the rotated .raw. For the same settings and
+*   picture the files are byte for byte the ones the script saves: every
+*   step does the script's float32 arithmetic, or Pillow's fixed point
+*   resampling and dithering, in the same order.
+*
+*   Each picture is converted by one thread; a pool of threads takes the
+*   next picture from a shared counter. JPEG (RGB or grayscale), PNG (8
+*   bit, or 16 bit color) and binary PPM are read. The dithering is in
+*   dither.cpp, on the fastest path the CPU has (--dither to choose one);
+*   --bench times every path on one frame.
+*
+*   --match oklab picks each pixel's color by OKLab distance through a
+*   table cached in --lut-cache (default ~/.cache/eink_convert). The
+*   script has no such mode, so those files differ from its output.
+*
+*   Build from the repository root:
+*     g++ -O2 -std=gnu++17 -pthread tools/eink_convert/eink_convert.cpp
+*         tools/eink_convert/dither.cpp -ljpeg -lpng -o eink_convert
+*   Run:
+*     ./eink_convert [--landscape] [--no-tiles] [--settings FILE]
+*                    [--inv-gamma 1.0] [--brightness 0] [--contrast 100]
+*                    [--r 100] [--g 100] [--b 100]
+*                    [--threads N] [--out DIR] [--dither scalar|sse4.1|avx2]
+*                    [--match rgb|oklab] [--lut-cache DIR] PICTURE|FOLDER...
+*     ./eink_convert --bench [PICTURE]
+*   FILE is the 18 line file of the script's "Save All" button. Output
+*   goes next to each picture unless --out is given.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+*
+******************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <setjmp.h>
+#include <math.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <jpeglib.h>
+#include <png.h>
+#include "dither.h"
+
+#define TARGET_WIDTH    1200
+#define TARGET_HEIGHT   1600
+#define TILE            40
+#define TILE_ROTATE     90
+#define MAX_THREADS     64
+
+// The script's defaults
+static const int DEFAULT_DITHER_PALETTE[6][3] = {
+    { 30, 30, 30 }, { 195, 255, 255 }, { 255, 255, 0 }, { 255, 70, 70 }, { 50, 50, 255 }, { 80, 140, 80 },
+};
+static const int DEFAULT_EINK_PALETTE[6][3] = {
+    { 0, 0, 0 }, { 140, 140, 110 }, { 140, 120, 0 }, { 100, 15, 15 }, { 40, 40, 100 }, { 40, 63, 41 },
+};
+static const uint8_t RAW_MAP[6] = { 0x0, 0x1, 0x2, 0x3, 0x5, 0x6 };
+
+typedef struct {
+    double InvGamma;
+    double Brightness;
+    double Contrast;
+    double R, G, B;                 // percent
+    int Dither[6][3];
+    int Eink[6][3];                 // only for the preview in the script
+    int Landscape;
+    int Tiled;
+} CONVERT_SETTINGS;
+
+typedef struct {
+    int Width;
+    int Height;
+    std::vector<uint8_t> Rgb;       // 3 bytes a pixel
+} CONVERT_IMAGE;
+
+/******************************************************************************
+Reading pictures
+    Decoded the way Pillow's Image.open(...).convert("RGB") decodes them:
+    libjpeg with its defaults (ISLOW, fancy upsampling), no EXIF rotation,
+    gray repeated into R, G and B, alpha dropped, 16 bit samples cut to
+    their high byte.
+******************************************************************************/
+typedef struct {
+    struct jpeg_error_mgr Mgr;
+    jmp_buf Jump;
+    char Message[JMSG_LENGTH_MAX];
+} CONVERT_JPEG_ERROR;
+
+static void Convert_JpegError(j_common_ptr Info)
+{
+    CONVERT_JPEG_ERROR *Err = (CONVERT_JPEG_ERROR *)Info->err;
+    (*Info->err->format_message)(Info, Err->Message);
+    longjmp(Err->Jump, 1);
+}
+
+static int Convert_ReadJpeg(FILE *File, CONVERT_IMAGE *Image, std::string *Error)
+{
+    struct jpeg_decompress_struct Info;
+    CONVERT_JPEG_ERROR Err;
+    std::vector<uint8_t> Row;
+
+    Info.err = jpeg_std_error(&Err.Mgr);
+    Err.Mgr.error_exit = Convert_JpegError;
+    if (setjmp(Err.Jump)) {
+        *Error = Err.Message;
+        jpeg_destroy_decompress(&Info);
+        return 1;
+    }
+    jpeg_create_decompress(&Info);
+    jpeg_stdio_src(&Info, File);
+    jpeg_read_header(&Info, TRUE);
+    if (Info.num_components != 1 && Info.num_components != 3) {
+        *Error = "CMYK JPEG not supported";
+        jpeg_destroy_decompress(&Info);
+        return 1;
+    }
+    Info.out_color_space = (Info.num_components == 1)? JCS_GRAYSCALE : JCS_RGB;
+    jpeg_start_decompress(&Info);
+
+    Image->Width = Info.output_width;
+    Image->Height = Info.output_height;
+    Image->Rgb.resize((size_t)Image->Width * Image->Height * 3);
+    Row.resize((size_t)Image->Width * Info.output_components);
+    while (Info.output_scanline < Info.output_height) {
+        uint8_t *Out = &Image->Rgb[(size_t)Info.output_scanline * Image->Width * 3];
+        JSAMPROW p = Row.data();
+        jpeg_read_scanlines(&Info, &p, 1);
+        if (Info.output_components == 3) {
+            memcpy(Out, Row.data(), (size_t)Image->Width * 3);
+        } else {
+            for (int x = 0; x < Image->Width; x++)
+                Out[x * 3] = Out[x * 3 + 1] = Out[x * 3 + 2] = Row[x];
+        }
+    }
+    jpeg_finish_decompress(&Info);
+    jpeg_destroy_decompress(&Info);
+    return 0;
+}
+
+static int Convert_ReadPng(FILE *File, CONVERT_IMAGE *Image, std::string *Error)
+{
+    png_structp Png = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+    png_infop Info = png_create_info_struct(Png);
+    std::vector<png_bytep> Rows;
+    std::vector<uint8_t> Pixels;
+
+    if (setjmp(png_jmpbuf(Png))) {
+        *Error = "bad PNG";
+        png_destroy_read_struct(&Png, &Info, NULL);
+        return 1;
+    }
+    png_init_io(Png, File);
+    png_read_info(Png, Info);
+
+    int Depth = png_get_bit_depth(Png, Info);
+    int Type = png_get_color_type(Png, Info);
+    if (Depth == 16 && !(Type & PNG_COLOR_MASK_COLOR)) {
+        // Pillow clips 16 bit gray to 255 instead of scaling it
+        *Error = "16 bit grayscale PNG not supported";
+        png_destroy_read_struct(&Png, &Info, NULL);
+        return 1;
+    }
+    if (Depth == 16)
+        png_set_strip_16(Png);
+    if (Type == PNG_COLOR_TYPE_PALETTE)
+        png_set_palette_to_rgb(Png);
+    if (Type == PNG_COLOR_TYPE_GRAY && Depth < 8)
+        png_set_expand_gray_1_2_4_to_8(Png);
+    if (Type & PNG_COLOR_MASK_ALPHA)
+        png_set_strip_alpha(Png);
+    if (!(Type & PNG_COLOR_MASK_COLOR))
+        png_set_gray_to_rgb(Png);
+    png_set_interlace_handling(Png);
+    png_read_update_info(Png, Info);
+
+    Image->Width = png_get_image_width(Png, Info);
+    Image->Height = png_get_image_height(Png, Info);
+    if (png_get_rowbytes(Png, Info) != (size_t)Image->Width * 3) {
+        *Error = "unexpected PNG layout";
+        png_destroy_read_struct(&Png, &Info, NULL);
+        return 1;
+    }
+    Image->Rgb.resize((size_t)Image->Width * Image->Height * 3);
+    Rows.resize(Image->Height);
+    for (int y = 0; y < Image->Height; y++)
+        Rows[y] = &Image->Rgb[(size_t)y * Image->Width * 3];
+    png_read_image(Png, Rows.data());
+    png_read_end(Png, NULL);
+    png_destroy_read_struct(&Png, &Info, NULL);
+    return 0;
+}
+
+// Binary PPM, maxval 255
+static int Convert_ReadPpm(FILE *File, CONVERT_IMAGE *Image, std::string *Error)
+{
+    int Max;
+    if (fscanf(File, "P6 %d %d %d", &Image->Width, &Image->Height, &Max) != 3 || Max != 255 ||
+        Image->Width <= 0 || Image->Height <= 0 || fgetc(File) == EOF) {
+        *Error = "only binary PPM with maxval 255 is read";
+        return 1;
+    }
+    Image->Rgb.resize((size_t)Image->Width * Image->Height * 3);
+    if (fread(Image->Rgb.data(), 1, Image->Rgb.size(), File) != Image->Rgb.size()) {
+        *Error = "PPM too short";
+        return 1;
+    }
+    return 0;
+}
+
+static int Convert_Read(const char *Path, CONVERT_IMAGE *Image, std::string *Error)
+{
+    FILE *File = fopen(Path, "rb");
+    uint8_t Magic[4] = { 0 };
+    int Failed;
+
+    if (File == NULL) {
+        *Error = strerror(errno);
+        return 1;
+    }
+    if (fread(Magic, 1, 4, File) != 4)
+        Magic[0] = 0;
+    rewind(File);
+    if (Magic[0] == 0xFF && Magic[1] == 0xD8)
+        Failed = Convert_ReadJpeg(File, Image, Error);
+    else if (!memcmp(Magic, "\x89PNG", 4))
+        Failed = Convert_ReadPng(File, Image, Error);
+    else if (Magic[0] == 'P' && Magic[1] == '6')
+        Failed = Convert_ReadPpm(File, Image, Error);
+    else {
+        *Error = "not a JPEG, PNG or PPM file";
+        Failed = 1;
+    }
+    fclose(File);
+    return Failed;
+}
+
+/******************************************************************************
+Adjustments
+    apply_inverse_gamma(), apply_brightness_contrast() and
+    apply_rgb_adjustments() work on each channel of each pixel alone, in
+    numpy float32 with the Python floats taken as float32, and truncate
+    back to uint8. Together they are one table per channel.
+******************************************************************************/
+static uint8_t Convert_ToByte(float v)
+{
+    if (v < 0.0f)
+        v = 0.0f;
+    if (v > 255.0f)
+        v = 255.0f;
+    return (uint8_t)v;
+}
+
+static void Convert_MakeLut(const CONVERT_SETTINGS *Set, uint8_t Lut[3][256])
+{
+    double InvGamma = (Set->InvGamma <= 0)? 1.0 : Set->InvGamma;
+    float Gamma = (float)(1.0 / InvGamma);
+    float Scale = (float)(Set->Contrast / 100.0);
+    float Bright = (float)Set->Brightness;
+    float Channel[3] = { (float)(Set->R / 100.0), (float)(Set->G / 100.0), (float)(Set->B / 100.0) };
+
+    for (int v = 0; v < 256; v++) {
+        // numpy takes these exponents as special cases
+        float a = (float)v / 255.0f;
+        if (Gamma == 1.0f)
+            ;
+        else if (Gamma == 0.5f)
+            a = sqrtf(a);
+        else if (Gamma == 2.0f)
+            a = a * a;
+        else
+            a = powf(a, Gamma);
+        uint8_t g = Convert_ToByte(a * 255.0f);
+
+        uint8_t bc = Convert_ToByte(((float)g - 128.0f) * Scale + 128.0f + Bright);
+        for (int c = 0; c < 3; c++)
+            Lut[c][v] = Convert_ToByte((float)bc * Channel[c]);
+    }
+}
+
+static void Convert_Adjust(CONVERT_IMAGE *Image, const uint8_t Lut[3][256])
+{
+    uint8_t *p = Image->Rgb.data();
+    for (size_t i = 0; i < Image->Rgb.size(); i += 3) {
+        p[i] = Lut[0][p[i]];
+        p[i + 1] = Lut[1][p[i + 1]];
+        p[i + 2] = Lut[2][p[i + 2]];
+    }
+}
+
+/******************************************************************************
+Scaling
+    Pillow's Image.resize(..., LANCZOS): a support 3 Lanczos window
+    stretched by the scale when shrinking, weights computed in double and
+    rounded to 22 bit fixed point, a horizontal pass over only the rows
+    the vertical pass needs, then the vertical pass.
+******************************************************************************/
+#define CONVERT_PRECISION   22
+
+typedef struct {
+    int Ksize;
+    std::vector<int> Bounds;        // first input and count, per output
+    std::vector<int32_t> K;
+} CONVERT_COEFFS;
+
+static double Convert_Sinc(double x)
+{
+    if (x == 0.0)
+        return 1.0;
+    x = x * M_PI;
+    return sin(x) / x;
+}
+
+static double Convert_Lanczos(double x)
+{
+    if (-3.0 <= x && x < 3.0)
+        return Convert_Sinc(x) * Convert_Sinc(x / 3);
+    return 0.0;
+}
+
+static void Convert_Coeffs(int InSize, int OutSize, CONVERT_COEFFS *C)
+{
+    double Scale = (double)((float)InSize - 0.0f) / OutSize;
+    double FilterScale = (Scale < 1.0)? 1.0 : Scale;
+    double Support = 3.0 * FilterScale;
+    std::vector<double> k;
+
+    C->Ksize = (int)ceil(Support) * 2 + 1;
+    C->Bounds.resize(OutSize * 2);
+    C->K.assign((size_t)OutSize * C->Ksize, 0);
+    k.resize(C->Ksize);
+    for (int xx = 0; xx < OutSize; xx++) {
+        double Center = 0.0f + (xx + 0.5) * Scale;
+        double ww = 0.0, ss = 1.0 / FilterScale;
+        int xmin = (int)(Center - Support + 0.5);
+        int xmax = (int)(Center + Support + 0.5);
+        if (xmin < 0)
+            xmin = 0;
+        if (xmax > InSize)
+            xmax = InSize;
+        xmax -= xmin;
+        for (int x = 0; x < xmax; x++) {
+            k[x] = Convert_Lanczos((x + xmin - Center + 0.5) * ss);
+            ww += k[x];
+        }
+        for (int x = 0; x < xmax; x++) {
+            double w = (ww != 0.0)? k[x] / ww : k[x];
+            C->K[(size_t)xx * C->Ksize + x] = (w < 0)? (int32_t)(-0.5 + w * (1 << CONVERT_PRECISION))
+                                                     : (int32_t)(0.5 + w * (1 << CONVERT_PRECISION));
+        }
+        C->Bounds[xx * 2] = xmin;
+        C->Bounds[xx * 2 + 1] = xmax;
+    }
+}
+
+static inline uint8_t Convert_Clip8(int32_t v)
+{
+    v >>= CONVERT_PRECISION;
+    return (v < 0)? 0 : (v > 255)? 255 : v;
+}
+
+static void Convert_Resize(const CONVERT_IMAGE *In, int Width, int Height, CONVERT_IMAGE *Out)
+{
+    CONVERT_COEFFS H, V;
+    CONVERT_IMAGE Temp;
+    const CONVERT_IMAGE *Src = In;
+
+    Convert_Coeffs(In->Width, Width, &H);
+    Convert_Coeffs(In->Height, Height, &V);
+    int First = V.Bounds[0];
+    int Last = V.Bounds[Height * 2 - 2] + V.Bounds[Height * 2 - 1];
+
+    if (Width != In->Width) {
+        for (int y = 0; y < Height; y++)
+            V.Bounds[y * 2] -= First;
+        Temp.Width = Width;
+        Temp.Height = Last - First;
+        Temp.Rgb.resize((size_t)Temp.Width * Temp.Height * 3);
+        for (int y = 0; y < Temp.Height; y++) {
+            const uint8_t *Row = &In->Rgb[(size_t)(y + First) * In->Width * 3];
+            uint8_t *Dst = &Temp.Rgb[(size_t)y * Width * 3];
+            for (int xx = 0; xx < Width; xx++) {
+                int xmin = H.Bounds[xx * 2], xmax = H.Bounds[xx * 2 + 1];
+                const int32_t *k = &H.K[(size_t)xx * H.Ksize];
+                int32_t s0 = 1 << (CONVERT_PRECISION - 1), s1 = s0, s2 = s0;
+                const uint8_t *p = Row + xmin * 3;
+                for (int x = 0; x < xmax; x++, p += 3) {
+                    s0 += p[0] * k[x];
+                    s1 += p[1] * k[x];
+                    s2 += p[2] * k[x];
+                }
+                Dst[xx * 3] = Convert_Clip8(s0);
+                Dst[xx * 3 + 1] = Convert_Clip8(s1);
+                Dst[xx * 3 + 2] = Convert_Clip8(s2);
+            }
+        }
+        Src = &Temp;
+    }
+
+    if (Height == In->Height) {
+        if (Src == &Temp)
+            *Out = std::move(Temp);
+        else
+            *Out = *In;
+        return;
+    }
+    Out->Width = Src->Width;
+    Out->Height = Height;
+    Out->Rgb.resize((size_t)Out->Width * Height * 3);
+    std::vector<int32_t> Sum((size_t)Out->Width * 3);
+    for (int yy = 0; yy < Height; yy++) {
+        int ymin = V.Bounds[yy * 2], ymax = V.Bounds[yy * 2 + 1];
+        const int32_t *k = &V.K[(size_t)yy * V.Ksize];
+        // Row by row, so the source is read in order
+        std::fill(Sum.begin(), Sum.end(), 1 << (CONVERT_PRECISION - 1));
+        for (int y = 0; y < ymax; y++) {
+            const uint8_t *Row = &Src->Rgb[(size_t)(y + ymin) * Src->Width * 3];
+            for (size_t i = 0; i < Sum.size(); i++)
+                Sum[i] += Row[i] * k[y];
+        }
+        uint8_t *Dst = &Out->Rgb[(size_t)yy * Out->Width * 3];
+        for (size_t i = 0; i < Sum.size(); i++)
+            Dst[i] = Convert_Clip8(Sum[i]);
+    }
+}
+
+// scale_to_target(): fit, then centre on a black canvas
+static void Convert_Letterbox(const CONVERT_IMAGE *In, int Landscape, CONVERT_IMAGE *Out)
+{
+    int tw = Landscape? TARGET_HEIGHT : TARGET_WIDTH;
+    int th = Landscape? TARGET_WIDTH : TARGET_HEIGHT;
+    double sw = (double)tw / In->Width, sh = (double)th / In->Height;
+    double sc = (sw < sh)? sw : sh;
+    int nw = (int)(In->Width * sc), nh = (int)(In->Height * sc);
+    CONVERT_IMAGE Scaled;
+    const CONVERT_IMAGE *Src = In;
+
+    if (sc != 1) {
+        Convert_Resize(In, nw, nh, &Scaled);
+        Src = &Scaled;
+    }
+    Out->Width = tw;
+    Out->Height = th;
+    Out->Rgb.assign((size_t)tw * th * 3, 0);
+
+    // Image.paste() clips what falls outside the canvas
+    int ox = (tw - nw) / 2, oy = (th - nh) / 2;
+    for (int y = 0; y < Src->Height; y++) {
+        int ty = y + oy;
+        if (ty < 0 || ty >= th)
+            continue;
+        int x0 = (ox < 0)? -ox : 0;
+        int x1 = (Src->Width + ox > tw)? tw - ox : Src->Width;
+        if (x0 < x1)
+            memcpy(&Out->Rgb[((size_t)ty * tw + ox + x0) * 3], &Src->Rgb[((size_t)y * Src->Width + x0) * 3],
+                   (size_t)(x1 - x0) * 3);
+    }
+}
+
+/******************************************************************************
+Writing
+    dither.cpp gives the panel codes packed two to a byte, row by row:
+    the portrait .raw as it is, and a .s6t tile row is 20 whole bytes.
+******************************************************************************/
+static int Convert_Write(const std::string &Path, const std::vector<uint8_t> &Data)
+{
+    FILE *File = fopen(Path.c_str(), "wb");
+    if (File == NULL)
+        return 1;
+    int Failed = fwrite(Data.data(), 1, Data.size(), File) != Data.size();
+    Failed |= fclose(File) != 0;
+    return Failed;
+}
+
+// save_tiled(): 16 byte header, then 40 x 40 tiles by tile column and row
+static void Convert_Tiles(const std::vector<uint8_t> &Packed, int Width, int Height, std::vector<uint8_t> *Data)
+{
+    uint8_t Header[16] = { 'S', '6', 'T', '1',
+                           (uint8_t)Width, (uint8_t)(Width >> 8), (uint8_t)Height, (uint8_t)(Height >> 8),
+                           TILE, 0, (uint8_t)TILE_ROTATE, (uint8_t)(TILE_ROTATE >> 8), 0, 0, 0, 0 };
+    Data->resize(16 + Packed.size());
+    memcpy(Data->data(), Header, 16);
+    uint8_t *Out = Data->data() + 16;
+    for (int tc = 0; tc < Width / TILE; tc++)
+        for (int y = 0; y < Height / TILE * TILE; y++, Out += TILE / 2)
+            memcpy(Out, &Packed[(size_t)y * (Width / 2) + tc * (TILE / 2)], TILE / 2);
+}
+
+// The landscape .raw: turned by np.rot90(k=1), row y is column Width - 1 - y
+static void Convert_Rotate(const std::vector<uint8_t> &Packed, int Width, int Height, std::vector<uint8_t> *Data)
+{
+    Data->resize(Packed.size());
+    uint8_t *Out = Data->data();
+    for (int y = 0; y < Width; y++) {
+        int Column = Width - 1 - y;
+        int Shift = (Column & 1)? 0 : 4;
+        const uint8_t *p = &Packed[Column / 2];
+        for (int x = 0; x < Height; x += 2, p += Width)
+            *Out++ = (((p[0] >> Shift) & 0xF) << 4) | ((p[Width / 2] >> Shift) & 0xF);
+    }
+}
+
+/******************************************************************************
+function :  Convert one picture
+parameter:
+    Path : Picture
+    Base : Output path without extension
+return   :  0 on success, else 1 with Error set
+******************************************************************************/
+static int Convert_One(const CONVERT_SETTINGS *Set, const uint8_t Lut[3][256], DITHER_PATH Dither,
+                       const DITHER_PALETTE *Pal, const std::string &Path, const std::string &Base,
+                       std::string *Error)
+{
+    CONVERT_IMAGE Picture, Canvas;
+    std::vector<uint8_t> Packed, Data;
+
+    if (Convert_Read(Path.c_str(), &Picture, Error))
+        return 1;
+    Convert_Adjust(&Picture, Lut);
+    Convert_Letterbox(&Picture, Set->Landscape, &Canvas);
+    Picture.Rgb.clear();
+    Picture.Rgb.shrink_to_fit();
+    Packed.resize((size_t)Canvas.Width / 2 * Canvas.Height);
+    Dither_Frame(Dither, Pal, Canvas.Rgb.data(), Canvas.Width, Canvas.Height, Packed.data());
+
+    if (Set->Landscape && Set->Tiled) {
+        Convert_Tiles(Packed, Canvas.Width, Canvas.Height, &Data);
+        if (Convert_Write(Base + ".s6t", Data)) {
+            *Error = "cannot write " + Base + ".s6t";
+            return 1;
+        }
+    }
+    if (Set->Landscape)
+        Convert_Rotate(Packed, Canvas.Width, Canvas.Height, &Data);
+    else
+        Data.swap(Packed);
+    if (Convert_Write(Base + ".raw", Data)) {
+        *Error = "cannot write " + Base + ".raw";
+        return 1;
+    }
+    return 0;
+}
+
+/******************************************************************************
+function :  How far a dithered frame looks from the frame
+parameter:
+    Frame  : The frame that was dithered
+    Packed : Its panel codes
+return   :  Mean OKLab distance, times 100
+info     :  Both are blurred over 7 x 7 pixels in linear light, about what
+            the eye merges at arm's length, and the codes are drawn in the
+            dither colors.
+******************************************************************************/
+static double Convert_VisualError(const CONVERT_IMAGE *Frame, const std::vector<uint8_t> &Packed,
+                                  const DITHER_PALETTE *Pal)
+{
+    int w = Frame->Width, h = Frame->Height;
+    double Linear[256], Color[16][3] = {};
+    std::vector<float> Image[2], Temp((size_t)w * h * 3);
+
+    for (int v = 0; v < 256; v++)
+        Linear[v] = Dither_Linear(v);
+    for (int i = 5; i >= 0; i--)
+        for (int c = 0; c < 3; c++)
+            Color[Pal->Code[i]][c] = Linear[Pal->Color[i][c]];
+    for (int k = 0; k < 2; k++)
+        Image[k].resize((size_t)w * h * 3);
+    for (size_t i = 0; i < (size_t)w * h; i++) {
+        uint8_t Code = (Packed[i / 2] >> ((i & 1)? 0 : 4)) & 0xF;
+        for (int c = 0; c < 3; c++) {
+            Image[0][i * 3 + c] = Linear[Frame->Rgb[i * 3 + c]];
+            Image[1][i * 3 + c] = Color[Code][c];
+        }
+    }
+
+    double Sum = 0;
+    const int r = 3;
+    for (int k = 0; k < 2; k++) {
+        std::vector<float> &a = Image[k];
+        for (int y = 0; y < h; y++)
+            for (int x = 0; x < w; x++)
+                for (int c = 0; c < 3; c++) {
+                    float s = 0;
+                    for (int d = -r; d <= r; d++)
+                        s += a[((size_t)y * w + std::clamp(x + d, 0, w - 1)) * 3 + c];
+                    Temp[((size_t)y * w + x) * 3 + c] = s / (2 * r + 1);
+                }
+        for (int y = 0; y < h; y++)
+            for (int x = 0; x < w; x++)
+                for (int c = 0; c < 3; c++) {
+                    float s = 0;
+                    for (int d = -r; d <= r; d++)
+                        s += Temp[((size_t)std::clamp(y + d, 0, h - 1) * w + x) * 3 + c];
+                    a[((size_t)y * w + x) * 3 + c] = s / (2 * r + 1);
+                }
+    }
+    for (size_t i = 0; i < (size_t)w * h; i++) {
+        double p[3], q[3], Lp[3], Lq[3];
+        for (int c = 0; c < 3; c++) {
+            p[c] = Image[0][i * 3 + c];
+            q[c] = Image[1][i * 3 + c];
+        }
+        Dither_Oklab(p, Lp);
+        Dither_Oklab(q, Lq);
+        Sum += sqrt((Lp[0] - Lq[0]) * (Lp[0] - Lq[0]) + (Lp[1] - Lq[1]) * (Lp[1] - Lq[1]) +
+                    (Lp[2] - Lq[2]) * (Lp[2] - Lq[2]));
+    }
+    return Sum / ((double)w * h) * 100;
+}
+
+static double Convert_Seconds(std::chrono::steady_clock::time_point t0)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+/******************************************************************************
+function :  Time each dithering path on one 1200 x 1600 frame
+parameter:
+    CacheDir : Where --match oklab keeps its tables
+    Path     : Picture to letterbox, NULL for a made up one
+info     :  For RGB and OKLab matching, every path must give the scalar
+            path's bytes. Also times building and loading the OKLab table
+            and compares how far each matching looks from the frame.
+******************************************************************************/
+static int Convert_Bench(const CONVERT_SETTINGS *Set, const uint8_t Lut[3][256], const char *CacheDir,
+                         const char *Path)
+{
+    CONVERT_IMAGE Canvas;
+    DITHER_PALETTE Pal[2];
+    std::string File;
+    int Failed = 0;
+
+    if (Path != NULL) {
+        CONVERT_IMAGE Picture;
+        std::string Error;
+        if (Convert_Read(Path, &Picture, &Error)) {
+            fprintf(stderr, "%s: %s\n", Path, Error.c_str());
+            return 1;
+        }
+        Convert_Adjust(&Picture, Lut);
+        Convert_Letterbox(&Picture, Set->Landscape, &Canvas);
+    } else {
+        // Smooth ramps, where the error diffusion does the most work, and noise
+        Canvas.Width = TARGET_WIDTH;
+        Canvas.Height = TARGET_HEIGHT;
+        Canvas.Rgb.resize((size_t)TARGET_WIDTH * TARGET_HEIGHT * 3);
+        uint32_t Seed = 1;
+        for (int y = 0; y < TARGET_HEIGHT; y++)
+            for (int x = 0; x < TARGET_WIDTH; x++) {
+                uint8_t *p = &Canvas.Rgb[((size_t)y * TARGET_WIDTH + x) * 3];
+                Seed = Seed * 1103515245 + 12345;
+                int n = (int)((Seed >> 16) & 31) - 16;
+                p[0] = std::clamp(x * 255 / TARGET_WIDTH + n, 0, 255);
+                p[1] = std::clamp(y * 255 / TARGET_HEIGHT + n, 0, 255);
+                p[2] = std::clamp((x + y) * 255 / (TARGET_WIDTH + TARGET_HEIGHT) - n, 0, 255);
+            }
+    }
+
+    Dither_MakePalette(&Pal[0], Set->Dither, RAW_MAP);
+    Dither_MakePalette(&Pal[1], Set->Dither, RAW_MAP);
+    auto t0 = std::chrono::steady_clock::now();
+    Dither_UseOklab(&Pal[1], NULL, &File);
+    printf("OKLab table: built in %.1f ms", Convert_Seconds(t0) * 1e3);
+    if (CacheDir != NULL && CacheDir[0] != 0) {
+        DITHER_LUT From = Dither_UseOklab(&Pal[1], CacheDir, &File);
+        t0 = std::chrono::steady_clock::now();
+        if (From != DITHER_LUT_UNSAVED && Dither_UseOklab(&Pal[1], CacheDir, &File) == DITHER_LUT_LOADED)
+            printf(", loaded from the cache in %.2f ms", Convert_Seconds(t0) * 1e3);
+    }
+    printf("\n");
+
+    double Pixels = (double)Canvas.Width * Canvas.Height;
+    printf("%d x %d frame\n", Canvas.Width, Canvas.Height);
+    for (int m = 0; m < 2; m++) {
+        std::vector<uint8_t> Packed[DITHER_PATHS];
+        for (int p = 0; p < DITHER_PATHS; p++) {
+            if (!Dither_Supported((DITHER_PATH)p)) {
+                printf("%-6s %-8s not supported by this CPU\n", m? "oklab" : "rgb", Dither_Name((DITHER_PATH)p));
+                continue;
+            }
+            Packed[p].resize((size_t)Canvas.Width / 2 * Canvas.Height);
+            double Best = 1e9;
+            for (int Rep = 0; Rep < 10; Rep++) {
+                t0 = std::chrono::steady_clock::now();
+                Dither_Frame((DITHER_PATH)p, &Pal[m], Canvas.Rgb.data(), Canvas.Width, Canvas.Height,
+                             Packed[p].data());
+                Best = std::min(Best, Convert_Seconds(t0));
+            }
+            int Same = Packed[p] == Packed[DITHER_SCALAR];
+            Failed |= !Same;
+            printf("%-6s %-8s %7.2f ms %8.1f Mpixel/s%s\n", m? "oklab" : "rgb", Dither_Name((DITHER_PATH)p),
+                   Best * 1e3, Pixels / Best / 1e6, Same? "" : "  DIFFERS FROM SCALAR");
+        }
+        printf("%-6s looks %.2f from the frame (blurred OKLab distance x 100)\n", m? "oklab" : "rgb",
+               Convert_VisualError(&Canvas, Packed[DITHER_SCALAR], &Pal[m]));
+    }
+    return Failed;
+}
+
+// load_all_settings(): 6 values, then 6 + 6 palette lines of "R G B"
+static int Convert_LoadSettings(const char *Path, CONVERT_SETTINGS *Set)
+{
+    FILE *File = fopen(Path, "r");
+    double *Value[6] = { &Set->InvGamma, &Set->Brightness, &Set->Contrast, &Set->R, &Set->G, &Set->B };
+    char Line[256];
+    int n = 0;
+
+    if (File == NULL)
+        return 1;
+    for (; n < 18 && fgets(Line, sizeof(Line), File); n++) {
+        if (n < 6) {
+            char *End;
+            *Value[n] = strtod(Line, &End);
+            if (End == Line)
+                break;
+        } else {
+            double c[3];
+            int (*Pal)[3] = (n < 12)? Set->Dither : Set->Eink;
+            if (sscanf(Line, "%lf %lf %lf", &c[0], &c[1], &c[2]) != 3)
+                break;
+            // _get_entry_int(): int(float(text)), then 0 to 255
+            for (int j = 0; j < 3; j++) {
+                long v = (long)c[j];
+                Pal[(n - 6) % 6][j] = (v < 0)? 0 : (v > 255)? 255 : (int)v;
+            }
+        }
+    }
+    fclose(File);
+    return n != 18;
+}
+
+static int Convert_IsPicture(const std::filesystem::path &Path)
+{
+    std::string Ext = Path.extension().string();
+    for (char &c : Ext)
+        c = tolower((unsigned char)c);
+    return Ext == ".jpg" || Ext == ".jpeg" || Ext == ".png" || Ext == ".ppm";
+}
+
+int main(int argc, char **argv)
+{
+    CONVERT_SETTINGS Set = { 1.0, 0, 100, 100, 100, 100, {}, {}, 0, 1 };
+    std::vector<std::string> Inputs;
+    std::string OutDir;
+    int Threads = std::thread::hardware_concurrency();
+    DITHER_PATH Dither = Dither_Best();
+    int Bench = 0, Oklab = 0;
+    std::string CacheDir;
+
+    if (getenv("XDG_CACHE_HOME") != NULL && getenv("XDG_CACHE_HOME")[0] != 0)
+        CacheDir = std::string(getenv("XDG_CACHE_HOME")) + "/eink_convert";
+    else if (getenv("HOME") != NULL)
+        CacheDir = std::string(getenv("HOME")) + "/.cache/eink_convert";
+
+    memcpy(Set.Dither, DEFAULT_DITHER_PALETTE, sizeof(Set.Dither));
+    memcpy(Set.Eink, DEFAULT_EINK_PALETTE, sizeof(Set.Eink));
+    for (int i = 1; i < argc; i++) {
+        const char *Value = (i + 1 < argc)? argv[i + 1] : "";
+        char *End;
+        double *Number = !strcmp(argv[i], "--inv-gamma")? &Set.InvGamma :
+                         !strcmp(argv[i], "--brightness")? &Set.Brightness :
+                         !strcmp(argv[i], "--contrast")? &Set.Contrast :
+                         !strcmp(argv[i], "--r")? &Set.R :
+                         !strcmp(argv[i], "--g")? &Set.G :
+                         !strcmp(argv[i], "--b")? &Set.B : NULL;
+        if (Number != NULL) {
+            *Number = strtod(Value, &End);
+            if (End == Value || *End != 0) {
+                fprintf(stderr, "%s needs a number\n", argv[i]);
+                return 2;
+            }
+            i++;
+        } else if (!strcmp(argv[i], "--landscape")) {
+            Set.Landscape = 1;
+        } else if (!strcmp(argv[i], "--no-tiles")) {
+            Set.Tiled = 0;
+        } else if (!strcmp(argv[i], "--settings")) {
+            if (Convert_LoadSettings(Value, &Set)) {
+                fprintf(stderr, "%s: need 18 lines of settings\n", Value);
+                return 2;
+            }
+            i++;
+        } else if (!strcmp(argv[i], "--threads")) {
+            Threads = strtol(Value, &End, 10);
+            if (End == Value || *End != 0 || Threads < 1 || Threads > MAX_THREADS) {
+                fprintf(stderr, "--threads must be 1 to %d\n", MAX_THREADS);
+                return 2;
+            }
+            i++;
+        } else if (!strcmp(argv[i], "--dither")) {
+            int p = 0;
+            while (p < DITHER_PATHS && strcmp(Value, Dither_Name((DITHER_PATH)p)))
+                p++;
+            if (p == DITHER_PATHS || !Dither_Supported((DITHER_PATH)p)) {
+                fprintf(stderr, "--dither: %s not supported here\n", Value);
+                return 2;
+            }
+            Dither = (DITHER_PATH)p;
+            i++;
+        } else if (!strcmp(argv[i], "--match")) {
+            if (strcmp(Value, "rgb") && strcmp(Value, "oklab")) {
+                fprintf(stderr, "--match is rgb or oklab\n");
+                return 2;
+            }
+            Oklab = !strcmp(Value, "oklab");
+            i++;
+        } else if (!strcmp(argv[i], "--lut-cache")) {
+            CacheDir = Value;
+            i++;
+        } else if (!strcmp(argv[i], "--bench")) {
+            Bench = 1;
+        } else if (!strcmp(argv[i], "--out")) {
+            OutDir = Value;
+            i++;
+        } else if (argv[i][0] == '-') {
+            fprintf(stderr, "unknown option %s\n", argv[i]);
+            return 2;
+        } else if (std::filesystem::is_directory(argv[i])) {
+            std::vector<std::string> Found;
+            for (const auto &Entry : std::filesystem::directory_iterator(argv[i]))
+                if (Entry.is_regular_file() && Convert_IsPicture(Entry.path()))
+                    Found.push_back(Entry.path().string());
+            std::sort(Found.begin(), Found.end());
+            Inputs.insert(Inputs.end(), Found.begin(), Found.end());
+        } else {
+            Inputs.push_back(argv[i]);
+        }
+    }
+
+    uint8_t Lut[3][256];
+    DITHER_PALETTE Pal;
+    Convert_MakeLut(&Set, Lut);
+    if (Bench)
+        return Convert_Bench(&Set, Lut, CacheDir.c_str(), Inputs.empty()? NULL : Inputs[0].c_str());
+    Dither_MakePalette(&Pal, Set.Dither, RAW_MAP);
+
+    if (Inputs.empty()) {
+        fprintf(stderr, "no pictures given\n");
+        return 2;
+    }
+    if (Threads < 1)
+        Threads = 1;
+    if (Threads > (int)Inputs.size())
+        Threads = Inputs.size();
+
+    if (!OutDir.empty()) {
+        std::error_code Err;
+        std::filesystem::create_directories(OutDir, Err);
+    }
+
+    if (Oklab) {
+        std::string File;
+        auto t0 = std::chrono::steady_clock::now();
+        DITHER_LUT From = Dither_UseOklab(&Pal, CacheDir.c_str(), &File);
+        double ms = Convert_Seconds(t0) * 1e3;
+        if (From == DITHER_LUT_LOADED)
+            printf("OKLab table loaded from %s (%.1f ms)\n", File.c_str(), ms);
+        else if (From == DITHER_LUT_BUILT)
+            printf("OKLab table built (%.1f ms), saved as %s\n", ms, File.c_str());
+        else
+            printf("OKLab table built (%.1f ms), not saved%s%s\n", ms, File.empty()? "" : " as ", File.c_str());
+    }
+
+    std::atomic<size_t> Next(0);
+    std::atomic<int> Failed(0);
+    std::mutex Print;
+    auto t0 = std::chrono::steady_clock::now();
+    auto Worker = [&] {
+        for (size_t i; (i = Next++) < Inputs.size(); ) {
+            std::filesystem::path Path(Inputs[i]);
+            std::filesystem::path Base = Path;
+            Base.replace_extension();
+            if (!OutDir.empty())
+                Base = std::filesystem::path(OutDir) / Base.filename();
+            std::string Error;
+            auto t1 = std::chrono::steady_clock::now();
+            int Bad = Convert_One(&Set, Lut, Dither, &Pal, Inputs[i], Base.string(), &Error);
+            double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - t1).count();
+            std::lock_guard<std::mutex> Lock(Print);
+            if (Bad) {
+                fprintf(stderr, "%s: %s\n", Inputs[i].c_str(), Error.c_str());
+                Failed++;
+            } else {
+                printf("%s -> %s.raw (%.2f s)\n", Inputs[i].c_str(), Base.string().c_str(), s);
+            }
+        }
+    };
+    std::vector<std::thread> Pool;
+    for (int t = 1; t < Threads; t++)
+        Pool.emplace_back(Worker);
+    Worker();
+    for (auto &T : Pool)
+        T.join();
+
+    double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    int Done = Inputs.size() - Failed;
+    printf("%d picture(s) in %.2f s on %d thread(s): %.1f pictures/minute\n", Done, s, Threads,
+           (s > 0)? Done * 60.0 / s : 0.0);
+    return Failed? 1 : 0;
+}
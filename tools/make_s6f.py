@@ -0,0 +1,133 @@
+#!/usr/bin/env python3
+"""Build a .s6f font for GUI_SDFont.h from a TrueType/OpenType font.
+
+The glyphs are rendered 1bpp at one pixel size. The character set is printable
+ASCII plus every character of the given text files (captions, order.txt)
+and code point ranges, so a font can be cut down to the text it will show
+or hold a whole script. The file goes on the SD card next to the pictures.
+
+Usage:
+    python tools/make_s6f.py NotoSansSC-Regular.otf --size 24 --text order.txt -o /sd/cn24.s6f
+    python tools/make_s6f.py NotoSansSC-Regular.otf --size 24 --range 4E00-9FFF -o cn24.s6f
+"""
+import argparse
+import os
+import re
+import struct
+
+from PIL import Image, ImageDraw, ImageFont
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+# Must match GUI_SDFont.h
+MAGIC = 0x31463653      # "S6F1"
+PAGE = 64
+MAX_PAGES = 512
+SECTOR = 512
+HEADER = struct.Struct('<IHHIHHIII')
+
+
+def read_defines(*names):
+    """Collect plain integer #defines from the given headers."""
+    defines = {}
+    for name in names:
+        with open(os.path.join(ROOT, name)) as f:
+            for line in f:
+                m = re.match(r'\s*#define\s+(\w+)\s+(0x[0-9A-Fa-f]+|\d+)[uUlL]*\b', line)
+                if m:
+                    defines[m.group(1)] = int(m.group(2), 0)
+    return defines
+
+
+def parse_range(text):
+    """'4E00-9FFF' or '3000' (hex) to a range of code points."""
+    lo, _, hi = text.partition('-')
+    return range(int(lo, 16), int(hi or lo, 16) + 1)
+
+
+def render(font, ch, height, ascent, max_width, threshold):
+    """1bpp glyph of ch as (width, bytes), rows byte aligned, MSB first."""
+    width = min(max(1, round(font.getlength(ch))), max_width)
+    img = Image.new('L', (width, height), 0)
+    ImageDraw.Draw(img).text((0, ascent), ch, font=font, fill=255, anchor='ls')
+    stride = (width + 7) // 8
+    bits = bytearray(stride * height)
+    px = img.load()
+    for y in range(height):
+        for x in range(width):
+            if px[x, y] >= threshold:
+                bits[y * stride + x // 8] |= 0x80 >> (x % 8)
+    return width, bytes(bits)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Build a .s6f SD card font")
+    parser.add_argument('font', help="TrueType/OpenType font file")
+    parser.add_argument('--size', type=int, required=True, help="font size in pixels")
+    parser.add_argument('--text', action='append', default=[], help="UTF-8 file whose characters are included")
+    parser.add_argument('--range', action='append', default=[], help="hex code point range, e.g. 4E00-9FFF")
+    parser.add_argument('--no-ascii', action='store_true', help="leave out printable ASCII")
+    parser.add_argument('--threshold', type=int, default=128, help="coverage (0-255) that sets a pixel")
+    parser.add_argument('-o', '--output', required=True)
+    args = parser.parse_args()
+
+    limits = read_defines('fonts.h')
+    font = ImageFont.truetype(args.font, args.size)
+    ascent, descent = font.getmetrics()
+    height = ascent + descent
+    if height > limits['MAX_HEIGHT_FONT']:
+        parser.error("glyphs are %d pixels high, MAX_HEIGHT_FONT is %d" % (height, limits['MAX_HEIGHT_FONT']))
+
+    codes = set()
+    if not args.no_ascii:
+        codes.update(range(0x20, 0x7F))
+    for name in args.text:
+        with open(name, encoding='utf-8') as f:
+            codes.update(ord(c) for c in f.read() if c >= ' ')
+    for r in args.range:
+        codes.update(parse_range(r))
+
+    # Code points the font lacks render as its .notdef box; leave them out
+    # so the frame skips them instead of drawing boxes
+    notdef = render(font, '\U0010FFFD', height, ascent, limits['MAX_WIDTH_FONT'], args.threshold)
+    glyphs = []
+    for code in sorted(codes):
+        if code > 0xFFFFFF:
+            continue
+        glyph = render(font, chr(code), height, ascent, limits['MAX_WIDTH_FONT'], args.threshold)
+        if glyph == notdef and code != 0x20:
+            continue
+        glyphs.append((code, glyph))
+
+    pages = (len(glyphs) + PAGE - 1) // PAGE
+    if pages > MAX_PAGES:
+        parser.error("%d glyphs, at most %d fit the page table" % (len(glyphs), MAX_PAGES * PAGE))
+
+    # Header, page table, index from a sector boundary so each page is one
+    # SD sector, then the bitmaps, identical ones stored once
+    page_offset = HEADER.size
+    index_offset = -(-(page_offset + 4 * pages) // SECTOR) * SECTOR
+    offset = index_offset + 8 * len(glyphs)
+    index, bitmaps, shared = [], [], {}
+    for code, (width, bits) in glyphs:
+        if bits not in shared:
+            shared[bits] = offset
+            bitmaps.append(bits)
+            offset += len(bits)
+        index.append(struct.pack('<II', code | (width << 24), shared[bits]))
+
+    with open(args.output, 'wb') as f:
+        f.write(HEADER.pack(MAGIC, height, max([w for _, (w, _) in glyphs], default=1), len(glyphs), pages, 0,
+                            page_offset, index_offset, 0))
+        f.write(b''.join(struct.pack('<I', glyphs[p * PAGE][0]) for p in range(pages)))
+        f.write(b'\0' * (index_offset - f.tell()))
+        f.write(b''.join(index))
+        f.write(b''.join(bitmaps))
+        size = f.tell()
+
+    print("%s: %d glyphs (%d skipped, not in the font), %d px high, %d pages, %d bytes"
+          % (args.output, len(glyphs), len(codes) - len(glyphs), height, pages, size))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+"""Pack the ASCII fonts (font8.cpp to font24.cpp) into font_packed.cpp.
+
+Each glyph keeps only the box around its set pixels: a 3 byte header with
+the first row, row count, first column and column count (6 bits each),
+then the box pixels row after row, bit packed, MSB first. Empty rows and
+the padding columns of the wide fonts are not stored. Paint_DrawChar()
+expands a glyph row by row when FONT_PACKED is 1 in fonts.h.
+
+Run it again after editing a font table.
+
+Usage:
+    python tools/pack_fonts.py
+"""
+import os
+import re
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SIZES = (8, 12, 16, 20, 24)
+FIRST = ' '
+
+HEAD = """/*****************************************************************************
+* | File      	:   font_packed.cpp
+* | Author      :   lernerc606
+* | Function    :   Font8 to Font24 with trimmed glyph boxes, for FONT_PACKED
+* | Info        :
+*   Generated by tools/pack_fonts.py from font8.cpp to font24.cpp; edit
+*   those and run it again instead of editing this file.
+*
+*   Font        raw bytes   packed bytes
+%s
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+*
+******************************************************************************/
+#include "fonts.h"
+
+#if FONT_PACKED
+"""
+
+
+def read_font(size):
+    """Glyph rows (as ints), width and height of fontN.cpp."""
+    with open(os.path.join(ROOT, 'font%d.cpp' % size)) as f:
+        text = f.read()
+    body = text[text.index('_Table'):]
+    body = body[body.index('{') + 1:body.index('};')]
+    data = [int(x, 16) for line in body.splitlines()
+            for x in re.findall(r'0x[0-9A-Fa-f]{2}', line.split('//')[0])]
+    m = re.search(r'sFONT Font\d+ = \{\s*Font\d+_Table,\s*(\d+),[^\n]*\n\s*(\d+),', text)
+    width, height = int(m.group(1)), int(m.group(2))
+    stride = (width + 7) // 8
+    glyphs = []
+    for g in range(len(data) // (stride * height)):
+        rows = []
+        for r in range(height):
+            start = (g * height + r) * stride
+            rows.append(int.from_bytes(bytes(data[start:start + stride]), 'big'))
+        glyphs.append(rows)
+    return glyphs, width, height, len(data)
+
+
+def pack_glyph(rows, stride):
+    """Header and bit packed box of one glyph."""
+    bits = stride * 8
+    ink = [r for r in range(len(rows)) if rows[r]]
+    if not ink:
+        return bytes(3)
+    cols = [c for c in range(bits) if any(row >> (bits - 1 - c) & 1 for row in rows)]
+    top, nrows = ink[0], ink[-1] - ink[0] + 1
+    left, ncols = cols[0], cols[-1] - cols[0] + 1
+    header = (top << 18) | (nrows << 12) | (left << 6) | ncols
+    value, count = 0, 0
+    for row in rows[top:top + nrows]:
+        value = (value << ncols) | ((row >> (bits - left - ncols)) & ((1 << ncols) - 1))
+        count += ncols
+    pad = -count % 8
+    return header.to_bytes(3, 'big') + (value << pad).to_bytes((count + pad) // 8, 'big')
+
+
+def c_array(data, per_line, fmt):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append('  ' + ' '.join(fmt % v + ',' for v in data[i:i + per_line]))
+    return '\n'.join(lines)
+
+
+def main():
+    out, table = [], []
+    for size in SIZES:
+        glyphs, width, height, raw = read_font(size)
+        stride = (width + 7) // 8
+        assert width <= 25 and height < 64   # one decoder window per row
+        packed, offsets = bytearray(), []
+        for rows in glyphs:
+            offsets.append(len(packed))
+            packed += pack_glyph(rows, stride)
+        packed += bytes(3)  # the decoder reads a 32 bit window
+        total = len(packed) + 2 * len(offsets)
+        table.append('*   Font%-6d  %9d   %12d' % (size, raw, total))
+        out.append('// %d glyphs from %r, %d x %d\n' % (len(glyphs), FIRST, width, height))
+        out.append('static const uint8_t Font%d_Packed[] = {\n%s\n};\n\n' % (size, c_array(packed, 16, '0x%02X')))
+        out.append('static const uint16_t Font%d_Offsets[] = {\n%s\n};\n\n' % (size, c_array(offsets, 12, '%4d')))
+        out.append('sFONT Font%d = {\n  NULL,\n  %d, /* Width */\n  %d, /* Height */\n'
+                   '  Font%d_Packed,\n  Font%d_Offsets,\n};\n\n' % (size, width, height, size, size))
+        print('Font%d: %d -> %d bytes' % (size, raw, total))
+
+    text = HEAD % '\n'.join(table) + '\n' + ''.join(out) + '#endif\n'
+    with open(os.path.join(ROOT, 'font_packed.cpp'), 'w', newline='\r\n') as f:
+        f.write(text)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,32 @@
+/*****************************************************************************
+* | File      	:   Arduino.h
+* | Author      :   lernerc606
+* | Function    :   Just enough of the Arduino core for GUI_Paint on a PC
+* | Info        :
+*   Only paint_bench.cpp uses it; the sketch gets the real one.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+*
+******************************************************************************/
+#ifndef _PAINT_BENCH_ARDUINO_H_
+#define _PAINT_BENCH_ARDUINO_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+class Print {};                 // Log_Drain() in Debug.h
+
+static inline unsigned long micros(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (unsigned long)t.tv_sec * 1000000UL + t.tv_nsec / 1000;
+}
+
+#endif
@@ -0,0 +1,46 @@
+/*****************************************************************************
+* | File      	:   SD.h
+* | Author      :   lernerc606
+* | Function    :   Just enough of the Arduino SD library for GUI_SDFont on a PC
+* | Info        :
+*   Paths are host paths, not rooted at a card; only reading is supported.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+*
+******************************************************************************/
+#ifndef _PAINT_BENCH_SD_H_
+#define _PAINT_BENCH_SD_H_
+
+#include <stdio.h>
+#include <stdint.h>
+
+#define FILE_READ   "rb"
+
+class File {
+public:
+    File(FILE *f = NULL) : f(f) {}
+    explicit operator bool() const { return f != NULL; }
+    bool seek(uint32_t pos) { return f != NULL && fseek(f, pos, SEEK_SET) == 0; }
+    size_t read(uint8_t *buf, size_t size) { return f? fread(buf, 1, size, f) : 0; }
+    void close(void)
+    {
+        if (f)
+            fclose(f);
+        f = NULL;
+    }
+private:
+    FILE *f;
+};
+
+class SDClass {
+public:
+    File open(const char *path, const char *mode = FILE_READ)
+    {
+        return File(fopen(path, mode));
+    }
+};
+
+inline SDClass SD;           // one object for every translation unit
+
+#endif
@@ -0,0 +1,1744 @@
+/*****************************************************************************
+* | File      	:   paint_bench.cpp
+* | Author      :   lernerc606
+* | Function    :   Draw one large canvas in bands on all cores, with timings
+* | Info        :
+*   A host tool for the Paint_X_r() contexts of GUI_Paint. The canvas is
+*   cut into bands of whole rows; a pool of threads takes the next band
+*   from a shared counter and draws the scene into it through its own
+*   PAINT, clipped to the band. Every thread count must give the same
+*   picture, checked against a single thread render by checksum.
+*
+*   With --polygons it times Paint_DrawPolygon_r() instead, on stars of
+*   10, 100 and 1000 vertices, drawn whole and in bands. With --tints it
+*   compares tinted fills (PAINT_TINT()) of a rectangle, a circle and a
+*   polygon with the same areas dithered one pixel at a time. With --text
+*   it times GUI_Text layouts of paragraph-length captions and drawing
+*   them in 40-row bands.
+*
+*   The other modes time parts of GUI_Paint against the per-pixel code
+*   it had before, kept here on top of Paint_SetPixel_r(), and check that
+*   both leave the same bytes: --writers glyphs, lines and fills through
+*   the specialised pixel and span writers, --clear whole-image clears,
+*   random windows and filled rectangles through the row fill, --pixels
+*   the pixels thick lines, outlines and filled circles write (a build
+*   with -DPAINT_COUNT=1 counts them), --glyphs the characters per second
+*   of Font8 to Font24 and the CN fonts. --caption times a 200 character
+*   CN caption looked up through the sorted key index and by scanning,
+*   in Font24CN and in a synthetic 3000 entry font. --packed compares the
+*   flash size and drawing speed of the packed ASCII fonts (FONT_PACKED)
+*   with plain tables. --blits checks Paint_DrawImage4() and
+*   Paint_DrawSprite4() against pixel by pixel pasting on random cases and
+*   times thumbnails. --sdfont draws a .s6f font through the GUI_SDFont
+*   glyph cache, read from a file by the SD.h shim, against the file read
+*   whole, and prints cache hits and reads.
+*
+*   With --bands a random scene of 400 calls, recorded in a display list,
+*   is drawn the way GUI_Band_Show() does, in bands of 16 to 200 rows half
+*   the panel wide, at 0 and 90 degrees, once replaying every call for
+*   every band and once only the calls whose box meets the band
+*   (GUI_DList_Draw()). The bands put together must give the same frame as
+*   drawing it whole; the buffer size and render times of each band
+*   height are printed.
+*
+*   Build from the repository root:
+*     g++ -O2 -std=gnu++17 -pthread -DPAINT_THREADS=1 -Itools/paint_bench -I.
+*         tools/paint_bench/paint_bench.cpp GUI_Paint.cpp GUI_Text.cpp GUI_DList.cpp
+*         GUI_SDFont.cpp font*.cpp -o paint_bench
+*   Run:
+*     ./paint_bench [--width 4800] [--height 6400] [--band 64] [--reps 5]
+*                   [--threads 1,2,4,8]
+*     ./paint_bench --polygons [--reps 5]
+*     ./paint_bench --tints [--reps 5]
+*     ./paint_bench --text [--reps 5]
+*     ./paint_bench --writers [--reps 5]
+*     ./paint_bench --clear [--reps 5]
+*     ./paint_bench --bands
+*     ./paint_bench --pixels [--reps 5]     (built with -DPAINT_COUNT=1)
+*     ./paint_bench --glyphs [--reps 5]
+*     ./paint_bench --caption [--reps 5]
+*     ./paint_bench --packed [--reps 5]
+*     ./paint_bench --blits [--reps 5]
+*     python3 tools/make_s6f.py Font.ttf --size 24 -o caption.s6f
+*     ./paint_bench --sdfont [--font caption.s6f] [--reps 5]
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+*
+******************************************************************************/
+#include "GUI_Paint.h"
+#include "GUI_Text.h"
+#include "GUI_DList.h"
+#include "GUI_Band.h"
+#include "GUI_SDFont.h"
+#include <stdarg.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define CELL        300     // scene cell, pixels
+#define MAX_THREADS 64
+
+// Debug.h
+void Log_Write(uint8_t, const char *Msg)
+{
+    fputs(Msg, stderr);
+}
+
+void Log_Printf(uint8_t, const char *Fmt, ...)
+{
+    va_list Args;
+    va_start(Args, Fmt);
+    vfprintf(stderr, Fmt, Args);
+    va_end(Args);
+}
+
+typedef struct {
+    UBYTE *Canvas;          // 4bpp, Width / 2 bytes per row
+    UWORD Width;
+    UWORD Height;
+    UWORD Band;             // rows per band
+    UWORD Bands;
+} BENCH_FRAME;
+
+static const UWORD Bench_Colors[] = { S6_BLACK, S6_YELLOW, S6_RED, S6_BLUE, S6_GREEN };
+
+/******************************************************************************
+function :  Draw the scene into one band
+info     :  Each cell holds a filled box, a thick circle, a thick diagonal
+            and two lines of text. Cells outside the band are skipped, the
+            rest is clipped by Paint.
+******************************************************************************/
+static void Bench_DrawBand(const BENCH_FRAME *Frame, UWORD Band)
+{
+    PAINT Ctx;
+    UWORD Y0 = Band * Frame->Band;
+    UWORD Rows = (Frame->Height - Y0 < Frame->Band)? Frame->Height - Y0 : Frame->Band;
+    UWORD Xstart, Ystart, Xend, Yend;
+    char Text[32];
+
+    Paint_NewImage_r(&Ctx, Frame->Canvas + (size_t)Y0 * (Frame->Width / 2), Frame->Width, Frame->Height,
+                     ROTATE_0, WHITE);
+    Paint_SetScale_r(&Ctx, 6);
+    Paint_SetBand_r(&Ctx, 0, Y0, Frame->Width, Rows);
+    Paint_Clear_r(&Ctx, S6_WHITE);
+    Paint_GetBandWindow_r(&Ctx, &Xstart, &Ystart, &Xend, &Yend);
+
+    for (UWORD Cy = Ystart / CELL; Cy * CELL < Yend; Cy++) {
+        for (UWORD Cx = 0; Cx * CELL < Frame->Width; Cx++) {
+            UWORD X = Cx * CELL, Y = Cy * CELL;
+            UWORD Cell = Cy * (Frame->Width / CELL) + Cx;
+            UWORD Color = Bench_Colors[Cell % 5];
+            if (X + CELL > Frame->Width || Y + CELL > Frame->Height)
+                continue;
+
+            Paint_DrawRectangle_r(&Ctx, X + 10, Y + 10, X + 140, Y + 120, Color, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+            Paint_DrawCircle_r(&Ctx, X + 210, Y + 80, 60, Bench_Colors[(Cell + 1) % 5], DOT_PIXEL_3X3, DRAW_FILL_EMPTY);
+            Paint_DrawLine_r(&Ctx, X + 10, Y + 290, X + 290, Y + 140, Bench_Colors[(Cell + 2) % 5],
+                             DOT_PIXEL_2X2, LINE_STYLE_SOLID);
+            Paint_DrawString_EN_r(&Ctx, X + 10, Y + 150, "Spectra 6", &Font24, S6_BLACK, FONT_BACKGROUND);
+            snprintf(Text, sizeof(Text), "cell %u", (unsigned)Cell);
+            Paint_DrawString_EN_r(&Ctx, X + 10, Y + 180, Text, &Font16, S6_WHITE, Color);
+        }
+    }
+}
+
+/******************************************************************************
+Thread pool
+    The workers sleep until a frame is posted, then take bands from Next
+    until none are left. The last one to finish wakes the caller.
+******************************************************************************/
+typedef struct {
+    std::mutex Lock;
+    std::condition_variable Wake;
+    std::condition_variable Done;
+    const BENCH_FRAME *Frame;
+    UDOUBLE Generation;     // frames posted
+    UBYTE Active;           // workers taking part in the current frame
+    UBYTE Busy;             // of those, still drawing
+    UBYTE Quit;
+    std::atomic<int> Next;  // next band to draw
+    std::vector<std::thread> Threads;
+} BENCH_POOL;
+
+static void Bench_Worker(BENCH_POOL *Pool, UBYTE Index)
+{
+    UDOUBLE Seen = 0;
+
+    for (;;) {
+        std::unique_lock<std::mutex> Guard(Pool->Lock);
+        Pool->Wake.wait(Guard, [&] { return Pool->Quit || (Pool->Generation != Seen && Index < Pool->Active); });
+        if (Pool->Quit)
+            return;
+        Seen = Pool->Generation;
+        const BENCH_FRAME *Frame = Pool->Frame;
+        Guard.unlock();
+
+        for (int Band; (Band = Pool->Next.fetch_add(1)) < Frame->Bands; )
+            Bench_DrawBand(Frame, Band);
+
+        Guard.lock();
+        if (--Pool->Busy == 0)
+            Pool->Done.notify_one();
+    }
+}
+
+static void Bench_PoolStart(BENCH_POOL *Pool, UBYTE Threads)
+{
+    Pool->Generation = 0;
+    Pool->Quit = 0;
+    for (UBYTE i = 0; i < Threads; i++)
+        Pool->Threads.emplace_back(Bench_Worker, Pool, i);
+}
+
+static void Bench_PoolStop(BENCH_POOL *Pool)
+{
+    {
+        std::lock_guard<std::mutex> Guard(Pool->Lock);
+        Pool->Quit = 1;
+    }
+    Pool->Wake.notify_all();
+    for (std::thread &Thread : Pool->Threads)
+        Thread.join();
+}
+
+// Draw the whole frame on the first Threads workers
+static void Bench_Render(BENCH_POOL *Pool, const BENCH_FRAME *Frame, UBYTE Threads)
+{
+    std::unique_lock<std::mutex> Guard(Pool->Lock);
+    Pool->Frame = Frame;
+    Pool->Next = 0;
+    Pool->Active = Threads;
+    Pool->Busy = Threads;
+    Pool->Generation++;
+    Pool->Wake.notify_all();
+    Pool->Done.wait(Guard, [&] { return Pool->Busy == 0; });
+}
+
+/******************************************************************************
+function :  Time polygon fills on a 1200 x 1600 picture
+info     :  A star of N vertices around the middle, radii random; the
+            same outline drawn as N Paint_DrawLine_r() calls for scale.
+            Banded draws fill 16 bands of 100 rows, one after the other.
+******************************************************************************/
+template <class F>
+static double Bench_Best(int Reps, F Draw)
+{
+    double Best = 1e30;
+    for (int r = 0; r < Reps; r++) {
+        auto t0 = std::chrono::steady_clock::now();
+        Draw();
+        double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+        Best = (us < Best)? us : Best;
+    }
+    return Best;
+}
+
+static int Bench_Polygons(int Reps)
+{
+    static const UWORD Sizes[] = { 10, 100, 1000 };
+    static PAINT_POINT Points[1000];
+    UBYTE *Image = (UBYTE *)malloc(600 * 1600);
+    PAINT Ctx;
+
+    if (Image == NULL) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    srand(1);
+    printf("vertices   even-odd    nonzero   16 bands    outline (lines)\n");
+    for (UWORD n : Sizes) {
+        for (UWORD i = 0; i < n; i++) {
+            double a = 2 * M_PI * i / n, Radius = 200 + rand() % 380;
+            Points[i].X = 600 + Radius * cos(a);
+            Points[i].Y = 800 + Radius * sin(a);
+        }
+        Paint_NewImage_r(&Ctx, Image, 1200, 1600, ROTATE_0, WHITE);
+        Paint_SetScale_r(&Ctx, 6);
+
+        double EvenOdd = Bench_Best(Reps, [&] { Paint_DrawPolygon_r(&Ctx, Points, n, S6_RED, FILL_EVEN_ODD); });
+        double NonZero = Bench_Best(Reps, [&] { Paint_DrawPolygon_r(&Ctx, Points, n, S6_RED, FILL_NONZERO); });
+        double Banded = Bench_Best(Reps, [&] {
+            for (UWORD Y = 0; Y < 1600; Y += 100) {
+                Paint_NewImage_r(&Ctx, Image + Y * 600, 1200, 1600, ROTATE_0, WHITE);
+                Paint_SetScale_r(&Ctx, 6);
+                Paint_SetBand_r(&Ctx, 0, Y, 1200, 100);
+                Paint_DrawPolygon_r(&Ctx, Points, n, S6_RED, FILL_EVEN_ODD);
+            }
+        });
+        Paint_NewImage_r(&Ctx, Image, 1200, 1600, ROTATE_0, WHITE);
+        Paint_SetScale_r(&Ctx, 6);
+        double Outline = Bench_Best(Reps, [&] {
+            for (UWORD i = 0; i < n; i++)
+                Paint_DrawLine_r(&Ctx, Points[i].X, Points[i].Y, Points[(i + 1) % n].X, Points[(i + 1) % n].Y,
+                                 S6_BLACK, DOT_PIXEL_1X1, LINE_STYLE_SOLID);
+        });
+        printf("%8u %8.1f us %8.1f us %8.1f us %8.1f us\n", (unsigned)n, EvenOdd, NonZero, Banded, Outline);
+    }
+    free(Image);
+    return 0;
+}
+
+/******************************************************************************
+function :  Time tinted fills on a 1200 x 1600 picture
+info     :  Each shape is drawn plain, as a tint, and as the same tint with
+            the band one pixel off the byte grid, where GUI_Paint picks the
+            color pixel by pixel. Last, the pixels of the shape are dithered
+            by the caller with Paint_SetPixel_r(), as before tints.
+******************************************************************************/
+static void Bench_Shape(PAINT *Ctx, int Shape, const PAINT_POINT *Points, UWORD Color)
+{
+    if (Shape == 0)
+        Paint_DrawRectangle_r(Ctx, 100, 100, 1100, 1500, Color, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+    else if (Shape == 1)
+        Paint_DrawCircle_r(Ctx, 600, 800, 500, Color, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+    else
+        Paint_DrawPolygon_r(Ctx, Points, 100, Color, FILL_EVEN_ODD);
+}
+
+static int Bench_Tints(int Reps)
+{
+    static const char *Names[] = { "rectangle", "circle", "polygon" };
+    static const UWORD Tint = S6_ORANGE;
+    static PAINT_POINT Points[100];
+    UBYTE *Image = (UBYTE *)malloc(600 * 1600);
+    UBYTE *Mask = (UBYTE *)malloc(600 * 1600);
+    PAINT Ctx;
+
+    if (Image == NULL || Mask == NULL) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    srand(1);
+    for (UWORD i = 0; i < 100; i++) {
+        double a = 2 * M_PI * i / 100, Radius = 200 + rand() % 380;
+        Points[i].X = 600 + Radius * cos(a);
+        Points[i].Y = 800 + Radius * sin(a);
+    }
+
+    printf("shape       pixels      plain       tint  per pixel   SetPixel   (Mpixel/s)\n");
+    for (int Shape = 0; Shape < 3; Shape++) {
+        // The shape's pixels, for the caller's dither and the rates
+        Paint_NewImage_r(&Ctx, Mask, 1200, 1600, ROTATE_0, WHITE);
+        Paint_SetScale_r(&Ctx, 6);
+        Paint_Clear_r(&Ctx, S6_WHITE);
+        Bench_Shape(&Ctx, Shape, Points, S6_BLACK);
+        long Pixels = 0;
+        for (long i = 0; i < 600 * 1600; i++)
+            Pixels += ((Mask[i] >> 4) == S6_BLACK) + ((Mask[i] & 0x0F) == S6_BLACK);
+
+        Paint_NewImage_r(&Ctx, Image, 1200, 1600, ROTATE_0, WHITE);
+        Paint_SetScale_r(&Ctx, 6);
+        double Plain = Bench_Best(Reps, [&] { Bench_Shape(&Ctx, Shape, Points, S6_RED); });
+        double Tinted = Bench_Best(Reps, [&] { Bench_Shape(&Ctx, Shape, Points, Tint); });
+        Paint_NewImage_r(&Ctx, Image, 1200, 1600, ROTATE_0, WHITE);
+        Paint_SetScale_r(&Ctx, 6);
+        Paint_SetBand_r(&Ctx, 1, 0, 1199, 1600);
+        double Odd = Bench_Best(Reps, [&] { Bench_Shape(&Ctx, Shape, Points, Tint); });
+        Paint_NewImage_r(&Ctx, Image, 1200, 1600, ROTATE_0, WHITE);
+        Paint_SetScale_r(&Ctx, 6);
+        double Caller = Bench_Best(Reps, [&] {
+            for (UWORD Y = 0; Y < 1600; Y++) {
+                const UBYTE *Row = Mask + Y * 600;
+                for (UWORD X = 0; X < 1200; X++) {
+                    if (((Row[X / 2] >> ((X & 1)? 0 : 4)) & 0x0F) != S6_BLACK)
+                        continue;
+                    // Bayer threshold of X, Y from the bits of X ^ Y and Y
+                    UBYTE a = X ^ Y, b = Y, t = 0;
+                    for (UBYTE k = 0; k < 3; k++)
+                        t |= (((a >> k) & 1) << (5 - 2 * k)) | (((b >> k) & 1) << (4 - 2 * k));
+                    Paint_SetPixel_r(&Ctx, X, Y, (t < 32)? S6_RED : S6_YELLOW);
+                }
+            }
+        });
+        printf("%-10s %7ld %10.1f %10.1f %10.1f %10.1f\n", Names[Shape], Pixels,
+               Pixels / Plain, Pixels / Tinted, Pixels / Odd, Pixels / Caller);
+    }
+    free(Mask);
+    free(Image);
+    return 0;
+}
+
+/******************************************************************************
+function :  Time caption layouts on a 1200 x 1600 picture
+info     :  A paragraph of about 600 characters, laid out 1000 pixels wide
+            in Font16 and in Font12CN. The picture is drawn in 40 row bands
+            the way GUI_Band_Show() does, once with one layout reused for
+            every band, once laying the text out again in every band, and
+            once with Paint_DrawString_EN(), which breaks lines at the
+            image edge instead, for comparison.
+******************************************************************************/
+static const char Bench_Paragraph[] =
+    "Picked up from the SD card at dawn, this picture of the harbour was taken on a grey "
+    "morning in late October, when the fishing boats were still tied up and the gulls had "
+    "the quay to themselves. The caption wraps between words, keeps each line centred and "
+    "ends in an ellipsis if it runs out of room, so a long note written in order.txt never "
+    "spills over the picture or starts over at the top. Every band "
+    "of the frame draws the same layout again, only the glyphs that fall in the band, "
+    "without measuring or searching the font. The rest of this sentence is only here to "
+    "make the paragraph long enough to need several lines at the chosen width.";
+
+static int Bench_Text(int Reps)
+{
+    static GUI_TEXT Text;
+    UBYTE *Image = (UBYTE *)malloc(600 * 1600);
+
+    if (Image == NULL) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    printf("font     glyphs lines   layout     draw  bands, reused  bands, relaid  DrawString_EN\n");
+    for (int CN = 0; CN < 2; CN++) {
+        auto Layout = [&] {
+            if (CN)
+                GUI_Text_LayoutCN(&Text, &Font12CN, Bench_Paragraph, 1000, 0, TEXT_ALIGN_CENTER);
+            else
+                GUI_Text_Layout(&Text, &Font16, Bench_Paragraph, 1000, 0, TEXT_ALIGN_CENTER);
+        };
+        auto Banded = [&](auto Draw) {
+            for (UWORD Y = 0; Y < 1600; Y += 40) {
+                Paint_NewImage(Image + Y * 600, 1200, 1600, ROTATE_0, WHITE);
+                Paint_SetScale(6);
+                Paint_SetBand(0, Y, 1200, 40);
+                Draw();
+            }
+        };
+
+        double Lay = Bench_Best(Reps, Layout);
+        Paint_NewImage(Image, 1200, 1600, ROTATE_0, WHITE);
+        Paint_SetScale(6);
+        double Draw = Bench_Best(Reps, [&] { GUI_Text_Draw(&Text, 100, 1300, S6_BLACK, FONT_BACKGROUND); });
+        double Reused = Bench_Best(Reps, [&] {
+            Layout();
+            Banded([&] { GUI_Text_Draw(&Text, 100, 1300, S6_BLACK, FONT_BACKGROUND); });
+        });
+        double Relaid = Bench_Best(Reps, [&] {
+            Banded([&] {
+                Layout();
+                GUI_Text_Draw(&Text, 100, 1300, S6_BLACK, FONT_BACKGROUND);
+            });
+        });
+        double Plain = Bench_Best(Reps, [&] {
+            Banded([&] {
+                if (CN)
+                    Paint_DrawString_CN(100, 1300, Bench_Paragraph, &Font12CN, S6_BLACK, FONT_BACKGROUND);
+                else
+                    Paint_DrawString_EN(100, 1300, Bench_Paragraph, &Font16, FONT_BACKGROUND, S6_BLACK);
+            });
+        });
+        printf("%-9s %5u %5u %6.1f us %6.1f us %10.1f us %10.1f us %11.1f us\n", CN? "Font12CN" : "Font16",
+               (unsigned)Text.Glyphs, (unsigned)Text.Lines, Lay, Draw, Reused, Relaid, Plain);
+    }
+    free(Image);
+    return 0;
+}
+
+/******************************************************************************
+Reference drawing
+    The per-pixel code of GUI_Paint before the specialised writers, on
+    Paint_SetPixel_r(): every pixel looks its writer up again, as the old
+    Paint_SetPixel() switched on rotation, mirror and scale. Fonts are
+    drawn from plain tables, see Bench_RawFont().
+******************************************************************************/
+static void Ref_DrawPoint(PAINT *P, UWORD Xpoint, UWORD Ypoint, UWORD Color, DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_Style)
+{
+    if (Xpoint > P->Width || Ypoint > P->Height)
+        return;
+
+    if (Dot_Style == DOT_FILL_AROUND) {
+        for (int XDir_Num = 0; XDir_Num < 2 * Dot_Pixel - 1; XDir_Num++) {
+            for (int YDir_Num = 0; YDir_Num < 2 * Dot_Pixel - 1; YDir_Num++) {
+                if (Xpoint + XDir_Num - Dot_Pixel < 0 || Ypoint + YDir_Num - Dot_Pixel < 0)
+                    break;
+                Paint_SetPixel_r(P, Xpoint + XDir_Num - Dot_Pixel, Ypoint + YDir_Num - Dot_Pixel, Color);
+            }
+        }
+    } else {
+        for (int XDir_Num = 0; XDir_Num < Dot_Pixel; XDir_Num++)
+            for (int YDir_Num = 0; YDir_Num < Dot_Pixel; YDir_Num++)
+                Paint_SetPixel_r(P, Xpoint + XDir_Num - 1, Ypoint + YDir_Num - 1, Color);
+    }
+}
+
+static void Ref_DrawLine(PAINT *P, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color,
+                         DOT_PIXEL Line_width, LINE_STYLE Line_Style)
+{
+    if (Xstart > P->Width || Ystart > P->Height || Xend > P->Width || Yend > P->Height)
+        return;
+
+    UWORD Xpoint = Xstart;
+    UWORD Ypoint = Ystart;
+    int dx = (int)Xend - (int)Xstart >= 0 ? Xend - Xstart : Xstart - Xend;
+    int dy = (int)Yend - (int)Ystart <= 0 ? Yend - Ystart : Ystart - Yend;
+    int XAddway = Xstart < Xend ? 1 : -1;
+    int YAddway = Ystart < Yend ? 1 : -1;
+    int Esp = dx + dy;
+    char Dotted_Len = 0;
+
+    for (;;) {
+        Dotted_Len++;
+        if (Line_Style == LINE_STYLE_DOTTED && Dotted_Len % 3 == 0) {
+            Ref_DrawPoint(P, Xpoint, Ypoint, IMAGE_BACKGROUND, Line_width, DOT_STYLE_DFT);
+            Dotted_Len = 0;
+        } else {
+            Ref_DrawPoint(P, Xpoint, Ypoint, Color, Line_width, DOT_STYLE_DFT);
+        }
+        if (2 * Esp >= dy) {
+            if (Xpoint == Xend)
+                break;
+            Esp += dy;
+            Xpoint += XAddway;
+        }
+        if (2 * Esp <= dx) {
+            if (Ypoint == Yend)
+                break;
+            Esp += dx;
+            Ypoint += YAddway;
+        }
+    }
+}
+
+// Byte by byte with a 2D index; 4bpp only
+static void Ref_Clear(PAINT *P, UWORD Color)
+{
+    for (UWORD Y = 0; Y < P->HeightByte; Y++) {
+        for (UWORD X = 0; X < P->WidthByte; X++) {
+            UDOUBLE Addr = X + Y * P->WidthByte;
+            P->Image[Addr] = (Color << 4) | Color;
+        }
+    }
+}
+
+static void Ref_ClearWindows(PAINT *P, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
+{
+    for (UWORD Y = Ystart; Y < Yend; Y++)
+        for (UWORD X = Xstart; X < Xend; X++)
+            Paint_SetPixel_r(P, X, Y, Color);
+}
+
+// Filled: a Line_width line on every row
+static void Ref_DrawRectangle(PAINT *P, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color,
+                              DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+{
+    if (Xstart > P->Width || Ystart > P->Height || Xend > P->Width || Yend > P->Height)
+        return;
+
+    if (Draw_Fill) {
+        for (UWORD Ypoint = Ystart; Ypoint < Yend; Ypoint++)
+            Ref_DrawLine(P, Xstart, Ypoint, Xend, Ypoint, Color, Line_width, LINE_STYLE_SOLID);
+    } else {
+        Ref_DrawLine(P, Xstart, Ystart, Xend, Ystart, Color, Line_width, LINE_STYLE_SOLID);
+        Ref_DrawLine(P, Xstart, Ystart, Xstart, Yend, Color, Line_width, LINE_STYLE_SOLID);
+        Ref_DrawLine(P, Xend, Yend, Xend, Ystart, Color, Line_width, LINE_STYLE_SOLID);
+        Ref_DrawLine(P, Xend, Yend, Xstart, Yend, Color, Line_width, LINE_STYLE_SOLID);
+    }
+}
+
+// 1x1 points for every octant and fill step, Line_width points on the outline
+static void Ref_DrawCircle(PAINT *P, UWORD X_Center, UWORD Y_Center, UWORD Radius, UWORD Color,
+                           DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+{
+    if (X_Center > P->Width || Y_Center >= P->Height)
+        return;
+
+    int16_t XCurrent = 0, YCurrent = Radius;
+    int16_t Esp = 3 - (Radius << 1);
+    while (XCurrent <= YCurrent) {
+        if (Draw_Fill == DRAW_FILL_FULL) {
+            for (int16_t sCountY = XCurrent; sCountY <= YCurrent; sCountY++) {
+                Ref_DrawPoint(P, X_Center + XCurrent, Y_Center + sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+                Ref_DrawPoint(P, X_Center - XCurrent, Y_Center + sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+                Ref_DrawPoint(P, X_Center - sCountY, Y_Center + XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+                Ref_DrawPoint(P, X_Center - sCountY, Y_Center - XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+                Ref_DrawPoint(P, X_Center - XCurrent, Y_Center - sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+                Ref_DrawPoint(P, X_Center + XCurrent, Y_Center - sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+                Ref_DrawPoint(P, X_Center + sCountY, Y_Center - XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+                Ref_DrawPoint(P, X_Center + sCountY, Y_Center + XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+            }
+        } else {
+            Ref_DrawPoint(P, X_Center + XCurrent, Y_Center + YCurrent, Color, Line_width, DOT_STYLE_DFT);
+            Ref_DrawPoint(P, X_Center - XCurrent, Y_Center + YCurrent, Color, Line_width, DOT_STYLE_DFT);
+            Ref_DrawPoint(P, X_Center - YCurrent, Y_Center + XCurrent, Color, Line_width, DOT_STYLE_DFT);
+            Ref_DrawPoint(P, X_Center - YCurrent, Y_Center - XCurrent, Color, Line_width, DOT_STYLE_DFT);
+            Ref_DrawPoint(P, X_Center - XCurrent, Y_Center - YCurrent, Color, Line_width, DOT_STYLE_DFT);
+            Ref_DrawPoint(P, X_Center + XCurrent, Y_Center - YCurrent, Color, Line_width, DOT_STYLE_DFT);
+            Ref_DrawPoint(P, X_Center + YCurrent, Y_Center - XCurrent, Color, Line_width, DOT_STYLE_DFT);
+            Ref_DrawPoint(P, X_Center + YCurrent, Y_Center + XCurrent, Color, Line_width, DOT_STYLE_DFT);
+        }
+        if (Esp < 0)
+            Esp += 4 * XCurrent + 6;
+        else {
+            Esp += 10 + 4 * (XCurrent - YCurrent);
+            YCurrent--;
+        }
+        XCurrent++;
+    }
+}
+
+// One bit at a time, rows padded to whole bytes
+static void Ref_DrawGlyph(PAINT *P, UWORD Xpoint, UWORD Ypoint, const UBYTE *ptr, UWORD Width, UWORD Height,
+                          UWORD Color_Foreground, UWORD Color_Background)
+{
+    for (UWORD Page = 0; Page < Height; Page++) {
+        for (UWORD Column = 0; Column < Width; Column++) {
+            if (*ptr & (0x80 >> (Column % 8)))
+                Paint_SetPixel_r(P, Xpoint + Column, Ypoint + Page, Color_Foreground);
+            else if (Color_Background != FONT_BACKGROUND)
+                Paint_SetPixel_r(P, Xpoint + Column, Ypoint + Page, Color_Background);
+            if (Column % 8 == 7)
+                ptr++;
+        }
+        if (Width % 8 != 0)
+            ptr++;
+    }
+}
+
+static void Ref_DrawChar(PAINT *P, UWORD Xpoint, UWORD Ypoint, char Acsii_Char, const sFONT *Font,
+                         UWORD Color_Foreground, UWORD Color_Background)
+{
+    if (Xpoint > P->Width || Ypoint > P->Height)
+        return;
+    uint32_t Char_Offset = (Acsii_Char - ' ') * Font->Height * (Font->Width / 8 + (Font->Width % 8 ? 1 : 0));
+    Ref_DrawGlyph(P, Xpoint, Ypoint, &Font->table[Char_Offset], Font->Width, Font->Height,
+                  Color_Foreground, Color_Background);
+}
+
+// Wraps at the image edge and swaps the colors, as Paint_DrawString_EN() does
+static void Ref_DrawString_EN(PAINT *P, UWORD Xstart, UWORD Ystart, const char *pString, const sFONT *Font,
+                              UWORD Color_Foreground, UWORD Color_Background)
+{
+    UWORD Xpoint = Xstart;
+    UWORD Ypoint = Ystart;
+
+    if (Xstart > P->Width || Ystart > P->Height)
+        return;
+    for (; *pString != '\0'; pString++, Xpoint += Font->Width) {
+        if ((Xpoint + Font->Width) > P->Width) {
+            Xpoint = Xstart;
+            Ypoint += Font->Height;
+        }
+        if ((Ypoint + Font->Height) > P->Height) {
+            Xpoint = Xstart;
+            Ypoint = Ystart;
+        }
+        Ref_DrawChar(P, Xpoint, Ypoint, *pString, Font, Color_Background, Color_Foreground);
+    }
+}
+
+/******************************************************************************
+function :  Font with a plain glyph table
+parameter:
+    Font  : Font8 to Font24
+    Table : Holds the table when one has to be made
+info     :  With FONT_PACKED the tables are not built in, so every glyph is
+            drawn once into a 1bpp image of its size and the bytes kept.
+******************************************************************************/
+static sFONT Bench_RawFont(sFONT *Font, std::vector<UBYTE> *Table)
+{
+    UWORD Stride = (Font->Width + 7) / 8;
+    sFONT Raw = { Font->table, Font->Width, Font->Height, NULL, NULL };
+    PAINT Ctx;
+
+    if (Font->table != NULL)
+        return Raw;
+    Table->assign((size_t)95 * Stride * Font->Height, 0);
+    for (int c = 0; c < 95; c++) {
+        Paint_NewImage_r(&Ctx, Table->data() + (size_t)c * Stride * Font->Height, Font->Width, Font->Height,
+                         ROTATE_0, WHITE);
+        Paint_SetScale_r(&Ctx, 2);
+        Paint_DrawChar_r(&Ctx, 0, 0, ' ' + c, Font, WHITE, BLACK);
+    }
+    Raw.table = Table->data();
+    return Raw;
+}
+
+/******************************************************************************
+function :  Time one drawing done by the reference code and by GUI_Paint
+parameter:
+    Name   : Row label
+    Rotate : Of both images
+    Scale  : Of both images
+    Old    : 600 x 1600 bytes for the reference
+    New    : 600 x 1600 bytes for GUI_Paint
+    Draw   : Draw(PAINT *P, int Lib), Lib 0 for the reference
+return   :  1 if the two images differ
+info     :  Both images start white and are drawn Reps times; the best
+            time of each is printed.
+******************************************************************************/
+template <class F>
+static int Bench_Versus(const char *Name, int Reps, UWORD Rotate, UBYTE Scale, UBYTE *Old, UBYTE *New, F Draw)
+{
+    UBYTE *Image[2] = { Old, New };
+    double Us[2];
+    PAINT Ctx;
+
+    for (int Lib = 0; Lib < 2; Lib++) {
+        memset(Image[Lib], S6_WHITE * 0x11, 600 * 1600);
+        Paint_NewImage_r(&Ctx, Image[Lib], 1200, 1600, Rotate, WHITE);
+        Paint_SetScale_r(&Ctx, Scale);
+        Us[Lib] = Bench_Best(Reps, [&] { Draw(&Ctx, Lib); });
+    }
+    int Same = !memcmp(Old, New, 600 * 1600);
+    printf("%-30s %3u %10.2f ms %10.2f ms %6.1fx  %s\n", Name, (unsigned)Rotate, Us[0] / 1000, Us[1] / 1000,
+           Us[0] / Us[1], Same? "same" : "DIFFERS");
+    return !Same;
+}
+
+/******************************************************************************
+function :  Time text, lines and fills through the specialised writers
+info     :  1200 x 1600 at scale 7: 1000 Font24 strings of 20 characters,
+            half of them opaque, 2000 random lines 3 pixels wide and 10
+            windows over the whole image, at 0 and 90 degrees.
+******************************************************************************/
+static int Bench_Writers(int Reps)
+{
+    static char Strings[1000][21];
+    static UWORD Places[2000][4];
+    std::vector<UBYTE> Table;
+    sFONT Raw = Bench_RawFont(&Font24, &Table);
+    UBYTE *Old = (UBYTE *)malloc(600 * 1600);
+    UBYTE *New = (UBYTE *)malloc(600 * 1600);
+    int Failed = 0;
+
+    if (Old == NULL || New == NULL) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    srand(1);
+    for (auto &String : Strings) {
+        for (int k = 0; k < 20; k++)
+            String[k] = ' ' + rand() % 95;
+        String[20] = 0;
+    }
+    for (auto &Place : Places)
+        for (UWORD &v : Place)
+            v = rand() % 1200;
+
+    printf("drawing                        rot    reference    GUI_Paint   gain\n");
+    for (UWORD Rotate : { ROTATE_0, ROTATE_90 }) {
+        Failed |= Bench_Versus("1000 Font24 strings", Reps, Rotate, 7, Old, New, [&](PAINT *P, int Lib) {
+            for (int i = 0; i < 1000; i++) {
+                UWORD Back = (i & 1)? S6_YELLOW : FONT_BACKGROUND;
+                if (Lib)
+                    Paint_DrawString_EN_r(P, Places[i][0], Places[i][1], Strings[i], &Font24, Back, S6_BLACK);
+                else
+                    Ref_DrawString_EN(P, Places[i][0], Places[i][1], Strings[i], &Raw, Back, S6_BLACK);
+            }
+        });
+        Failed |= Bench_Versus("2000 lines, 3 px", Reps, Rotate, 7, Old, New, [&](PAINT *P, int Lib) {
+            for (int i = 0; i < 2000; i++) {
+                const UWORD *L = Places[i];
+                if (Lib)
+                    Paint_DrawLine_r(P, L[0], L[1], L[2], L[3], Bench_Colors[i % 5], DOT_PIXEL_3X3, LINE_STYLE_SOLID);
+                else
+                    Ref_DrawLine(P, L[0], L[1], L[2], L[3], Bench_Colors[i % 5], DOT_PIXEL_3X3, LINE_STYLE_SOLID);
+            }
+        });
+        Failed |= Bench_Versus("10 full windows", Reps, Rotate, 7, Old, New, [&](PAINT *P, int Lib) {
+            for (int i = 0; i < 10; i++) {
+                if (Lib)
+                    Paint_ClearWindows_r(P, 0, 0, P->Width, P->Height, Bench_Colors[i % 5]);
+                else
+                    Ref_ClearWindows(P, 0, 0, P->Width, P->Height, Bench_Colors[i % 5]);
+            }
+        });
+    }
+    free(New);
+    free(Old);
+    return Failed;
+}
+
+/******************************************************************************
+function :  Time clears, windows and filled rectangles through the row fill
+info     :  1200 x 1600 at scale 7: 100 clears of the whole image, 2000
+            random windows up to 100 x 100 and 200 filled rectangles up to
+            190 x 190 with 2 pixel lines, at 0 and 90 degrees. Windows and
+            rectangles start on odd and even pixels alike.
+******************************************************************************/
+static int Bench_Clear(int Reps)
+{
+    static UWORD Boxes[2000][4];
+    UBYTE *Old = (UBYTE *)malloc(600 * 1600);
+    UBYTE *New = (UBYTE *)malloc(600 * 1600);
+    int Failed = 0;
+
+    if (Old == NULL || New == NULL) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    srand(1);
+    for (auto &Box : Boxes) {
+        Box[0] = rand() % 1000;
+        Box[1] = rand() % 1000;
+        Box[2] = Box[0] + 1 + rand() % 100;
+        Box[3] = Box[1] + 1 + rand() % 100;
+    }
+
+    printf("drawing                        rot    reference    GUI_Paint   gain\n");
+    for (UWORD Rotate : { ROTATE_0, ROTATE_90 }) {
+        Failed |= Bench_Versus("100 clears", Reps, Rotate, 7, Old, New, [&](PAINT *P, int Lib) {
+            for (int i = 0; i < 100; i++) {
+                if (Lib)
+                    Paint_Clear_r(P, Bench_Colors[i % 5]);
+                else
+                    Ref_Clear(P, Bench_Colors[i % 5]);
+            }
+        });
+        Failed |= Bench_Versus("2000 windows up to 100x100", Reps, Rotate, 7, Old, New, [&](PAINT *P, int Lib) {
+            for (int i = 0; i < 2000; i++) {
+                const UWORD *B = Boxes[i];
+                if (Lib)
+                    Paint_ClearWindows_r(P, B[0], B[1], B[2], B[3], Bench_Colors[i % 5]);
+                else
+                    Ref_ClearWindows(P, B[0], B[1], B[2], B[3], Bench_Colors[i % 5]);
+            }
+        });
+        Failed |= Bench_Versus("200 filled rectangles, 2 px", Reps, Rotate, 7, Old, New, [&](PAINT *P, int Lib) {
+            for (int i = 0; i < 200; i++) {
+                const UWORD *B = Boxes[i];
+                UWORD Xend = B[0] + (B[2] - B[0]) * 19 / 10, Yend = B[1] + (B[3] - B[1]) * 19 / 10;
+                if (Lib)
+                    Paint_DrawRectangle_r(P, B[0], B[1], Xend, Yend, Bench_Colors[i % 5], DOT_PIXEL_2X2,
+                                          DRAW_FILL_FULL);
+                else
+                    Ref_DrawRectangle(P, B[0], B[1], Xend, Yend, Bench_Colors[i % 5], DOT_PIXEL_2X2, DRAW_FILL_FULL);
+            }
+        });
+    }
+    free(New);
+    free(Old);
+    return Failed;
+}
+
+/******************************************************************************
+function :  Record a random scene of 400 calls for a Width x Height image
+info     :  Lines of every width, solid and dotted, rectangles and circles
+            empty and filled, windows, EN strings that wrap at the edge, CN
+            strings and GUI_Text layouts, opaque and transparent. Circles
+            may run off the image; every call starts inside it.
+******************************************************************************/
+#define BENCH_LAYOUTS   40
+
+static void Bench_Scene(GUI_DLIST *List, UWORD Width, UWORD Height)
+{
+    static sFONT *Fonts[] = { &Font8, &Font12, &Font16, &Font20, &Font24 };
+    static cFONT *FontsCN[] = { &Font12CN, &Font24CN };
+    static GUI_TEXT Layouts[BENCH_LAYOUTS];
+    UWORD Laid = 0;
+    char Text[64];
+
+    for (int i = 0; i < 400; i++) {
+        UWORD X = rand() % Width, Y = rand() % Height;
+        UWORD X2 = rand() % Width, Y2 = rand() % Height;
+        UWORD Color = Bench_Colors[rand() % 5];
+        UWORD Back = (rand() % 2)? FONT_BACKGROUND : Bench_Colors[rand() % 5];
+        DOT_PIXEL Line = (DOT_PIXEL)(1 + rand() % 8);
+
+        switch (rand() % 8) {
+        case 0:
+            GUI_DList_Line(List, X, Y, X2, Y2, Color, Line, (LINE_STYLE)(rand() % 2));
+            break;
+        case 1:
+            GUI_DList_Rectangle(List, X, Y, X2, Y2, Color, Line, (DRAW_FILL)(rand() % 2));
+            break;
+        case 2:
+            GUI_DList_Circle(List, X, Y, 1 + rand() % 200, Color, Line, (DRAW_FILL)(rand() % 2));
+            break;
+        case 3:
+            GUI_DList_ClearWindows(List, (X < X2)? X : X2, (Y < Y2)? Y : Y2, (X < X2)? X2 : X, (Y < Y2)? Y2 : Y,
+                                   Color);
+            break;
+        case 4:
+        case 5: {
+            int Len = 1 + rand() % 40;
+            for (int k = 0; k < Len; k++)
+                Text[k] = ' ' + rand() % 95;
+            Text[Len] = 0;
+            if (rand() % 4 == 0 && Laid < BENCH_LAYOUTS) {
+                GUI_TEXT *Layout = &Layouts[Laid++];
+                GUI_Text_Layout(Layout, Fonts[rand() % 5], Text, 20 + rand() % 300, 0, (TEXT_ALIGN)(rand() % 3));
+                GUI_DList_Text(List, Layout, X, Y, Color, Back);
+            } else {
+                GUI_DList_String_EN(List, X, Y, Text, Fonts[rand() % 5], Back, Color);
+            }
+            break;
+        }
+        default: {
+            // Characters the font has, ASCII and Chinese mixed
+            cFONT *Font = FontsCN[rand() % 2];
+            int Len = 0;
+            for (int k = 1 + rand() % 12; k > 0; k--) {
+                const CH_CN *Entry = &Font->table[rand() % Font->size];
+                Text[Len++] = Entry->index[0];
+                if ((Entry->index[0] & 0xFF) > 0x7F) {
+                    Text[Len++] = Entry->index[1];
+                    Text[Len++] = Entry->index[2];
+                }
+            }
+            Text[Len] = 0;
+            if (rand() % 2 && Laid < BENCH_LAYOUTS) {
+                GUI_TEXT *Layout = &Layouts[Laid++];
+                GUI_Text_LayoutCN(Layout, Font, Text, 20 + rand() % 300, 0, (TEXT_ALIGN)(rand() % 3));
+                GUI_DList_Text(List, Layout, X, Y, Color, Back);
+            } else {
+                GUI_DList_String_CN(List, X, Y, Text, Font, Color, Back);
+            }
+            break;
+        }
+        }
+    }
+}
+
+/******************************************************************************
+function :  Draw a display list in bands into a whole frame
+parameter:
+    Rows   : Rows per band
+    Buffer : Rows * 300 bytes
+    Frame  : 600 * 1600 bytes, gets the bands
+    Draw   : Replay of the list, as given to GUI_Band_Show()
+return   :  Time taken, ms
+info     :  As GUI_Band_Show(): every band is half a panel row wide, all
+            bands of the left half first, and is cleared before drawing.
+******************************************************************************/
+static double Bench_Banded(GUI_DLIST *List, UWORD Rotate, UWORD Rows, UBYTE *Buffer, UBYTE *Frame,
+                           GUI_BAND_DRAW Draw)
+{
+    auto t0 = std::chrono::steady_clock::now();
+    Paint_NewImage(Buffer, 1200, 1600, Rotate, WHITE);
+    Paint_SetScale(6);
+    for (UBYTE Half = 0; Half < 2; Half++) {
+        for (UWORD Start = 0; Start < 1600; Start += Rows) {
+            UWORD N = (1600 - Start < Rows)? 1600 - Start : Rows;
+            Paint_SetBand(Half * 600, Start, 600, N);
+            Paint_Clear(S6_WHITE);
+            Draw(List);
+            for (UWORD r = 0; r < N; r++)
+                memcpy(Frame + (size_t)(Start + r) * 600 + Half * 300, Buffer + r * 300, 300);
+        }
+    }
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+}
+
+/******************************************************************************
+function :  Check banded drawing against drawing the frame whole
+info     :  Each band height's buffer is Rows * 300 bytes against 960000
+            for the whole frame; the display list arena comes on top.
+            Replaying every call costs more the more bands there are;
+            culled, each call is drawn for the few bands it meets.
+******************************************************************************/
+static int Bench_Bands(int)
+{
+    static const UWORD Heights[] = { 16, GUI_BAND_ROWS, 100, 200 };
+    static UBYTE Arena[64 * 1024] __attribute__((aligned(4)));
+    UBYTE *Whole = (UBYTE *)malloc(600 * 1600);
+    UBYTE *Frame = (UBYTE *)malloc(600 * 1600);
+    UBYTE *Buffer = (UBYTE *)malloc(200 * 300);
+    GUI_DLIST List;
+    int Failed = 0;
+
+    if (Whole == NULL || Frame == NULL || Buffer == NULL) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    srand(1);
+    printf("rot  rows   buffer  bands    replay all        culled  calls drawn\n");
+    for (UWORD Rotate : { ROTATE_0, ROTATE_90 }) {
+        GUI_DList_Init(&List, Arena, sizeof(Arena));
+        Bench_Scene(&List, (Rotate == ROTATE_0)? 1200 : 1600, (Rotate == ROTATE_0)? 1600 : 1200);
+        if (List.Overflow) {
+            fprintf(stderr, "scene does not fit the arena\n");
+            return 1;
+        }
+
+        Paint_NewImage(Whole, 1200, 1600, Rotate, WHITE);
+        Paint_SetScale(6);
+        Paint_Clear(S6_WHITE);
+        GUI_DList_DrawAll(&List);
+
+        for (UWORD Rows : Heights) {
+            double All = Bench_Banded(&List, Rotate, Rows, Buffer, Frame, GUI_DList_DrawAll);
+            int SameAll = !memcmp(Whole, Frame, 600 * 1600);
+            List.Visited = List.Drawn = 0;
+            double Culled = Bench_Banded(&List, Rotate, Rows, Buffer, Frame, GUI_DList_Draw);
+            int SameCulled = !memcmp(Whole, Frame, 600 * 1600);
+            printf("%3u %5u %6u B %6u %7.1f ms %-4s %7.1f ms %-4s %lu of %lu\n", (unsigned)Rotate, (unsigned)Rows,
+                   (unsigned)Rows * 300, 2 * ((1600 + Rows - 1) / Rows), All, SameAll? "same" : "DIFF",
+                   Culled, SameCulled? "same" : "DIFF", (unsigned long)List.Drawn, (unsigned long)List.Visited);
+            Failed |= !SameAll || !SameCulled;
+        }
+        printf("    scene: %u calls, %lu bytes of display list\n", (unsigned)List.Count, (unsigned long)List.Used);
+    }
+    free(Buffer);
+    free(Frame);
+    free(Whole);
+    return Failed;
+}
+
+/******************************************************************************
+function :  Count and time the pixels single shapes write
+info     :  One shape at a time on a 1200 x 1600 image at scale 6, at 0 and
+            90 degrees. A pixel written twice counts twice, so the old
+            code's overdraw shows against GUI_Paint's spans.
+******************************************************************************/
+static const struct {
+    const char *Name;
+    UBYTE Shape;                // 0 line, 1 rectangle, 2 circle
+    UWORD A[4];                 // Xstart, Ystart, Xend, Yend or X, Y, Radius
+    DOT_PIXEL Width;
+    DRAW_FILL Fill;
+} Bench_Shapes[] = {
+    { "line 1000 px diagonal, w3", 0, { 100, 100, 807, 807 }, DOT_PIXEL_3X3, DRAW_FILL_EMPTY },
+    { "line 1000 px diagonal, w8", 0, { 100, 100, 807, 807 }, DOT_PIXEL_8X8, DRAW_FILL_EMPTY },
+    { "line 800 px across, w4",    0, { 200, 600, 1000, 600 }, DOT_PIXEL_4X4, DRAW_FILL_EMPTY },
+    { "rectangle 600x400, w4",     1, { 300, 300, 900, 700 }, DOT_PIXEL_4X4, DRAW_FILL_EMPTY },
+    { "circle r50, filled",        2, { 600, 600, 50 }, DOT_PIXEL_1X1, DRAW_FILL_FULL },
+    { "circle r300, filled",       2, { 600, 600, 300 }, DOT_PIXEL_1X1, DRAW_FILL_FULL },
+};
+
+// Pixels written since the last call
+static UDOUBLE Bench_Written(void)
+{
+#if PAINT_COUNT
+    UDOUBLE Written = Paint_Written;
+    Paint_Written = 0;
+    return Written;
+#else
+    return 0;
+#endif
+}
+
+static int Bench_Pixels(int Reps)
+{
+    UBYTE *Image[2] = { (UBYTE *)malloc(600 * 1600), (UBYTE *)malloc(600 * 1600) };
+    int Failed = 0;
+    PAINT Ctx;
+
+    if (!PAINT_COUNT) {
+        fprintf(stderr, "--pixels needs a build with -DPAINT_COUNT=1\n");
+        return 2;
+    }
+    if (Image[0] == NULL || Image[1] == NULL) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    printf("shape                      rot        reference          GUI_Paint\n");
+    for (UWORD Rotate : { ROTATE_0, ROTATE_90 }) {
+        for (const auto &S : Bench_Shapes) {
+            UDOUBLE Written[2];
+            double Us[2];
+            for (int Lib = 0; Lib < 2; Lib++) {
+                auto Draw = [&] {
+                    if (S.Shape == 0 && Lib)
+                        Paint_DrawLine_r(&Ctx, S.A[0], S.A[1], S.A[2], S.A[3], S6_RED, S.Width, LINE_STYLE_SOLID);
+                    else if (S.Shape == 0)
+                        Ref_DrawLine(&Ctx, S.A[0], S.A[1], S.A[2], S.A[3], S6_RED, S.Width, LINE_STYLE_SOLID);
+                    else if (S.Shape == 1 && Lib)
+                        Paint_DrawRectangle_r(&Ctx, S.A[0], S.A[1], S.A[2], S.A[3], S6_RED, S.Width, S.Fill);
+                    else if (S.Shape == 1)
+                        Ref_DrawRectangle(&Ctx, S.A[0], S.A[1], S.A[2], S.A[3], S6_RED, S.Width, S.Fill);
+                    else if (Lib)
+                        Paint_DrawCircle_r(&Ctx, S.A[0], S.A[1], S.A[2], S6_RED, S.Width, S.Fill);
+                    else
+                        Ref_DrawCircle(&Ctx, S.A[0], S.A[1], S.A[2], S6_RED, S.Width, S.Fill);
+                };
+                memset(Image[Lib], S6_WHITE * 0x11, 600 * 1600);
+                Paint_NewImage_r(&Ctx, Image[Lib], 1200, 1600, Rotate, WHITE);
+                Paint_SetScale_r(&Ctx, 6);
+                Bench_Written();
+                Draw();
+                Written[Lib] = Bench_Written();
+                Us[Lib] = Bench_Best(Reps, Draw);
+            }
+            int Same = !memcmp(Image[0], Image[1], 600 * 1600);
+            printf("%-26s %3u %7lu / %7.1f us %7lu / %7.1f us  %s\n", S.Name, (unsigned)Rotate,
+                   (unsigned long)Written[0], Us[0], (unsigned long)Written[1], Us[1], Same? "same" : "DIFFERS");
+            Failed |= !Same;
+        }
+    }
+    free(Image[1]);
+    free(Image[0]);
+    return Failed;
+}
+
+// Cases of the glyph modes: black on white, transparent and opaque at 0
+// degrees, transparent at 90
+static const struct {
+    UWORD Rotate;
+    UWORD Back;
+} Bench_GlyphCases[] = { { ROTATE_0, FONT_BACKGROUND }, { ROTATE_0, S6_WHITE }, { ROTATE_90, FONT_BACKGROUND } };
+
+// Cover the image with Width x Height cells, Draw(X, Y, n) for cell n;
+// returns the number of cells
+template <class F>
+static UDOUBLE Bench_Cells(PAINT *P, UWORD Width, UWORD Height, F Draw)
+{
+    UDOUBLE n = 0;
+    for (UWORD Y = 0; Y + Height <= P->Height; Y += Height)
+        for (UWORD X = 0; X + Width <= P->Width; X += Width, n++)
+            Draw(X, Y, n);
+    return n;
+}
+
+// Character n of a caption
+static char Bench_Char(UDOUBLE n)
+{
+    return Bench_Paragraph[n % (sizeof(Bench_Paragraph) - 1)];
+}
+
+/******************************************************************************
+function :  Characters per second of every built-in font
+info     :  The whole 1200 x 1600 image at scale 6 is covered with one
+            character per cell of the font's size, in every case of
+            Bench_GlyphCases. ASCII fonts draw the characters of
+            Bench_Paragraph in turn through Paint_DrawChar_r(), as a
+            caption would; CN fonts every table entry in turn, looked up
+            with Paint_FindCN() and drawn with Paint_DrawGlyph_r(). The
+            reference draws the same glyphs one bit at a time.
+******************************************************************************/
+static int Bench_Glyphs(int Reps)
+{
+    static const struct {
+        const char *Name;
+        sFONT *Font;
+        cFONT *FontCN;
+    } Fonts[] = {
+        { "Font8", &Font8, NULL }, { "Font12", &Font12, NULL }, { "Font16", &Font16, NULL },
+        { "Font20", &Font20, NULL }, { "Font24", &Font24, NULL },
+        { "Font12CN", NULL, &Font12CN }, { "Font24CN", NULL, &Font24CN },
+    };
+    UBYTE *Image[2] = { (UBYTE *)malloc(600 * 1600), (UBYTE *)malloc(600 * 1600) };
+    int Failed = 0;
+    PAINT Ctx;
+
+    if (Image[0] == NULL || Image[1] == NULL) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    printf("characters per second        reference    GUI_Paint   gain\n");
+    for (const auto &F : Fonts) {
+        sFONT *Font = F.Font;
+        cFONT *FontCN = F.FontCN;
+        UWORD Width = Font? Font->Width : FontCN->Width;
+        UWORD Height = Font? Font->Height : FontCN->Height;
+        std::vector<UBYTE> Table;
+        sFONT Raw;
+
+        if (Font)
+            Raw = Bench_RawFont(Font, &Table);
+        for (const auto &C : Bench_GlyphCases) {
+            double Us[2];
+            UDOUBLE Chars = 0;
+            for (int Lib = 0; Lib < 2; Lib++) {
+                memset(Image[Lib], S6_WHITE * 0x11, 600 * 1600);
+                Paint_NewImage_r(&Ctx, Image[Lib], 1200, 1600, C.Rotate, WHITE);
+                Paint_SetScale_r(&Ctx, 6);
+                Us[Lib] = Bench_Best(Reps, [&] {
+                    Chars = Bench_Cells(&Ctx, Width, Height, [&](UWORD X, UWORD Y, UDOUBLE n) {
+                        if (Font && Lib) {
+                            Paint_DrawChar_r(&Ctx, X, Y, Bench_Char(n), Font, S6_BLACK, C.Back);
+                        } else if (Font) {
+                            Ref_DrawChar(&Ctx, X, Y, Bench_Char(n), &Raw, S6_BLACK, C.Back);
+                        } else {
+                            const char *Entry = (const char *)FontCN->table[n % FontCN->size].index;
+                            const CH_CN *Glyph = Paint_FindCN(FontCN, Entry);
+                            if (Lib)
+                                Paint_DrawGlyph_r(&Ctx, X, Y, Glyph->matrix, Width, Height, S6_BLACK, C.Back);
+                            else
+                                Ref_DrawGlyph(&Ctx, X, Y, Glyph->matrix, Width, Height, S6_BLACK, C.Back);
+                        }
+                    });
+                });
+            }
+            int Same = !memcmp(Image[0], Image[1], 600 * 1600);
+            char Name[40];
+            snprintf(Name, sizeof(Name), "%s, %u deg %s", F.Name, (unsigned)C.Rotate,
+                     (C.Back == FONT_BACKGROUND)? "transparent" : "opaque");
+            printf("%-28s %8.2fM %10.2fM %6.1fx  %s\n", Name, Chars / Us[0], Chars / Us[1], Us[0] / Us[1],
+                   Same? "same" : "DIFFERS");
+            Failed |= !Same;
+        }
+    }
+    free(Image[1]);
+    free(Image[0]);
+    return Failed;
+}
+
+/******************************************************************************
+function :  Packed fonts against plain tables
+info     :  Flash bytes of Font8 to Font24 as plain tables and packed
+            (glyphs, the 3 pad bytes and the offsets), and nanoseconds per
+            character of Paint_DrawChar_r() drawing Bench_Paragraph from
+            the table of Bench_RawFont() and from the packed font, in every
+            case of Bench_GlyphCases, on a 1200 x 1600 image at scale 6.
+            Both must leave the same bytes.
+******************************************************************************/
+static int Bench_Packed(int Reps)
+{
+    static sFONT *const Fonts[] = { &Font8, &Font12, &Font16, &Font20, &Font24 };
+    static const char *const Names[] = { "Font8", "Font12", "Font16", "Font20", "Font24" };
+    UBYTE *Image[2] = { (UBYTE *)malloc(600 * 1600), (UBYTE *)malloc(600 * 1600) };
+    int Failed = 0;
+    PAINT Ctx;
+
+    if (Image[0] == NULL || Image[1] == NULL) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    if (Font8.table != NULL) {
+        fprintf(stderr, "--packed needs FONT_PACKED 1\n");
+        return 2;
+    }
+    printf("font     raw bytes packed   ns/char: 0 deg raw/packed  opaque raw/packed   90 deg raw/packed\n");
+    for (int f = 0; f < 5; f++) {
+        sFONT *Font = Fonts[f];
+        std::vector<UBYTE> Table;
+        sFONT Raw = Bench_RawFont(Font, &Table);
+        UDOUBLE RawBytes = (UDOUBLE)95 * Font->Height * ((Font->Width + 7) / 8);
+        const UBYTE *Last = Font->packed + Font->offsets[94];
+        UDOUBLE Box = ((UDOUBLE)Last[0] << 16) | ((UDOUBLE)Last[1] << 8) | Last[2];    // see Paint_Unpack()
+        UDOUBLE LastBytes = 3 + (((Box >> 12) & 0x3F) * (Box & 0x3F) + 7) / 8;
+        UDOUBLE PackedBytes = Font->offsets[94] + LastBytes + 3 + 95 * sizeof(Font->offsets[0]);
+        int Same = 1;
+
+        printf("%-8s %9lu %6lu  ", Names[f], (unsigned long)RawBytes, (unsigned long)PackedBytes);
+        for (const auto &C : Bench_GlyphCases) {
+            double Ns[2];
+            for (int Pack = 0; Pack < 2; Pack++) {
+                sFONT *Drawn = Pack? Font : &Raw;
+                UDOUBLE Chars = 0;
+                memset(Image[Pack], S6_WHITE * 0x11, 600 * 1600);
+                Paint_NewImage_r(&Ctx, Image[Pack], 1200, 1600, C.Rotate, WHITE);
+                Paint_SetScale_r(&Ctx, 6);
+                double Us = Bench_Best(Reps, [&] {
+                    Chars = Bench_Cells(&Ctx, Font->Width, Font->Height, [&](UWORD X, UWORD Y, UDOUBLE n) {
+                        Paint_DrawChar_r(&Ctx, X, Y, Bench_Char(n), Drawn, S6_BLACK, C.Back);
+                    });
+                });
+                Ns[Pack] = Us * 1000 / Chars;
+            }
+            Same &= !memcmp(Image[0], Image[1], 600 * 1600);
+            printf("%11.0f / %-6.0f", Ns[0], Ns[1]);
+        }
+        printf("  %s\n", Same? "same" : "DIFFERS");
+        Failed |= !Same;
+    }
+    free(Image[1]);
+    free(Image[0]);
+    return Failed;
+}
+
+/******************************************************************************
+function :  Time CN caption lookups, sorted index against table scan
+info     :  A caption of 200 random entries of Font24CN, and one of a
+            synthetic 3000 entry font: code points from U+4E00 in random
+            table order, glyphs borrowed from Font24CN, keys sorted by
+            key and entry as CH_CN_MakeIndex() does. Each font is also
+            used with keys NULL, which Paint_FindCN() scans. Lookup times
+            the 200 Paint_FindCN() calls alone, draw the caption through
+            Paint_DrawString_CN_r() on a 1200 x 1600 image; most of it
+            runs off the right edge, so drawing is mostly lookup too.
+******************************************************************************/
+#define BENCH_SYNTHETIC 3000
+
+static int Bench_Caption(int Reps)
+{
+    CH_CN *Table = (CH_CN *)calloc(BENCH_SYNTHETIC, sizeof(CH_CN));
+    std::vector<CH_CN_KEY> Keys(BENCH_SYNTHETIC);
+    std::vector<UWORD> Order(BENCH_SYNTHETIC);
+    UBYTE *Image[2] = { (UBYTE *)malloc(600 * 1600), (UBYTE *)malloc(600 * 1600) };
+    int Failed = 0;
+    PAINT Ctx;
+
+    if (Table == NULL || Image[0] == NULL || Image[1] == NULL) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    srand(1);
+    for (UWORD i = 0; i < BENCH_SYNTHETIC; i++)
+        Order[i] = i;
+    for (UWORD i = BENCH_SYNTHETIC - 1; i > 0; i--)
+        std::swap(Order[i], Order[rand() % (i + 1)]);
+    for (UWORD i = 0; i < BENCH_SYNTHETIC; i++) {
+        UDOUBLE Code = 0x4E00 + Order[i];           // three UTF-8 bytes
+        UBYTE *Index = (UBYTE *)Table[i].index;
+        Index[0] = 0xE0 | (Code >> 12);
+        Index[1] = 0x80 | ((Code >> 6) & 0x3F);
+        Index[2] = 0x80 | (Code & 0x3F);
+        memcpy((UBYTE *)Table[i].matrix, Font24CN.table[i % Font24CN.size].matrix, sizeof(Table[i].matrix));
+        Keys[i].key = ((UDOUBLE)Index[0] << 16) | ((UDOUBLE)Index[1] << 8) | Index[2];
+        Keys[i].entry = i;
+    }
+    std::sort(Keys.begin(), Keys.end(), [](const CH_CN_KEY &a, const CH_CN_KEY &b) {
+        return a.key < b.key || (a.key == b.key && a.entry < b.entry);
+    });
+    cFONT Synthetic = { Table, BENCH_SYNTHETIC, Font24CN.ASCII_Width, Font24CN.Width, Font24CN.Height, Keys.data() };
+
+    printf("font                 entries  lookup, index    scan   draw, index       scan\n");
+    for (cFONT *Font : { &Font24CN, &Synthetic }) {
+        cFONT Scanned = *Font;
+        std::string Caption;
+        double Look[2], Draw[2];
+
+        Scanned.keys = NULL;
+        for (int i = 0; i < 200; i++)
+            Caption += (const char *)Font->table[rand() % Font->size].index;
+        for (int Scan = 0; Scan < 2; Scan++) {
+            cFONT *F = Scan? &Scanned : Font;
+            Look[Scan] = Bench_Best(Reps, [&] {
+                for (const char *p = Caption.c_str(); *p; p += ((*p & 0xFF) <= 0x7F)? 1 : 3)
+                    if (Paint_FindCN(F, p) == NULL)
+                        Failed = 1;
+            });
+            memset(Image[Scan], S6_WHITE * 0x11, 600 * 1600);
+            Paint_NewImage_r(&Ctx, Image[Scan], 1200, 1600, ROTATE_0, WHITE);
+            Paint_SetScale_r(&Ctx, 6);
+            Draw[Scan] = Bench_Best(Reps, [&] {
+                Paint_DrawString_CN_r(&Ctx, 0, 100, Caption.c_str(), F, S6_BLACK, FONT_BACKGROUND);
+            });
+        }
+        int Same = !memcmp(Image[0], Image[1], 600 * 1600);
+        printf("%-20s %7u %10.1f us %6.1f us %9.1f us %8.1f us  %s\n", (Font == &Font24CN)? "Font24CN" : "synthetic",
+               (unsigned)Font->size, Look[0], Look[1], Draw[0], Draw[1], Same? "same" : "DIFFERS");
+        Failed |= !Same;
+    }
+    free(Image[1]);
+    free(Image[0]);
+    free(Table);
+    return Failed;
+}
+
+// Pixel by pixel through Paint_SetPixel_r(), leaving out Key (any value
+// above 0x0F draws them all)
+static void Ref_DrawImage4(PAINT *P, const UBYTE *Image, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image,
+                           UWORD Key)
+{
+    UWORD Stride = (W_Image + 1) / 2;
+
+    for (UWORD j = 0; j < H_Image; j++) {
+        for (UWORD i = 0; i < W_Image; i++) {
+            UBYTE Byte = Image[(UDOUBLE)j * Stride + i / 2];
+            UBYTE Pixel = (i % 2)? (Byte & 0x0F) : (Byte >> 4);
+            if (Pixel != Key)
+                Paint_SetPixel_r(P, xStart + i, yStart + j, Pixel);
+        }
+    }
+}
+
+/******************************************************************************
+function :  Check and time Paint_DrawImage4() and Paint_DrawSprite4()
+info     :  20000 random blits on a 200 x 150 image filled with random
+            bytes: scales 2, 6 and 7, every rotation and mirror, half of
+            them in a random band, images 1 to 120 x 90 pixels placed up to
+            40 pixels past the right and bottom edges, half of them with a
+            random transparent nibble. Each must leave the same bytes as
+            Ref_DrawImage4(). Then 120 x 90 thumbnails tiled over a
+            1200 x 1600 image at scale 6 are timed against the reference,
+            on even and odd columns, rotated and mirrored.
+******************************************************************************/
+#define BENCH_BLIT_CASES 20000
+
+static int Bench_Blits(int Reps)
+{
+    UBYTE *Image[2] = { (UBYTE *)malloc(600 * 1600), (UBYTE *)malloc(600 * 1600) };
+    std::vector<UBYTE> Thumb(60 * 90), Fill(100 * 150);
+    UDOUBLE Cases[3] = { 0, 0, 0 }, Differ = 0;
+    int Failed = 0;
+    PAINT Ctx;
+
+    if (Image[0] == NULL || Image[1] == NULL) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    srand(1);
+    for (UDOUBLE n = 0; n < BENCH_BLIT_CASES; n++) {
+        static const UBYTE Scales[] = { 2, 6, 7 };
+        static const UWORD Rotates[] = { ROTATE_0, ROTATE_90, ROTATE_180, ROTATE_270 };
+        UBYTE S = rand() % 3, Mirror = rand() % 4, Banded = rand() % 2;
+        UWORD Rotate = Rotates[rand() % 4];
+        UWORD Key = (rand() % 2)? rand() % 16 : 0xFFFF;
+        UWORD W = 1 + rand() % 120, H = 1 + rand() % 90;
+        UWORD Ppb = (Scales[S] == 2)? 8 : 2;
+        UWORD BandX = 0, BandY = 0, BandW = 200, BandH = 150;
+
+        UWORD Across = (Rotate == ROTATE_0 || Rotate == ROTATE_180)? 200 : 150;
+        UWORD X = rand() % (Across + 40), Y = rand() % (350 - Across + 40);
+
+        if (Banded) {
+            BandX = rand() % (200 / Ppb) * Ppb;
+            BandY = rand() % 150;
+            BandW = 1 + rand() % (200 - BandX);
+            BandH = 1 + rand() % (150 - BandY);
+        }
+        for (UBYTE &b : Fill)
+            b = rand();
+        for (UBYTE &b : Thumb)
+            b = rand();
+        for (int Lib = 0; Lib < 2; Lib++) {
+            memcpy(Image[Lib], Fill.data(), Fill.size());
+            Paint_NewImage_r(&Ctx, Image[Lib], 200, 150, Rotate, WHITE);
+            Paint_SetScale_r(&Ctx, Scales[S]);
+            Paint_SetMirroring_r(&Ctx, Mirror);
+            Paint_SetBand_r(&Ctx, BandX, BandY, BandW, BandH);
+            if (Lib == 0)
+                Ref_DrawImage4(&Ctx, Thumb.data(), X, Y, W, H, Key);
+            else if (Key > 0x0F)
+                Paint_DrawImage4_r(&Ctx, Thumb.data(), X, Y, W, H);
+            else
+                Paint_DrawSprite4_r(&Ctx, Thumb.data(), X, Y, W, H, Key);
+        }
+        Cases[S]++;
+        if (memcmp(Image[0], Image[1], Fill.size())) {
+            if (Differ++ == 0)
+                printf("first difference: case %lu, scale %u, rotate %u, mirror %u, band %u,%u %ux%u, %ux%u, key %u\n",
+                       (unsigned long)n, (unsigned)Scales[S], (unsigned)Rotate, (unsigned)Mirror, (unsigned)BandX,
+                       (unsigned)BandY, (unsigned)BandW, (unsigned)BandH, (unsigned)W, (unsigned)H, (unsigned)Key);
+        }
+    }
+    printf("random blits: %lu at scale 2, %lu at 6, %lu at 7, %lu differ\n", (unsigned long)Cases[0],
+           (unsigned long)Cases[1], (unsigned long)Cases[2], (unsigned long)Differ);
+    Failed |= Differ != 0;
+
+    static const struct {
+        const char *Name;
+        UWORD Rotate;
+        UBYTE Mirror;
+        UWORD Odd;
+        UWORD Key;
+    } Runs[] = {
+        { "image, even x",       ROTATE_0,   MIRROR_NONE,       0, 0xFFFF },
+        { "image, odd x",        ROTATE_0,   MIRROR_NONE,       1, 0xFFFF },
+        { "image, 180 deg",      ROTATE_180, MIRROR_NONE,       0, 0xFFFF },
+        { "image, mirrored",     ROTATE_0,   MIRROR_HORIZONTAL, 0, 0xFFFF },
+        { "image, 90 deg",       ROTATE_90,  MIRROR_NONE,       0, 0xFFFF },
+        { "sprite, even x",      ROTATE_0,   MIRROR_NONE,       0, S6_WHITE },
+        { "sprite, odd x",       ROTATE_0,   MIRROR_NONE,       1, S6_WHITE },
+    };
+    for (UBYTE &b : Thumb)
+        b = ((rand() % 7) << 4) | (rand() % 7);
+    printf("120 x 90 thumbnails             rot    reference    GUI_Paint   gain\n");
+    for (const auto &R : Runs) {
+        Failed |= Bench_Versus(R.Name, Reps, R.Rotate, 6, Image[0], Image[1], [&](PAINT *P, int Lib) {
+            Paint_SetMirroring_r(P, R.Mirror);
+            Bench_Cells(P, 121, 90, [&](UWORD X, UWORD Y, UDOUBLE) {
+                if (Lib == 0)
+                    Ref_DrawImage4(P, Thumb.data(), X + R.Odd, Y, 120, 90, R.Key);
+                else if (R.Key > 0x0F)
+                    Paint_DrawImage4_r(P, Thumb.data(), X + R.Odd, Y, 120, 90);
+                else
+                    Paint_DrawSprite4_r(P, Thumb.data(), X + R.Odd, Y, 120, 90, R.Key);
+            });
+        });
+    }
+    free(Image[1]);
+    free(Image[0]);
+    return Failed;
+}
+
+/******************************************************************************
+Reference SD font
+    The whole .s6f file in memory, each glyph found by binary search over
+    the full index and drawn by Ref_DrawGlyph(), with the wrap, advance
+    and UTF-8 rules of GUI_SDFont_DrawString().
+******************************************************************************/
+typedef struct {
+    std::vector<UBYTE> Data;
+    GUI_SDFONT_HEADER Header;
+    const GUI_SDFONT_ENTRY *Index;
+} REF_SDFONT;
+
+static int Ref_SDFont_Load(REF_SDFONT *Font, const char *Path)
+{
+    FILE *f = fopen(Path, "rb");
+
+    if (f == NULL)
+        return 1;
+    for (int c; (c = fgetc(f)) != EOF; )
+        Font->Data.push_back(c);
+    fclose(f);
+    if (Font->Data.size() < sizeof(Font->Header))
+        return 1;
+    memcpy(&Font->Header, Font->Data.data(), sizeof(Font->Header));
+    if (Font->Header.Magic != GUI_SDFONT_MAGIC ||
+        Font->Header.IndexOffset + (size_t)Font->Header.Count * sizeof(GUI_SDFONT_ENTRY) > Font->Data.size())
+        return 1;
+    Font->Index = (const GUI_SDFONT_ENTRY *)(Font->Data.data() + Font->Header.IndexOffset);
+    return 0;
+}
+
+static UDOUBLE Ref_SDFont_Next(const char **pString)
+{
+    const UBYTE *p = (const UBYTE *)*pString;
+    int More = (p[0] < 0x80)? 0 : ((p[0] & 0xE0) == 0xC0)? 1 : ((p[0] & 0xF0) == 0xE0)? 2 :
+               ((p[0] & 0xF8) == 0xF0)? 3 : -1;
+    UDOUBLE Code = (More == 0)? p[0] : p[0] & (0x3F >> More);
+
+    if (More < 0) {
+        *pString += 1;
+        return 0xFFFD;
+    }
+    for (int i = 1; i <= More; i++) {
+        if ((p[i] & 0xC0) != 0x80) {
+            *pString += i;
+            return 0xFFFD;
+        }
+        Code = (Code << 6) | (p[i] & 0x3F);
+    }
+    *pString += More + 1;
+    return Code;
+}
+
+static void Ref_SDFont_DrawString(PAINT *P, const REF_SDFONT *Font, UWORD Xstart, UWORD Ystart, const char *pString,
+                                  UWORD Color_Foreground, UWORD Color_Background)
+{
+    const GUI_SDFONT_ENTRY *End = Font->Index + Font->Header.Count;
+    UWORD Xpoint = Xstart, Ypoint = Ystart;
+
+    while (*pString != '\0') {
+        UDOUBLE Code = Ref_SDFont_Next(&pString);
+        if (Code == '\n') {
+            Xpoint = Xstart;
+            Ypoint += Font->Header.Height;
+            continue;
+        }
+        const GUI_SDFONT_ENTRY *Entry = std::lower_bound(Font->Index, End, Code,
+            [](const GUI_SDFONT_ENTRY &e, UDOUBLE c) { return (e.Code & 0xFFFFFF) < c; });
+        UWORD Width = (Entry != End && (Entry->Code & 0xFFFFFF) == Code)? Entry->Code >> 24 : 0;
+        if (Width > MAX_WIDTH_FONT)
+            Width = 0;
+        UWORD Advance = Width? Width : Font->Header.MaxWidth / 2;
+        if (Xpoint + Advance > P->Width) {
+            Xpoint = Xstart;
+            Ypoint += Font->Header.Height;
+        }
+        if (Width)
+            Ref_DrawGlyph(P, Xpoint, Ypoint, &Font->Data[Entry->Offset], Width, Font->Header.Height,
+                          Color_Foreground, Color_Background);
+        Xpoint += Advance;
+    }
+}
+
+/******************************************************************************
+function :  Draw text through the GUI_SDFont glyph cache
+info     :  Reads the .s6f file given by --font (tools/make_s6f.py) through
+            the SD.h shim, on a 1200 x 1600 picture at scale 6, at 0 and 90
+            degrees: Bench_Paragraph, which the cache holds after its first
+            line, and the first 1000 glyphs of the font, which evict each
+            other. Each is drawn once from a cold cache and Reps times in
+            40 row bands with the font kept open, as a caption would be;
+            both pictures must match the reference drawn from the file in
+            memory.
+******************************************************************************/
+static const char *Bench_FontPath = "caption.s6f";
+
+static int Bench_SDFont(int Reps)
+{
+    static GUI_SDFONT Font;
+    static REF_SDFONT Ref;
+    UBYTE *Image[3] = { (UBYTE *)malloc(600 * 1600), (UBYTE *)malloc(600 * 1600), (UBYTE *)malloc(600 * 1600) };
+    std::string Glyphs;
+    int Failed = 0;
+    PAINT Ctx;
+
+    if (Image[0] == NULL || Image[1] == NULL || Image[2] == NULL) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    if (Ref_SDFont_Load(&Ref, Bench_FontPath)) {
+        fprintf(stderr, "cannot read %s, see tools/make_s6f.py\n", Bench_FontPath);
+        return 1;
+    }
+    for (UDOUBLE i = 0; i < Ref.Header.Count && i < 1000; i++) {
+        UDOUBLE Code = Ref.Index[i].Code & 0xFFFFFF;
+        if (Code < 0x20)
+            continue;
+        if (Code < 0x80) {
+            Glyphs += (char)Code;
+        } else if (Code < 0x800) {
+            Glyphs += (char)(0xC0 | (Code >> 6));
+            Glyphs += (char)(0x80 | (Code & 0x3F));
+        } else if (Code < 0x10000) {
+            Glyphs += (char)(0xE0 | (Code >> 12));
+            Glyphs += (char)(0x80 | ((Code >> 6) & 0x3F));
+            Glyphs += (char)(0x80 | (Code & 0x3F));
+        } else {
+            Glyphs += (char)(0xF0 | (Code >> 18));
+            Glyphs += (char)(0x80 | ((Code >> 12) & 0x3F));
+            Glyphs += (char)(0x80 | ((Code >> 6) & 0x3F));
+            Glyphs += (char)(0x80 | (Code & 0x3F));
+        }
+    }
+    printf("%s: %lu glyphs, %u rows\n", Bench_FontPath, (unsigned long)Ref.Header.Count, (unsigned)Ref.Header.Height);
+    printf("text       rotate   cold: hits reads     draw   bands: hits reads/frame  frame\n");
+    for (int All = 0; All < 2; All++) {
+        const char *Text = All? Glyphs.c_str() : Bench_Paragraph;
+        for (UWORD Rotate : { ROTATE_0, ROTATE_90 }) {
+            for (int i = 0; i < 3; i++)
+                memset(Image[i], S6_WHITE * 0x11, 600 * 1600);
+            Paint_NewImage_r(&Ctx, Image[0], 1200, 1600, Rotate, WHITE);
+            Paint_SetScale_r(&Ctx, 6);
+            Ref_SDFont_DrawString(&Ctx, &Ref, 40, 100, Text, S6_BLACK, FONT_BACKGROUND);
+
+            if (GUI_SDFont_Open(&Font, Bench_FontPath)) {
+                fprintf(stderr, "GUI_SDFont_Open(%s) failed\n", Bench_FontPath);
+                return 1;
+            }
+            Paint_NewImage(Image[1], 1200, 1600, Rotate, WHITE);
+            Paint_SetScale(6);
+            GUI_SDFont_DrawString(&Font, 40, 100, Text, S6_BLACK, FONT_BACKGROUND);
+            UDOUBLE Lookups = Font.Hits + Font.Misses, Hits = Font.Hits, Reads = Font.Reads, Cold = Font.Draw_us;
+            GUI_SDFont_Close(&Font);
+
+            GUI_SDFont_Open(&Font, Bench_FontPath);
+            double Frame = Bench_Best(Reps, [&] {
+                for (UWORD Y = 0; Y < 1600; Y += 40) {
+                    Paint_NewImage(Image[2] + Y * 600, 1200, 1600, Rotate, WHITE);
+                    Paint_SetScale(6);
+                    Paint_SetBand(0, Y, 1200, 40);
+                    GUI_SDFont_DrawString(&Font, 40, 100, Text, S6_BLACK, FONT_BACKGROUND);
+                }
+            });
+            UDOUBLE Banded = Font.Hits + Font.Misses;
+            int Same = !memcmp(Image[0], Image[1], 600 * 1600) && !memcmp(Image[0], Image[2], 600 * 1600);
+            printf("%-10s %6u %10lu%% %5lu %6lu us %10lu%% %11.1f %6.1f ms  %s\n", All? "all glyphs" : "paragraph",
+                   (unsigned)Rotate, (unsigned long)(Lookups? Hits * 100 / Lookups : 0), (unsigned long)Reads,
+                   (unsigned long)Cold, (unsigned long)(Banded? Font.Hits * 100 / Banded : 0),
+                   (double)Font.Reads / Reps, Frame / 1000, Same? "same" : "DIFFERS");
+            GUI_SDFont_Close(&Font);
+            Failed |= !Same;
+        }
+    }
+    for (int i = 0; i < 3; i++)
+        free(Image[i]);
+    return Failed;
+}
+
+static unsigned long long Bench_Checksum(const BENCH_FRAME *Frame)
+{
+    unsigned long long Hash = 0xCBF29CE484222325ULL;     // FNV-1a
+    size_t Size = (size_t)Frame->Width / 2 * Frame->Height;
+    for (size_t i = 0; i < Size; i++)
+        Hash = (Hash ^ Frame->Canvas[i]) * 0x100000001B3ULL;
+    return Hash;
+}
+
+// Modes that replace the banded render, each run with the reps count
+static const struct {
+    const char *Option;
+    int (*Run)(int Reps);
+} Bench_Modes[] = {
+    { "--polygons", Bench_Polygons },
+    { "--tints",    Bench_Tints },
+    { "--text",     Bench_Text },
+    { "--writers",  Bench_Writers },
+    { "--clear",    Bench_Clear },
+    { "--bands",    Bench_Bands },
+    { "--pixels",   Bench_Pixels },
+    { "--glyphs",   Bench_Glyphs },
+    { "--caption",  Bench_Caption },
+    { "--packed",   Bench_Packed },
+    { "--blits",    Bench_Blits },
+    { "--sdfont",   Bench_SDFont },
+};
+
+int main(int argc, char **argv)
+{
+    BENCH_FRAME Frame = { NULL, 4800, 6400, 64, 0 };
+    int Reps = 5;
+    int Mode = -1;
+    std::vector<int> Counts = { 1, 2, 4, 8 };
+
+    for (int i = 1; i < argc; i++) {
+        char *Value = (i + 1 < argc)? argv[i + 1] : (char *)"";
+        int Found = -1;
+        for (size_t m = 0; m < sizeof(Bench_Modes) / sizeof(Bench_Modes[0]); m++)
+            if (!strcmp(argv[i], Bench_Modes[m].Option))
+                Found = m;
+        if (Found >= 0) {
+            Mode = Found;
+            continue;
+        }
+        if (!strcmp(argv[i], "--width"))
+            Frame.Width = atoi(Value) & ~1;
+        else if (!strcmp(argv[i], "--height"))
+            Frame.Height = atoi(Value);
+        else if (!strcmp(argv[i], "--band"))
+            Frame.Band = atoi(Value);
+        else if (!strcmp(argv[i], "--reps"))
+            Reps = atoi(Value);
+        else if (!strcmp(argv[i], "--font"))
+            Bench_FontPath = Value;
+        else if (!strcmp(argv[i], "--threads")) {
+            Counts.clear();
+            for (char *p = Value, *End; *p; p = End + (*End == ',')) {
+                Counts.push_back(strtol(p, &End, 10));
+                if (End == p || (*End != ',' && *End != 0))
+                    Counts.back() = 0;      // rejected below
+                if (End == p)
+                    break;
+            }
+        } else {
+            fprintf(stderr, "unknown option %s\n", argv[i]);
+            return 2;
+        }
+        i++;
+    }
+    if (Frame.Width < 2 || Frame.Height < 1 || Frame.Band < 1 || Reps < 1) {
+        fprintf(stderr, "bad canvas, band or reps\n");
+        return 2;
+    }
+    if (Mode >= 0)
+        return Bench_Modes[Mode].Run(Reps);
+    int Most = 1;
+    for (int n : Counts) {
+        if (n < 1 || n > MAX_THREADS) {
+            fprintf(stderr, "thread counts must be 1 to %d\n", MAX_THREADS);
+            return 2;
+        }
+        Most = (n > Most)? n : Most;
+    }
+
+    Frame.Bands = (Frame.Height + Frame.Band - 1) / Frame.Band;
+    Frame.Canvas = (UBYTE *)malloc((size_t)Frame.Width / 2 * Frame.Height);
+    if (Frame.Canvas == NULL) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    printf("canvas %ux%u, %u bands of %u rows, %u hardware threads\n", (unsigned)Frame.Width,
+           (unsigned)Frame.Height, (unsigned)Frame.Bands, (unsigned)Frame.Band, std::thread::hardware_concurrency());
+
+    BENCH_POOL Pool;
+    Bench_PoolStart(&Pool, Most);
+    Bench_Render(&Pool, &Frame, 1);
+    unsigned long long Reference = Bench_Checksum(&Frame);
+
+    double Single = 0;
+    int Failed = 0;
+    for (int n : Counts) {
+        double Best = 1e30;
+        for (int r = 0; r < Reps; r++) {
+            // Code 4 is not a Spectra 6 color: a band left out changes the sum
+            memset(Frame.Canvas, 0x44, (size_t)Frame.Width / 2 * Frame.Height);
+            auto t0 = std::chrono::steady_clock::now();
+            Bench_Render(&Pool, &Frame, n);
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+            Best = (ms < Best)? ms : Best;
+        }
+        unsigned long long Sum = Bench_Checksum(&Frame);
+        if (n == 1)
+            Single = Best;
+        printf("%2d threads: %8.2f ms", n, Best);
+        if (Single > 0)
+            printf("  speedup %5.2fx", Single / Best);
+        printf("  checksum %016llx %s\n", Sum, (Sum == Reference)? "ok" : "DIFFERS");
+        Failed |= (Sum != Reference);
+    }
+
+    Bench_PoolStop(&Pool);
+    free(Frame.Canvas);
+    return Failed;
+}